@@ -0,0 +1,23 @@
+import { run, bench, group } from "mitata";
+import { createRequire } from "node:module";
+
+const require = createRequire(import.meta.url);
+const { getNamed, getNamedBuffer, hasNamed, setNamed } = require("./build/Release/napi_properties_bench.node");
+
+// Each call does this many property accesses in native code.
+const count = 1000;
+const object = { x: 1, y: 2, z: 3 };
+const other = { a: 0, x: 1, y: 2 };
+
+group(`napi named properties (x${count})`, () => {
+  bench("napi_get_named_property", () => getNamed(object, count));
+  bench("napi_get_named_property (two shapes)", () => {
+    getNamed(object, count / 2);
+    getNamed(other, count / 2);
+  });
+  bench("napi_get_named_property (name in a buffer)", () => getNamedBuffer(object, count));
+  bench("napi_has_named_property", () => hasNamed(object, count));
+  bench("napi_set_named_property", () => setNamed({ x: 0 }, count));
+});
+
+await run();
@@ -0,0 +1,16 @@
+{
+  "targets": [
+    {
+      "target_name": "napi_properties_bench",
+      "sources": ["src/properties.c"]
+    },
+    {
+      "target_name": "napi_threadsafe_bench",
+      "sources": ["src/threadsafe.c"]
+    },
+    {
+      "target_name": "napi_class_bench",
+      "sources": ["src/class.c"]
+    }
+  ]
+}
@@ -0,0 +1,22 @@
+import { run, bench, group } from "mitata";
+import { createRequire } from "node:module";
+
+const require = createRequire(import.meta.url);
+const { Counter } = require("./build/Release/napi_class_bench.node");
+
+class SubCounter extends Counter {}
+
+const counter = new Counter();
+
+group("napi_define_class instances", () => {
+  bench("new Counter() (napi_wrap)", () => new Counter());
+  bench("new SubCounter() (napi_wrap)", () => new SubCounter());
+});
+
+group("napi_define_class methods (napi_unwrap)", () => {
+  bench("counter.increment()", () => counter.increment());
+  bench("counter.add(1)", () => counter.add(1));
+  bench("counter.value", () => counter.value);
+});
+
+await run();
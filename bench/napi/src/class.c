@@ -0,0 +1,88 @@
+// A class defined with napi_define_class whose instances wrap a native
+// counter, like the handles addons hand out for images, statements or
+// hashes: construction wraps, and every method and accessor unwraps.
+#include <node_api.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#define CHECK(call)                                                            \
+  if ((call) != napi_ok) {                                                     \
+    napi_throw_error(env, NULL, #call " failed");                              \
+    return NULL;                                                               \
+  }
+
+typedef struct {
+  int64_t value;
+} Counter;
+
+static void counter_finalize(napi_env env, void *data, void *hint) {
+  free(data);
+}
+
+// new Counter() wraps a freshly allocated counter.
+static napi_value counter_new(napi_env env, napi_callback_info info) {
+  napi_value this_arg;
+  CHECK(napi_get_cb_info(env, info, NULL, NULL, &this_arg, NULL));
+  Counter *counter = calloc(1, sizeof(Counter));
+  CHECK(napi_wrap(env, this_arg, counter, counter_finalize, NULL, NULL));
+  return this_arg;
+}
+
+static Counter *unwrap(napi_env env, napi_callback_info info, size_t *argc,
+                       napi_value *argv) {
+  napi_value this_arg;
+  void *data;
+  Counter *counter = NULL;
+  if (napi_get_cb_info(env, info, argc, argv, &this_arg, &data) != napi_ok ||
+      napi_unwrap(env, this_arg, (void **)&counter) != napi_ok || !counter)
+    napi_throw_error(env, NULL, "not a Counter");
+  return counter;
+}
+
+// counter.increment() returns nothing, so it measures only the call.
+static napi_value counter_increment(napi_env env, napi_callback_info info) {
+  Counter *counter = unwrap(env, info, NULL, NULL);
+  if (counter)
+    counter->value++;
+  return NULL;
+}
+
+// counter.add(n) reads an argument as well.
+static napi_value counter_add(napi_env env, napi_callback_info info) {
+  size_t argc = 1;
+  napi_value argv[1];
+  int64_t n;
+  Counter *counter = unwrap(env, info, &argc, argv);
+  if (!counter)
+    return NULL;
+  CHECK(napi_get_value_int64(env, argv[0], &n));
+  counter->value += n;
+  return NULL;
+}
+
+// counter.value
+static napi_value counter_value(napi_env env, napi_callback_info info) {
+  napi_value result;
+  Counter *counter = unwrap(env, info, NULL, NULL);
+  if (!counter)
+    return NULL;
+  CHECK(napi_create_int64(env, counter->value, &result));
+  return result;
+}
+
+static napi_value init(napi_env env, napi_value exports) {
+  napi_property_descriptor properties[] = {
+      {"increment", NULL, counter_increment, NULL, NULL, NULL, napi_default,
+       NULL},
+      {"add", NULL, counter_add, NULL, NULL, NULL, napi_default, NULL},
+      {"value", NULL, NULL, counter_value, NULL, NULL, napi_default, NULL},
+  };
+  napi_value counter;
+  CHECK(napi_define_class(env, "Counter", NAPI_AUTO_LENGTH, counter_new, NULL,
+                          sizeof(properties) / sizeof(properties[0]),
+                          properties, &counter));
+  CHECK(napi_set_named_property(env, exports, "Counter", counter));
+  return exports;
+}
+
+NAPI_MODULE(NODE_GYP_MODULE_NAME, init)
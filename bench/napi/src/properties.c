@@ -0,0 +1,90 @@
+// Loops over napi property access in native code, the way addons read their
+// options objects and write their results, so the timings are dominated by
+// napi and not by the calls into the addon.
+#include <node_api.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#define CHECK(call)                                                            \
+  if ((call) != napi_ok) {                                                     \
+    napi_throw_error(env, NULL, #call " failed");                              \
+    return NULL;                                                               \
+  }
+
+static napi_status get_args(napi_env env, napi_callback_info info,
+                            napi_value *object, uint32_t *count) {
+  size_t argc = 2;
+  napi_value argv[2];
+  napi_status status = napi_get_cb_info(env, info, &argc, argv, NULL, NULL);
+  if (status != napi_ok)
+    return status;
+  *object = argv[0];
+  return napi_get_value_uint32(env, argv[1], count);
+}
+
+// getNamed(object, count) reads object.x and object.y with string literals.
+static napi_value get_named(napi_env env, napi_callback_info info) {
+  napi_value object, value;
+  uint32_t count;
+  CHECK(get_args(env, info, &object, &count));
+  for (uint32_t i = 0; i < count; i++) {
+    CHECK(napi_get_named_property(env, object, "x", &value));
+    CHECK(napi_get_named_property(env, object, "y", &value));
+  }
+  return value;
+}
+
+// getNamedBuffer(object, count) reads object.x with a name written into a
+// stack buffer on each call, like names built at runtime.
+static napi_value get_named_buffer(napi_env env, napi_callback_info info) {
+  napi_value object, value;
+  uint32_t count;
+  char name[8];
+  CHECK(get_args(env, info, &object, &count));
+  for (uint32_t i = 0; i < count; i++) {
+    snprintf(name, sizeof(name), "%c", 'x' + (i & 1));
+    CHECK(napi_get_named_property(env, object, name, &value));
+  }
+  return value;
+}
+
+// hasNamed(object, count) checks for object.x with a string literal.
+static napi_value has_named(napi_env env, napi_callback_info info) {
+  napi_value object, result;
+  uint32_t count;
+  bool has = false;
+  CHECK(get_args(env, info, &object, &count));
+  for (uint32_t i = 0; i < count; i++)
+    CHECK(napi_has_named_property(env, object, "x", &has));
+  CHECK(napi_get_boolean(env, has, &result));
+  return result;
+}
+
+// setNamed(object, count) writes object.x with a string literal.
+static napi_value set_named(napi_env env, napi_callback_info info) {
+  napi_value object, value;
+  uint32_t count;
+  CHECK(get_args(env, info, &object, &count));
+  for (uint32_t i = 0; i < count; i++) {
+    CHECK(napi_create_uint32(env, i, &value));
+    CHECK(napi_set_named_property(env, object, "x", value));
+  }
+  return object;
+}
+
+static napi_value init(napi_env env, napi_value exports) {
+  napi_property_descriptor properties[] = {
+      {"getNamed", NULL, get_named, NULL, NULL, NULL, napi_default, NULL},
+      {"getNamedBuffer", NULL, get_named_buffer, NULL, NULL, NULL,
+       napi_default, NULL},
+      {"hasNamed", NULL, has_named, NULL, NULL, NULL, napi_default, NULL},
+      {"setNamed", NULL, set_named, NULL, NULL, NULL, napi_default, NULL},
+  };
+  if (napi_define_properties(env, exports,
+                             sizeof(properties) / sizeof(properties[0]),
+                             properties) != napi_ok)
+    return NULL;
+  return exports;
+}
+
+NAPI_MODULE(NODE_GYP_MODULE_NAME, init)
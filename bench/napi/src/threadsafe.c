@@ -0,0 +1,86 @@
+// Pushes items to a threadsafe function from a background thread as fast as
+// napi_call_threadsafe_function() accepts them, like a database driver or a
+// file watcher would, and reports back once the main thread received them
+// all.
+#include <node_api.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+typedef struct {
+  napi_threadsafe_function tsfn;
+  napi_ref callback;
+  pthread_t thread;
+  uint32_t count;
+  uint32_t received;
+} Producer;
+
+static void *produce(void *data) {
+  Producer *producer = data;
+  for (uint32_t i = 0; i < producer->count; i++)
+    napi_call_threadsafe_function(producer->tsfn, (void *)(uintptr_t)i,
+                                  napi_tsfn_blocking);
+  napi_release_threadsafe_function(producer->tsfn, napi_tsfn_release);
+  return NULL;
+}
+
+// Runs on the main thread for every item. Only the last one calls into JS,
+// so what is measured is the cost of getting the items across.
+static void receive(napi_env env, napi_value js_callback, void *context,
+                    void *data) {
+  Producer *producer = context;
+  if (++producer->received != producer->count)
+    return;
+
+  napi_value callback, undefined, received;
+  napi_get_reference_value(env, producer->callback, &callback);
+  napi_get_undefined(env, &undefined);
+  napi_create_uint32(env, producer->received, &received);
+  napi_call_function(env, undefined, callback, 1, &received, NULL);
+}
+
+static void finalize(napi_env env, void *data, void *hint) {
+  Producer *producer = hint;
+  pthread_join(producer->thread, NULL);
+  napi_delete_reference(env, producer->callback);
+  free(producer);
+}
+
+// push(count, queueSize, callback) sends count items through a queue that
+// holds queueSize of them, or any number when it is 0, and calls
+// callback(count) once they all arrived.
+static napi_value push(napi_env env, napi_callback_info info) {
+  size_t argc = 3;
+  napi_value argv[3], name;
+  uint32_t queue_size;
+  napi_get_cb_info(env, info, &argc, argv, NULL, NULL);
+
+  Producer *producer = calloc(1, sizeof(Producer));
+  napi_get_value_uint32(env, argv[0], &producer->count);
+  napi_get_value_uint32(env, argv[1], &queue_size);
+  napi_create_reference(env, argv[2], 1, &producer->callback);
+  napi_create_string_utf8(env, "push", NAPI_AUTO_LENGTH, &name);
+
+  if (napi_create_threadsafe_function(env, argv[2], NULL, name, queue_size, 1,
+                                      producer, finalize, producer, receive,
+                                      &producer->tsfn) != napi_ok) {
+    napi_delete_reference(env, producer->callback);
+    free(producer);
+    napi_throw_error(env, NULL, "napi_create_threadsafe_function failed");
+    return NULL;
+  }
+
+  pthread_create(&producer->thread, NULL, produce, producer);
+  return NULL;
+}
+
+static napi_value init(napi_env env, napi_value exports) {
+  napi_property_descriptor properties[] = {
+      {"push", NULL, push, NULL, NULL, NULL, napi_default, NULL},
+  };
+  if (napi_define_properties(env, exports, 1, properties) != napi_ok)
+    return NULL;
+  return exports;
+}
+
+NAPI_MODULE(NODE_GYP_MODULE_NAME, init)
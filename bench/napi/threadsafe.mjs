@@ -0,0 +1,20 @@
+import { createRequire } from "node:module";
+
+const require = createRequire(import.meta.url);
+const { push } = require("./build/Release/napi_threadsafe_bench.node");
+
+// One background thread pushes a million items through a threadsafe
+// function, into an unbounded queue and into a small one that makes the
+// producer wait for the main thread.
+const count = 1_000_000;
+
+for (const queueSize of [0, 128]) {
+  const start = performance.now();
+  await new Promise(resolve => push(count, queueSize, resolve));
+  const elapsed = performance.now() - start;
+  console.log(
+    `${count} items, queue size ${queueSize || "unbounded"}: ${elapsed.toFixed(1)} ms (${Math.round(
+      count / (elapsed / 1000),
+    )} items/s)`,
+  );
+}
@@ -0,0 +1,34 @@
+import { bench, group, run } from "mitata";
+
+const jwtPayload = Buffer.from(
+  JSON.stringify({
+    sub: "1234567890",
+    name: "John Doe",
+    iat: 1516239022,
+    scope: "read:messages write:messages",
+  }),
+);
+const payload = Buffer.alloc(64 * 1024);
+for (let i = 0; i < payload.length; i++) payload[i] = (i * 7919) & 0xff;
+
+for (const [label, bytes] of [
+  ["JWT payload", jwtPayload],
+  ["64 KB", payload],
+]) {
+  const latin1 = bytes.toString("latin1");
+  const base64 = bytes.toString("base64");
+  const base64url = bytes.toString("base64url");
+
+  group(label, () => {
+    bench("btoa", () => btoa(latin1));
+    bench("atob", () => atob(base64));
+    bench("buf.toString('base64')", () => bytes.toString("base64"));
+    bench("buf.toString('base64url')", () => bytes.toString("base64url"));
+    bench("Buffer.from(str, 'base64')", () => Buffer.from(base64, "base64"));
+    bench("Buffer.from(str, 'base64url')", () =>
+      Buffer.from(base64url, "base64url"),
+    );
+  });
+}
+
+await run();
@@ -0,0 +1,28 @@
+import { bench, group, run } from "mitata";
+
+// Searches that scan the whole haystack: the boundary only appears at the end,
+// like the closing delimiter of a multipart/form-data body.
+const shortBoundary = "\r\n--X-BOUNDARY";
+const longBoundary = "\r\n------WebKitFormBoundary7MA4YWxkTrZu0gW--\r\n";
+const binaryNeedle = Buffer.from([0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a]);
+
+for (const size of [1, 10, 100]) {
+  const haystack = Buffer.alloc(size * 1024 * 1024);
+  for (let i = 0; i < haystack.length; i++) haystack[i] = 32 + ((i * 7919) % 95);
+  haystack.write(longBoundary, haystack.length - longBoundary.length, "latin1");
+  const utf16Needle = "Σ--X-BOUNDARY";
+
+  group(`${size} MB`, () => {
+    bench("indexOf(short string)", () => haystack.indexOf(shortBoundary));
+    bench("indexOf(long string)", () => haystack.indexOf(longBoundary));
+    bench("indexOf(Buffer)", () => haystack.indexOf(binaryNeedle));
+    bench("indexOf(byte)", () => haystack.indexOf(0));
+    bench("indexOf(utf16 string, utf16le)", () => haystack.indexOf(utf16Needle, 0, "utf16le"));
+    bench("lastIndexOf(short string)", () => haystack.lastIndexOf(shortBoundary));
+    bench("lastIndexOf(long string)", () => haystack.lastIndexOf(longBoundary, haystack.length - 1024));
+    bench("lastIndexOf(byte)", () => haystack.lastIndexOf(0));
+    bench("includes(long string)", () => haystack.includes(longBoundary));
+  });
+}
+
+await run();
@@ -0,0 +1,69 @@
+import { bench, group, run } from "mitata";
+
+// Decodes and encodes a stream of fixed-size records the way a binary protocol
+// parser does, through Buffer methods and through a DataView over the same
+// memory, plus Buffer allocation, which used to create a DataView per Buffer.
+const recordSize = 4 + 2 + 4 + 8;
+const count = 4096;
+const buf = Buffer.alloc(recordSize * count);
+const view = new DataView(buf.buffer, buf.byteOffset, buf.byteLength);
+for (let i = 0, offset = 0; i < count; i++, offset += recordSize) {
+  view.setInt32(offset, i, false);
+  view.setUint16(offset + 4, i & 0xffff, false);
+  view.setUint32(offset + 6, i * 31, true);
+  view.setFloat64(offset + 10, i / 3, true);
+}
+
+group(`read ${count} records`, () => {
+  bench("Buffer", () => {
+    let sum = 0;
+    for (let offset = 0; offset < buf.length; offset += recordSize) {
+      sum += buf.readInt32BE(offset);
+      sum += buf.readUInt16BE(offset + 4);
+      sum += buf.readUInt32LE(offset + 6);
+      sum += buf.readDoubleLE(offset + 10);
+    }
+    return sum;
+  });
+  bench("DataView", () => {
+    let sum = 0;
+    for (let offset = 0; offset < buf.length; offset += recordSize) {
+      sum += view.getInt32(offset, false);
+      sum += view.getUint16(offset + 4, false);
+      sum += view.getUint32(offset + 6, true);
+      sum += view.getFloat64(offset + 10, true);
+    }
+    return sum;
+  });
+});
+
+group(`write ${count} records`, () => {
+  bench("Buffer", () => {
+    for (let i = 0, offset = 0; i < count; i++) {
+      offset = buf.writeInt32BE(i, offset);
+      offset = buf.writeUInt16BE(i & 0xffff, offset);
+      offset = buf.writeUInt32LE(i * 31, offset);
+      offset = buf.writeDoubleLE(i / 3, offset);
+    }
+  });
+  bench("DataView", () => {
+    for (let i = 0, offset = 0; i < count; i++, offset += recordSize) {
+      view.setInt32(offset, i, false);
+      view.setUint16(offset + 4, i & 0xffff, false);
+      view.setUint32(offset + 6, i * 31, true);
+      view.setFloat64(offset + 10, i / 3, true);
+    }
+  });
+});
+
+group("single field", () => {
+  bench("buf.readUInt8(0)", () => buf.readUInt8(0));
+  bench("buf.readInt32LE(0)", () => buf.readInt32LE(0));
+  bench("buf.readBigUInt64BE(0)", () => buf.readBigUInt64BE(0));
+  bench("buf.writeInt16LE(1, 0)", () => buf.writeInt16LE(1, 0));
+  bench("view.getInt32(0, true)", () => view.getInt32(0, true));
+});
+
+bench("Buffer.allocUnsafe(64)", () => Buffer.allocUnsafe(64));
+
+await run();
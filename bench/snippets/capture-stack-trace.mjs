@@ -0,0 +1,28 @@
+import { bench, group, run } from "mitata";
+
+// Error.captureStackTrace on a hot path, as http-errors and depd do on every
+// request. Most of these errors never have their stack read.
+class HttpError extends Error {
+  constructor(status, message) {
+    super(message);
+    this.status = status;
+    Error.captureStackTrace(this, HttpError);
+  }
+}
+
+function deep(depth, fn) {
+  return depth === 0 ? fn() : deep(depth - 1, fn);
+}
+
+group("Error.captureStackTrace", () => {
+  bench("captureStackTrace({})", () => {
+    const object = {};
+    Error.captureStackTrace(object);
+    return object;
+  });
+  bench("new HttpError()", () => new HttpError(404, "Not Found"));
+  bench("new HttpError() 50 frames deep", () => deep(50, () => new HttpError(404, "Not Found")));
+  bench("new HttpError().stack", () => new HttpError(404, "Not Found").stack);
+});
+
+await run();
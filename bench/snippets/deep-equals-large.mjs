@@ -0,0 +1,50 @@
+import { bench, group, run } from "mitata";
+
+// Snapshot-sized inputs for Bun.deepEquals: large Sets and Maps, arrays of
+// same-shape records and a deep object graph.
+const count = 10000;
+
+function makeSet(mapper) {
+  const set = new Set();
+  for (let i = 0; i < count; i++) set.add(mapper(i));
+  return set;
+}
+
+function makeMap(mapper) {
+  const map = new Map();
+  for (let i = 0; i < count; i++) map.set("key" + i, mapper(i));
+  return map;
+}
+
+function makeRecords() {
+  return Array.from({ length: count }, (_, i) => ({ id: i, name: "user" + i, active: i % 2 === 0, score: i / 3 }));
+}
+
+function makeTree(depth) {
+  if (depth === 0) return { leaf: true, values: [1, 2, 3] };
+  return { depth, left: makeTree(depth - 1), right: makeTree(depth - 1), tags: ["a", "b"] };
+}
+
+const numbers = [makeSet(i => i), makeSet(i => count - 1 - i)];
+const strings = [makeSet(i => "value" + i), makeSet(i => "value" + (count - 1 - i))];
+const objects = [makeSet(i => ({ i })), makeSet(i => ({ i }))].map(set => new Set([...set].slice(0, 1000)));
+const maps = [makeMap(i => ({ value: i })), makeMap(i => ({ value: i }))];
+const records = [makeRecords(), makeRecords()];
+const trees = [makeTree(14), makeTree(14)];
+
+group(`Set of ${count}`, () => {
+  bench("numbers", () => Bun.deepEquals(numbers[0], numbers[1]));
+  bench("strings", () => Bun.deepEquals(strings[0], strings[1]));
+  bench("1000 objects", () => Bun.deepEquals(objects[0], objects[1]));
+});
+
+group(`Map of ${count}`, () => {
+  bench("string keys, object values", () => Bun.deepEquals(maps[0], maps[1]));
+});
+
+group("objects", () => {
+  bench(`${count} same-shape records`, () => Bun.deepEquals(records[0], records[1]));
+  bench("binary tree of depth 14", () => Bun.deepEquals(trees[0], trees[1]));
+});
+
+await run();
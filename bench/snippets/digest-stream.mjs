@@ -0,0 +1,69 @@
+import { bench, group, run } from "mitata";
+
+// Hashes a generated stream of DIGEST_STREAM_GB gigabytes (default 2), once
+// through crypto.DigestStream and once buffered into subtle.digest, and
+// reports throughput and peak RSS for both.
+const { subtle } = globalThis.crypto;
+const gigabytes = Number(process.env.DIGEST_STREAM_GB || 2);
+const chunk = new Uint8Array(1024 * 1024).fill(7);
+const chunkCount = Math.round(gigabytes * 1024);
+
+function generate(count) {
+  let remaining = count;
+  return new ReadableStream({
+    pull(controller) {
+      if (remaining-- === 0) return controller.close();
+      controller.enqueue(chunk);
+    },
+  });
+}
+
+let peakRSS = 0;
+const sampler = setInterval(() => {
+  peakRSS = Math.max(peakRSS, process.memoryUsage().rss);
+}, 10);
+
+async function measure(label, fn) {
+  Bun.gc(true);
+  peakRSS = process.memoryUsage().rss;
+  const start = performance.now();
+  await fn();
+  const seconds = (performance.now() - start) / 1000;
+  peakRSS = Math.max(peakRSS, process.memoryUsage().rss);
+  console.log(
+    `${label}: ${((chunkCount * chunk.length) / seconds / 1024 / 1024).toFixed(0)} MB/s, peak RSS ${(peakRSS / 1024 / 1024).toFixed(0)} MB`,
+  );
+}
+
+await measure(`DigestStream, ${gigabytes} GB`, async () => {
+  const hasher = new crypto.DigestStream("SHA-256");
+  await generate(chunkCount).pipeTo(hasher.writable);
+  hasher.digest();
+});
+
+await measure(`subtle.digest, ${gigabytes} GB buffered`, async () => {
+  const body = await new Response(generate(chunkCount)).arrayBuffer();
+  await subtle.digest("SHA-256", body);
+});
+
+clearInterval(sampler);
+
+group("64 MB in 1 MB chunks", () => {
+  bench("DigestStream.update()", () => {
+    const hasher = new crypto.DigestStream("SHA-256");
+    for (let i = 0; i < 64; i++) hasher.update(chunk);
+    return hasher.digest();
+  });
+  bench("DigestStream.writable", async () => {
+    const hasher = new crypto.DigestStream("SHA-256");
+    await generate(64).pipeTo(hasher.writable);
+    return hasher.digest();
+  });
+  bench("Bun.SHA256 update()", () => {
+    const hasher = new Bun.SHA256();
+    for (let i = 0; i < 64; i++) hasher.update(chunk);
+    return hasher.digest();
+  });
+});
+
+await run();
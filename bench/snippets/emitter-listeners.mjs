@@ -0,0 +1,20 @@
+import { EventEmitter } from "node:events";
+import { bench, group, run } from "mitata";
+
+// emit() cost by listener count, for stream-style "data" events.
+const chunk = new Uint8Array(16);
+let received = 0;
+
+for (const count of [0, 1, 2, 10]) {
+  const emitter = new EventEmitter();
+  for (let i = 0; i < count; i++) emitter.on("data", data => (received += data.length));
+
+  group(`${count} listener${count === 1 ? "" : "s"}`, () => {
+    bench("emit()", () => emitter.emit("data", chunk));
+    bench("emit() x 1000", () => {
+      for (let i = 0; i < 1000; i++) emitter.emit("data", chunk);
+    });
+  });
+}
+
+await run();
@@ -0,0 +1,24 @@
+import { bench, group, run } from "mitata";
+import { writeFileSync, mkdtempSync } from "node:fs";
+import { tmpdir } from "node:os";
+import { join } from "node:path";
+
+// A minified bundle is often a single line several megabytes long. Every
+// stack frame inside it needs the start and end of that line.
+const padding = "var a=1;".repeat((2.5 * 1024 * 1024) / 8);
+const path = join(mkdtempSync(join(tmpdir(), "error-stack-")), "bundle.mjs");
+writeFileSync(
+  path,
+  `${padding}export function middle(){const e={};Error.captureStackTrace(e);return e.stack}${padding}` +
+    `export function end(){const e={};Error.captureStackTrace(e);return e.stack}` +
+    `export function nested(n){return n?nested(n-1):end()}`,
+);
+const bundle = await import(path);
+
+group("stack traces in a 5 MB single-line bundle", () => {
+  bench("frame in the middle of the line", () => bundle.middle());
+  bench("frame at the end of the line", () => bundle.end());
+  bench("10 frames on the line", () => bundle.nested(9));
+});
+
+await run();
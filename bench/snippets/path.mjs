@@ -0,0 +1,36 @@
+import { bench, run } from "mitata";
+import path from "path";
+
+const { basename, dirname, extname, join, resolve } = path;
+
+const file = "/Users/jarred/Code/bun/src/bun.js/bindings/Path.cpp";
+
+bench(`path.basename`, () => {
+  return basename(file);
+});
+
+bench(`path.basename (suffix)`, () => {
+  return basename(file, ".cpp");
+});
+
+bench(`path.dirname`, () => {
+  return dirname(file);
+});
+
+bench(`path.extname`, () => {
+  return extname(file);
+});
+
+bench(`path.join (3 args)`, () => {
+  return join("/Users/jarred", "Code/bun", "src/bun.js");
+});
+
+bench(`path.join (relative segments)`, () => {
+  return join("/Users/jarred/Code/bun", "../bun/./src", "bun.js/bindings/../Path.cpp");
+});
+
+bench(`path.resolve`, () => {
+  return resolve("src", "bun.js", "bindings");
+});
+
+await run();
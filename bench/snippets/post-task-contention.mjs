@@ -0,0 +1,19 @@
+import { bench, group, run } from "mitata";
+
+// 16 native threads post tasks to this thread at the same time, so every post
+// contends on delivering to one context. Posting one task at a time is how
+// most completions arrive; the batched runs are what crypto workers do when
+// they finish a burst of small operations.
+const { postTasksFromThreads } = globalThis[Symbol.for("Bun.lazy")]("scriptExecutionContextForTesting");
+const threads = 16;
+
+for (const tasksPerThread of [1, 64, 1024]) {
+  group(`${threads} threads x ${tasksPerThread} tasks`, () => {
+    bench("postTaskTo", () => postTasksFromThreads(threads, tasksPerThread, 1));
+    if (tasksPerThread > 1) {
+      bench("postTasksTo, 64 per batch", () => postTasksFromThreads(threads, tasksPerThread, 64));
+    }
+  });
+}
+
+await run();
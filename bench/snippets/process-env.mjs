@@ -0,0 +1,29 @@
+import { bench, group, run } from "mitata";
+import { spawnSync } from "child_process";
+
+// Measures startup cost as a function of environment size. Each iteration
+// starts a new process which reads a single variable.
+const exe = process.argv.length > 2 ? process.argv[2] : process.execPath;
+
+function envWithCount(count) {
+  const env = { ...process.env };
+  for (let i = 0; i < count; i++) {
+    env[`BENCH_ENV_VAR_${i}`] = `value-${i}-${"x".repeat(32)}`;
+  }
+  return env;
+}
+
+for (const count of [100, 1_000, 5_000]) {
+  const env = envWithCount(count);
+  group(`${count} environment variables`, () => {
+    bench(`read one variable`, () => {
+      spawnSync(exe, ["-e", "process.env.HOME"], { env });
+    });
+
+    bench(`Object.keys(process.env)`, () => {
+      spawnSync(exe, ["-e", "Object.keys(process.env)"], { env });
+    });
+  });
+}
+
+await run();
@@ -0,0 +1,39 @@
+import { bench, group, run } from "mitata";
+
+// Body.json() of UTF-8 request bodies, against decoding them to a string and
+// calling JSON.parse.
+function makeBody(size, name) {
+  const records = [];
+  let length = 2;
+  for (let i = 0; length < size; i++) {
+    const record = { id: i, name: name + i, active: i % 2 === 0, tags: ["a", "b"] };
+    length += JSON.stringify(record).length + 1;
+    records.push(record);
+  }
+  return new TextEncoder().encode(JSON.stringify(records));
+}
+
+const sizes = { "1KB": 1024, "100KB": 100 * 1024, "10MB": 10 * 1024 * 1024 };
+const decoder = new TextDecoder();
+
+for (const [label, size] of Object.entries(sizes)) {
+  for (const [kind, name] of [
+    ["ascii", "user"],
+    ["latin1", "usér"],
+    ["non-latin1", "用户"],
+  ]) {
+    const body = makeBody(size, name);
+
+    group(`${label} ${kind}`, () => {
+      bench("new Response(bytes).json()", async () => {
+        await new Response(body).json();
+      });
+
+      bench("JSON.parse(new TextDecoder().decode(bytes))", () => {
+        JSON.parse(decoder.decode(body));
+      });
+    });
+  }
+}
+
+await run();
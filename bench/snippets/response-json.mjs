@@ -0,0 +1,34 @@
+import { bench, group, run } from "mitata";
+
+// Response.json() of API-sized payloads, against stringifying first and
+// handing the string to new Response().
+function makeRecords(count, name) {
+  return Array.from({ length: count }, (_, i) => ({
+    id: i,
+    name: name + i,
+    active: i % 2 === 0,
+    score: i / 3,
+    tags: ["a", "b", "c"],
+    created: new Date(i * 1000),
+  }));
+}
+
+const inputs = {
+  "ascii (1k records)": makeRecords(1000, "user"),
+  "ascii (50k records)": makeRecords(50_000, "user"),
+  "non-latin1 (50k records)": makeRecords(50_000, "用户"),
+};
+
+for (const [label, input] of Object.entries(inputs)) {
+  group(label, () => {
+    bench("Response.json(value).arrayBuffer()", async () => {
+      await Response.json(input).arrayBuffer();
+    });
+
+    bench("new Response(JSON.stringify(value)).arrayBuffer()", async () => {
+      await new Response(JSON.stringify(input)).arrayBuffer();
+    });
+  });
+}
+
+await run();
@@ -1,28 +1,24 @@
-import { bench, run } from "mitata";
+import { bench, group, run } from "mitata";
 import { StringDecoder } from "string_decoder";
 
-var short = Buffer.from("Hello World!");
-var shortUTF16 = Buffer.from("Hello World 💕💕💕");
-var long = Buffer.from("Hello World!".repeat(1024));
-var longUTF16 = Buffer.from("Hello World 💕💕💕".repeat(1024));
-bench(`${short.length} ascii`, () => {
-  var decoder = new StringDecoder();
-  decoder.write(short);
-});
+// Decodes a UTF-8 log stream in fixed-size chunks, so that most chunk
+// boundaries split a multi-byte character, as reading a file or socket does.
+const line = "2023-01-01T00:00:00Z INFO request ¢ handled € in 3ms 𤭢\n";
+const ascii = Buffer.from("2023-01-01T00:00:00Z INFO request handled in 3ms\n".repeat(20000));
+const mixed = Buffer.from(line.repeat(20000));
 
-bench(`${short.length} utf8`, () => {
-  var decoder = new StringDecoder();
-  decoder.write(shortUTF16);
-});
+function decode(buf, size) {
+  const decoder = new StringDecoder("utf8");
+  let length = 0;
+  for (let i = 0; i < buf.length; i += size) length += decoder.write(buf.subarray(i, i + size)).length;
+  return length + decoder.end().length;
+}
 
-bench(`${long.length} ascii`, () => {
-  var decoder = new StringDecoder();
-  decoder.write(long);
-});
-
-bench(`${longUTF16.length} utf8`, () => {
-  var decoder = new StringDecoder();
-  decoder.write(longUTF16);
-});
+for (const size of [61, 4096, 65536]) {
+  group(`${size} byte chunks`, () => {
+    bench("ascii", () => decode(ascii, size));
+    bench("multi-byte", () => decode(mixed, size));
+  });
+}
 
 await run();
@@ -0,0 +1,48 @@
+import { bench, group, run } from "mitata";
+
+// A token service mix: many ECDSA verifies and HMACs while slow PBKDF2
+// derivations are in flight. Run with BUN_CRYPTO_THREADS=1 to compare
+// against a single crypto thread.
+const { subtle } = globalThis.crypto;
+const encoder = new TextEncoder();
+const message = encoder.encode("header.payload");
+
+const ecdsa = await subtle.generateKey({ name: "ECDSA", namedCurve: "P-256" }, false, ["sign", "verify"]);
+const ecdsaParams = { name: "ECDSA", hash: "SHA-256" };
+const signature = await subtle.sign(ecdsaParams, ecdsa.privateKey, message);
+const hmac = await subtle.importKey("raw", encoder.encode("secret"), { name: "HMAC", hash: "SHA-256" }, false, [
+  "sign",
+]);
+const password = await subtle.importKey("raw", encoder.encode("hunter2"), "PBKDF2", false, ["deriveBits"]);
+const pbkdf2Params = { name: "PBKDF2", hash: "SHA-256", salt: encoder.encode("salt"), iterations: 100_000 };
+
+const times = (count, fn) => Promise.all(Array.from({ length: count }, fn));
+
+group("concurrent operations", () => {
+  bench("256 x ECDSA verify", () => times(256, () => subtle.verify(ecdsaParams, ecdsa.publicKey, signature, message)));
+  bench("256 x HMAC sign", () => times(256, () => subtle.sign("HMAC", hmac, message)));
+  bench("256 x SHA-256 digest", () => times(256, () => subtle.digest("SHA-256", message)));
+  bench("8 x PBKDF2 (100k iterations)", () => times(8, () => subtle.deriveBits(pbkdf2Params, password, 256)));
+});
+
+group("mixed workload", () => {
+  bench("256 x HMAC sign while 8 x PBKDF2 run", async () => {
+    const slow = times(8, () => subtle.deriveBits(pbkdf2Params, password, 256));
+    await times(256, () => subtle.sign("HMAC", hmac, message));
+    await slow;
+  });
+  bench("256 x ECDSA verify + 256 x digest + 4 x PBKDF2", () =>
+    Promise.all([
+      times(256, () => subtle.verify(ecdsaParams, ecdsa.publicKey, signature, message)),
+      times(256, () => subtle.digest("SHA-256", message)),
+      times(4, () => subtle.deriveBits(pbkdf2Params, password, 256)),
+    ]),
+  );
+});
+
+await run();
+
+if (globalThis.Bun) {
+  const { cryptoQueueStats } = await import("bun:jsc");
+  console.log(cryptoQueueStats());
+}
@@ -0,0 +1,34 @@
+import { bench, group, run } from "mitata";
+
+// Small messages are hashed on the calling thread. Run with
+// BUN_CRYPTO_INLINE_THRESHOLD=0 to send everything through the work queue.
+const { subtle } = globalThis.crypto;
+const encoder = new TextEncoder();
+const jwt = encoder.encode("eyJhbGciOiJIUzI1NiJ9.eyJzdWIiOiIxMjM0NTY3ODkwIiwibmFtZSI6IkpvaG4gRG9lIn0");
+const small = new Uint8Array(64).fill(1);
+const large = new Uint8Array(64 * 1024).fill(1);
+
+const hmac = await subtle.importKey("raw", encoder.encode("secret"), { name: "HMAC", hash: "SHA-256" }, false, [
+  "sign",
+  "verify",
+]);
+const signature = await subtle.sign("HMAC", hmac, jwt);
+
+group("latency", () => {
+  bench("HMAC SHA-256 sign (JWT)", () => subtle.sign("HMAC", hmac, jwt));
+  bench("HMAC SHA-256 verify (JWT)", () => subtle.verify("HMAC", hmac, signature, jwt));
+  bench("SHA-256 digest (64 B)", () => subtle.digest("SHA-256", small));
+  bench("SHA-1 digest (64 B)", () => subtle.digest("SHA-1", small));
+  bench("SHA-256 digest (64 KB)", () => subtle.digest("SHA-256", large));
+});
+
+group("throughput", () => {
+  bench("1000 x HMAC SHA-256 verify (JWT)", () =>
+    Promise.all(Array.from({ length: 1000 }, () => subtle.verify("HMAC", hmac, signature, jwt))),
+  );
+  bench("1000 x SHA-256 digest (64 B)", () =>
+    Promise.all(Array.from({ length: 1000 }, () => subtle.digest("SHA-256", small))),
+  );
+});
+
+await run();
@@ -0,0 +1,38 @@
+import { bench, group, run } from "mitata";
+
+// Router-style query strings: parse, then look up or rewrite many names.
+for (const count of [8, 64, 256]) {
+  const names = Array.from({ length: count }, (_, i) => `param${i}`);
+  const query = "?" + names.map((name, i) => `${name}=value%20${i}`).join("&");
+  const href = "https://example.com/search" + query;
+
+  group(`${count} params`, () => {
+    bench("new URLSearchParams()", () => new URLSearchParams(query));
+
+    bench("get() every name", () => {
+      const params = new URLSearchParams(query);
+      for (const name of names) params.get(name);
+    });
+
+    bench("has() missing name x100", () => {
+      const params = new URLSearchParams(query);
+      for (let i = 0; i < 100; i++) params.has("missing");
+    });
+
+    bench("url.searchParams.set() every name, then href", () => {
+      const url = new URL(href);
+      const params = url.searchParams;
+      for (const name of names) params.set(name, "changed");
+      return url.href;
+    });
+
+    bench("url.searchParams.append() x100, then href", () => {
+      const url = new URL(href);
+      const params = url.searchParams;
+      for (let i = 0; i < 100; i++) params.append("extra", "x");
+      return url.href;
+    });
+  });
+}
+
+await run();
@@ -0,0 +1,61 @@
+// Sends WS_RATE messages per second (default 100k) from a local Bun.serve
+// server for WS_SECONDS seconds to a WebSocket client, and reports how many
+// the client dispatched and the CPU time spent per message (server and client
+// share the process), for:
+//   - a bubbling addEventListener("message") listener,
+//   - the same plus a capturing listener (two-pass dispatch),
+//   - no message listener (events nobody sees).
+const rate = Number(process.env.WS_RATE || 100_000);
+const seconds = Number(process.env.WS_SECONDS || 3);
+const payload = "x".repeat(64);
+
+const server = Bun.serve({
+  port: 0,
+  fetch(req, server) {
+    if (server.upgrade(req)) return;
+    return new Response("upgrade failed", { status: 400 });
+  },
+  websocket: {
+    open(ws) {
+      const start = performance.now();
+      let sent = 0;
+      const timer = setInterval(() => {
+        const elapsed = (performance.now() - start) / 1000;
+        if (elapsed >= seconds) {
+          clearInterval(timer);
+          ws.close();
+          return;
+        }
+        // Catch up to the target rate, whatever the timer resolution is.
+        for (const due = Math.floor(elapsed * rate); sent < due; sent++) ws.send(payload);
+      }, 1);
+    },
+    message() {},
+  },
+});
+
+function measure(label, attach) {
+  return new Promise(resolve => {
+    const socket = new WebSocket(`ws://localhost:${server.port}`);
+    let received = 0;
+    const cpuStart = process.cpuUsage();
+    attach(socket, () => received++);
+    socket.addEventListener("close", () => {
+      const cpu = process.cpuUsage(cpuStart);
+      const total = received || rate * seconds;
+      console.log(
+        `${label}: ${(total / seconds).toFixed(0)} msg/s, ${(((cpu.user + cpu.system) * 1000) / total).toFixed(0)} ns CPU per message`,
+      );
+      resolve();
+    });
+  });
+}
+
+await measure("addEventListener", (socket, count) => socket.addEventListener("message", count));
+await measure("addEventListener + capture", (socket, count) => {
+  socket.addEventListener("message", count);
+  socket.addEventListener("message", () => {}, { capture: true });
+});
+await measure("no message listener", () => {});
+
+server.stop(true);
@@ -24,4 +24,21 @@ const db = Database.open("./src/northwind.sqlite");
   });
 }
 
+{
+  // 1M rows of int, text, float, text
+  db.exec(
+    `CREATE TEMP TABLE Million AS
+       WITH RECURSIVE n(i) AS (SELECT 1 UNION ALL SELECT i + 1 FROM n WHERE i < 1000000)
+       SELECT i AS id, 'name ' || i AS name, i * 0.5 AS price, 'category ' || (i % 10) AS category FROM n`,
+  );
+  const sql = db.prepare(`SELECT * FROM Million`);
+  bench("SELECT * FROM Million (1M rows)", () => {
+    sql.all();
+  });
+
+  bench("SELECT * FROM Million (1M rows, arrays)", () => {
+    sql.values();
+  });
+}
+
 await run();
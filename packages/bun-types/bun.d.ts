@@ -384,6 +384,11 @@ declare module "bun" {
     }): void;
 
     write(chunk: string | ArrayBufferView | ArrayBuffer): number;
+    /**
+     * Write `JSON.stringify(value)` as UTF-8 without creating the string.
+     * The output is written in chunks while `value` is serialized.
+     */
+    writeJSON(value: any): number;
     /**
      * Flush the internal buffer
      *
@@ -409,6 +414,11 @@ declare module "bun" {
      * If the file descriptor is not writable yet, the data is buffered.
      */
     write(chunk: string | ArrayBufferView | ArrayBuffer): number;
+    /**
+     * Write `JSON.stringify(value)` as UTF-8 without creating the string.
+     * Each chunk is written to the file as soon as it is serialized.
+     */
+    writeJSON(value: any): number;
     /**
      * Flush the internal buffer, committing the data to disk or the pipe.
      */
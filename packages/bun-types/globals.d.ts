@@ -950,6 +950,42 @@ interface Crypto {
    * ```
    */
   randomUUID(): string;
+
+  /**
+   * Hash data incrementally, without holding all of it in memory.
+   *
+   * @example
+   *
+   * ```js
+   * const hasher = new crypto.DigestStream("SHA-256");
+   * await Bun.file("upload.bin").stream().pipeTo(hasher.writable);
+   * hasher.digest(); // ArrayBuffer
+   * ```
+   */
+  readonly DigestStream: typeof DigestStream;
+}
+
+declare class DigestStream {
+  /**
+   * @param algorithm `"SHA-1"`, `"SHA-224"`, `"SHA-256"`, `"SHA-384"` or `"SHA-512"`
+   */
+  constructor(algorithm: AlgorithmIdentifier);
+  /**
+   * Hash the next chunk. Strings are hashed as UTF-8.
+   */
+  update(data: string | BufferSource): void;
+  /**
+   * Same as `update`, so a `DigestStream` can be used as an underlying sink.
+   */
+  write(data: string | BufferSource): void;
+  /**
+   * Finish hashing. Calling `update` or `digest` afterwards throws.
+   */
+  digest(): ArrayBuffer;
+  /**
+   * A `WritableStream` that hashes every chunk written to it.
+   */
+  readonly writable: WritableStream<string | BufferSource>;
 }
 
 declare var crypto: Crypto;
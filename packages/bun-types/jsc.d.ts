@@ -23,6 +23,38 @@ declare module "bun:jsc" {
     peakCommit: number;
     pageFaults: number;
   };
+  /**
+   * Counters for the thread pool that runs `crypto.subtle` operations.
+   *
+   * Set `BUN_CRYPTO_THREADS` to change the number of threads.
+   */
+  export function cryptoQueueStats(): {
+    threads: number;
+    operations: Record<
+      "encrypt" | "decrypt" | "sign" | "verify" | "digest" | "deriveBits",
+      {
+        pending: number;
+        running: number;
+        peakRunning: number;
+        completed: number;
+        averageWaitMs: number;
+        maxWaitMs: number;
+        averageRunMs: number;
+      }
+    >;
+  };
+  /**
+   * Counters for N-API thread-safe functions
+   * (`napi_create_threadsafe_function`) in this process.
+   *
+   * `queued` is the number of calls waiting to run on the JavaScript thread,
+   * and `queueHighWater` the most that were ever waiting on one function.
+   */
+  export function napiThreadsafeFunctionStats(): {
+    functions: number;
+    queued: number;
+    queueHighWater: number;
+  };
   export function getRandomSeed(): number;
   export function setRandomSeed(value: number): void;
   export function isRope(input: string): boolean;
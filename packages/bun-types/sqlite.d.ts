@@ -82,6 +82,13 @@ declare module "bun:sqlite" {
              * Equivalent to {@link constants.SQLITE_OPEN_READWRITE}
              */
             readwrite?: boolean;
+            /**
+             * Memory-map the database file, sized to the file when it is
+             * opened (twice that unless `readonly`).
+             *
+             * Equivalent to `PRAGMA mmap_size`
+             */
+            mmap?: boolean;
           },
     );
 
@@ -113,6 +120,13 @@ declare module "bun:sqlite" {
              * Equivalent to {@link constants.SQLITE_OPEN_READWRITE}
              */
             readwrite?: boolean;
+            /**
+             * Memory-map the database file, sized to the file when it is
+             * opened (twice that unless `readonly`).
+             *
+             * Equivalent to `PRAGMA mmap_size`
+             */
+            mmap?: boolean;
           },
     ): Database;
 
@@ -0,0 +1,431 @@
+#include "root.h"
+#include "BufferSearch.h"
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define BUN_BUFFER_SEARCH_X86 1
+#include <immintrin.h>
+#else
+#define BUN_BUFFER_SEARCH_X86 0
+#endif
+
+namespace Bun {
+
+static constexpr size_t shortNeedleLength = 32;
+
+// Returned by the filters when they hand the rest of the search to Two-Way.
+static constexpr int64_t gaveUp = -2;
+
+// A candidate that passes the first/last byte filter but fails memcmp costs
+// up to needleLength bytes of comparisons. Long needles give up on the filter
+// once that exceeds a few times the bytes scanned so far, which keeps the
+// whole search linear.
+class VerifyBudget {
+public:
+    explicit VerifyBudget(size_t needleLength)
+        : m_cost(needleLength > shortNeedleLength ? needleLength : 0)
+    {
+    }
+
+    ALWAYS_INLINE bool exhausted(size_t scanned)
+    {
+        m_spent += m_cost;
+        return m_spent > 4 * scanned + 4096;
+    }
+
+private:
+    size_t m_cost;
+    size_t m_spent { 0 };
+};
+
+// The first and last bytes already matched.
+static ALWAYS_INLINE bool matchesAt(const uint8_t* candidate, const uint8_t* needle, size_t needleLength)
+{
+    return needleLength <= 2 || memcmp(candidate + 1, needle + 1, needleLength - 2) == 0;
+}
+
+static int64_t indexOfFilteredScalar(const uint8_t* haystack, size_t haystackLength, const uint8_t* needle, size_t needleLength, size_t from)
+{
+    const uint8_t* end = haystack + haystackLength - needleLength + 1;
+    const uint8_t* it = haystack + from;
+    const uint8_t last = needle[needleLength - 1];
+
+    while (it < end) {
+        it = static_cast<const uint8_t*>(memchr(it, needle[0], end - it));
+        if (!it)
+            return -1;
+        if (it[needleLength - 1] == last && matchesAt(it, needle, needleLength))
+            return it - haystack;
+        it++;
+    }
+
+    return -1;
+}
+
+// Checks candidate positions from `from` down to 0.
+static int64_t lastIndexOfFilteredScalar(const uint8_t* haystack, const uint8_t* needle, size_t needleLength, size_t from)
+{
+    const uint8_t first = needle[0];
+    const uint8_t last = needle[needleLength - 1];
+
+    for (size_t i = from + 1; i-- > 0;) {
+        if (haystack[i] == first && haystack[i + needleLength - 1] == last && matchesAt(haystack + i, needle, needleLength))
+            return i;
+    }
+
+    return -1;
+}
+
+#if BUN_BUFFER_SEARCH_X86
+
+static bool hasAVX2()
+{
+#if defined(__AVX2__)
+    return true;
+#else
+    return __builtin_cpu_supports("avx2");
+#endif
+}
+
+// Wojciech Muła, "SIMD-friendly algorithms for substring searching": compare
+// the first needle byte against 16 or 32 candidate positions at once, and the
+// last needle byte against the same positions shifted by the needle length.
+// Only positions where both match are checked with memcmp.
+
+static int64_t indexOfFilteredSSE2(const uint8_t* haystack, size_t haystackLength, const uint8_t* needle, size_t needleLength, size_t& resumeAt)
+{
+    VerifyBudget budget(needleLength);
+    const __m128i first = _mm_set1_epi8(needle[0]);
+    const __m128i last = _mm_set1_epi8(needle[needleLength - 1]);
+    size_t i = 0;
+
+    for (; i + needleLength + 15 <= haystackLength; i += 16) {
+        __m128i blockFirst = _mm_loadu_si128(reinterpret_cast<const __m128i*>(haystack + i));
+        __m128i blockLast = _mm_loadu_si128(reinterpret_cast<const __m128i*>(haystack + i + needleLength - 1));
+        uint32_t mask = _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(first, blockFirst), _mm_cmpeq_epi8(last, blockLast)));
+        while (mask) {
+            unsigned bit = __builtin_ctz(mask);
+            if (matchesAt(haystack + i + bit, needle, needleLength))
+                return i + bit;
+            if (budget.exhausted(i)) {
+                resumeAt = i;
+                return gaveUp;
+            }
+            mask &= mask - 1;
+        }
+    }
+
+    return indexOfFilteredScalar(haystack, haystackLength, needle, needleLength, i);
+}
+
+static int64_t lastIndexOfFilteredSSE2(const uint8_t* haystack, size_t haystackLength, const uint8_t* needle, size_t needleLength, size_t& resumeAt)
+{
+    VerifyBudget budget(needleLength);
+    const __m128i first = _mm_set1_epi8(needle[0]);
+    const __m128i last = _mm_set1_epi8(needle[needleLength - 1]);
+    // The highest candidate position not yet checked
+    size_t from = haystackLength - needleLength;
+
+    while (from >= 15) {
+        size_t base = from - 15;
+        __m128i blockFirst = _mm_loadu_si128(reinterpret_cast<const __m128i*>(haystack + base));
+        __m128i blockLast = _mm_loadu_si128(reinterpret_cast<const __m128i*>(haystack + base + needleLength - 1));
+        uint32_t mask = _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(first, blockFirst), _mm_cmpeq_epi8(last, blockLast)));
+        while (mask) {
+            unsigned bit = 31 - __builtin_clz(mask);
+            if (matchesAt(haystack + base + bit, needle, needleLength))
+                return base + bit;
+            if (budget.exhausted(haystackLength - from)) {
+                resumeAt = from;
+                return gaveUp;
+            }
+            mask &= ~(1u << bit);
+        }
+
+        if (base == 0)
+            return -1;
+        from = base - 1;
+    }
+
+    return lastIndexOfFilteredScalar(haystack, needle, needleLength, from);
+}
+
+__attribute__((target("avx2"))) static int64_t indexOfFilteredAVX2(const uint8_t* haystack, size_t haystackLength, const uint8_t* needle, size_t needleLength, size_t& resumeAt)
+{
+    VerifyBudget budget(needleLength);
+    const __m256i first = _mm256_set1_epi8(needle[0]);
+    const __m256i last = _mm256_set1_epi8(needle[needleLength - 1]);
+    size_t i = 0;
+
+    for (; i + needleLength + 31 <= haystackLength; i += 32) {
+        __m256i blockFirst = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(haystack + i));
+        __m256i blockLast = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(haystack + i + needleLength - 1));
+        uint32_t mask = _mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(first, blockFirst), _mm256_cmpeq_epi8(last, blockLast)));
+        while (mask) {
+            unsigned bit = __builtin_ctz(mask);
+            if (matchesAt(haystack + i + bit, needle, needleLength))
+                return i + bit;
+            if (budget.exhausted(i)) {
+                resumeAt = i;
+                return gaveUp;
+            }
+            mask &= mask - 1;
+        }
+    }
+
+    return indexOfFilteredScalar(haystack, haystackLength, needle, needleLength, i);
+}
+
+__attribute__((target("avx2"))) static int64_t lastIndexOfFilteredAVX2(const uint8_t* haystack, size_t haystackLength, const uint8_t* needle, size_t needleLength, size_t& resumeAt)
+{
+    VerifyBudget budget(needleLength);
+    const __m256i first = _mm256_set1_epi8(needle[0]);
+    const __m256i last = _mm256_set1_epi8(needle[needleLength - 1]);
+    size_t from = haystackLength - needleLength;
+
+    while (from >= 31) {
+        size_t base = from - 31;
+        __m256i blockFirst = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(haystack + base));
+        __m256i blockLast = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(haystack + base + needleLength - 1));
+        uint32_t mask = _mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(first, blockFirst), _mm256_cmpeq_epi8(last, blockLast)));
+        while (mask) {
+            unsigned bit = 31 - __builtin_clz(mask);
+            if (matchesAt(haystack + base + bit, needle, needleLength))
+                return base + bit;
+            if (budget.exhausted(haystackLength - from)) {
+                resumeAt = from;
+                return gaveUp;
+            }
+            mask &= ~(1u << bit);
+        }
+
+        if (base == 0)
+            return -1;
+        from = base - 1;
+    }
+
+    return lastIndexOfFilteredScalar(haystack, needle, needleLength, from);
+}
+
+#endif
+
+// Reads the haystack and needle back to front when searching backwards, so
+// that the same Two-Way implementation finds the last match.
+template<bool reverse>
+class ByteView {
+public:
+    ByteView(const uint8_t* data, size_t length)
+        : m_data(data)
+        , m_length(length)
+    {
+    }
+
+    ALWAYS_INLINE uint8_t operator[](size_t index) const
+    {
+        return reverse ? m_data[m_length - 1 - index] : m_data[index];
+    }
+
+private:
+    const uint8_t* m_data;
+    size_t m_length;
+};
+
+// Crochemore and Perrin's critical factorization, computed from the larger
+// of the maximal suffixes for both orderings of the alphabet.
+template<bool reverse>
+static size_t criticalFactorization(const ByteView<reverse>& needle, size_t needleLength, size_t& period)
+{
+    size_t maxSuffix = SIZE_MAX;
+    size_t j = 0;
+    size_t k = 1;
+    size_t p = 1;
+    while (j + k < needleLength) {
+        uint8_t a = needle[j + k];
+        uint8_t b = needle[maxSuffix + k];
+        if (a < b) {
+            j += k;
+            k = 1;
+            p = j - maxSuffix;
+        } else if (a == b) {
+            if (k != p)
+                k++;
+            else {
+                j += p;
+                k = 1;
+            }
+        } else {
+            maxSuffix = j++;
+            k = p = 1;
+        }
+    }
+    period = p;
+
+    size_t maxSuffixReverse = SIZE_MAX;
+    j = 0;
+    k = 1;
+    p = 1;
+    while (j + k < needleLength) {
+        uint8_t a = needle[j + k];
+        uint8_t b = needle[maxSuffixReverse + k];
+        if (b < a) {
+            j += k;
+            k = 1;
+            p = j - maxSuffixReverse;
+        } else if (a == b) {
+            if (k != p)
+                k++;
+            else {
+                j += p;
+                k = 1;
+            }
+        } else {
+            maxSuffixReverse = j++;
+            k = p = 1;
+        }
+    }
+
+    if (maxSuffixReverse + 1 < maxSuffix + 1)
+        return maxSuffix + 1;
+
+    period = p;
+    return maxSuffixReverse + 1;
+}
+
+template<bool reverse>
+static int64_t twoWaySearch(const uint8_t* haystackData, size_t haystackLength, const uint8_t* needleData, size_t needleLength)
+{
+    ByteView<reverse> haystack(haystackData, haystackLength);
+    ByteView<reverse> needle(needleData, needleLength);
+    auto result = [&](size_t position) -> int64_t {
+        return reverse ? haystackLength - position - needleLength : position;
+    };
+
+    size_t period;
+    size_t suffix = criticalFactorization(needle, needleLength, period);
+
+    // How far the window can move when its last byte does not match
+    size_t shiftTable[256];
+    for (size_t i = 0; i < 256; i++)
+        shiftTable[i] = needleLength;
+    for (size_t i = 0; i < needleLength; i++)
+        shiftTable[needle[i]] = needleLength - i - 1;
+
+    bool isPeriodic = true;
+    for (size_t i = 0; i < suffix; i++) {
+        if (needle[i] != needle[i + period]) {
+            isPeriodic = false;
+            break;
+        }
+    }
+
+    size_t j = 0;
+    if (isPeriodic) {
+        // The prefix before the critical point repeats, so remember how much
+        // of it matched to avoid comparing it again after a shift by the period.
+        size_t memory = 0;
+        while (j + needleLength <= haystackLength) {
+            size_t shift = shiftTable[haystack[j + needleLength - 1]];
+            if (shift > 0) {
+                if (memory && shift < period)
+                    shift = needleLength - period;
+                memory = 0;
+                j += shift;
+                continue;
+            }
+
+            size_t i = std::max(suffix, memory);
+            while (i < needleLength - 1 && needle[i] == haystack[i + j])
+                i++;
+            if (needleLength - 1 <= i) {
+                i = suffix - 1;
+                while (memory < i + 1 && needle[i] == haystack[i + j])
+                    i--;
+                if (i + 1 < memory + 1)
+                    return result(j);
+                j += period;
+                memory = needleLength - period;
+            } else {
+                j += i - suffix + 1;
+                memory = 0;
+            }
+        }
+    } else {
+        period = std::max(suffix, needleLength - suffix) + 1;
+        while (j + needleLength <= haystackLength) {
+            size_t shift = shiftTable[haystack[j + needleLength - 1]];
+            if (shift > 0) {
+                j += shift;
+                continue;
+            }
+
+            size_t i = suffix;
+            while (i < needleLength - 1 && needle[i] == haystack[i + j])
+                i++;
+            if (needleLength - 1 <= i) {
+                i = suffix - 1;
+                while (i != SIZE_MAX && needle[i] == haystack[i + j])
+                    i--;
+                if (i == SIZE_MAX)
+                    return result(j);
+                j += period;
+            } else {
+                j += i - suffix + 1;
+            }
+        }
+    }
+
+    return -1;
+}
+
+int64_t indexOfBytes(const uint8_t* haystack, size_t haystackLength, const uint8_t* needle, size_t needleLength)
+{
+    ASSERT(needleLength > 0);
+    if (haystackLength < needleLength)
+        return -1;
+
+    if (needleLength == 1) {
+        auto* it = static_cast<const uint8_t*>(memchr(haystack, needle[0], haystackLength));
+        return it ? it - haystack : -1;
+    }
+
+#if BUN_BUFFER_SEARCH_X86
+    size_t resumeAt = 0;
+    int64_t result = hasAVX2()
+        ? indexOfFilteredAVX2(haystack, haystackLength, needle, needleLength, resumeAt)
+        : indexOfFilteredSSE2(haystack, haystackLength, needle, needleLength, resumeAt);
+    if (result != gaveUp)
+        return result;
+
+    result = twoWaySearch<false>(haystack + resumeAt, haystackLength - resumeAt, needle, needleLength);
+    return result < 0 ? result : result + resumeAt;
+#else
+    if (needleLength <= shortNeedleLength)
+        return indexOfFilteredScalar(haystack, haystackLength, needle, needleLength, 0);
+
+    return twoWaySearch<false>(haystack, haystackLength, needle, needleLength);
+#endif
+}
+
+int64_t lastIndexOfBytes(const uint8_t* haystack, size_t haystackLength, const uint8_t* needle, size_t needleLength)
+{
+    ASSERT(needleLength > 0);
+    if (haystackLength < needleLength)
+        return -1;
+
+#if BUN_BUFFER_SEARCH_X86
+    size_t resumeAt = 0;
+    int64_t result = hasAVX2()
+        ? lastIndexOfFilteredAVX2(haystack, haystackLength, needle, needleLength, resumeAt)
+        : lastIndexOfFilteredSSE2(haystack, haystackLength, needle, needleLength, resumeAt);
+    if (result != gaveUp)
+        return result;
+
+    return twoWaySearch<true>(haystack, resumeAt + needleLength, needle, needleLength);
+#else
+    if (needleLength <= shortNeedleLength)
+        return lastIndexOfFilteredScalar(haystack, needle, needleLength, haystackLength - needleLength);
+
+    return twoWaySearch<true>(haystack, haystackLength, needle, needleLength);
+#endif
+}
+
+}
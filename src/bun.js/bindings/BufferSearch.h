@@ -0,0 +1,18 @@
+#pragma once
+
+#include "root.h"
+
+namespace Bun {
+
+// Byte string search used by Buffer.prototype.indexOf(), lastIndexOf() and
+// includes(). Short needles are found by comparing the first and last byte
+// of every candidate position with SIMD, long needles use the Two-Way
+// algorithm with a bad character shift, which stays linear in the worst case.
+// lastIndexOfBytes() searches backwards from the end of the haystack instead
+// of scanning the whole haystack forwards.
+//
+// Both return -1 when there is no match. needleLength must not be 0.
+int64_t indexOfBytes(const uint8_t* haystack, size_t haystackLength, const uint8_t* needle, size_t needleLength);
+int64_t lastIndexOfBytes(const uint8_t* haystack, size_t haystackLength, const uint8_t* needle, size_t needleLength);
+
+}
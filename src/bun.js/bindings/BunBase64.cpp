@@ -0,0 +1,459 @@
+#include "root.h"
+#include "BunBase64.h"
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define BUN_BASE64_X86 1
+#include <immintrin.h>
+#else
+#define BUN_BASE64_X86 0
+#endif
+
+// The vector kernels follow Wojciech Muła and Daniel Lemire,
+// "Faster Base64 Encoding and Decoding using AVX2 Instructions" (2018).
+// Each one stops at the first block it cannot handle and leaves the rest of
+// the input to the scalar loop, which is also the only path on non-x86 CPUs.
+
+namespace Bun {
+namespace Base64 {
+
+static constexpr char standardEncodeTable[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+static constexpr char urlEncodeTable[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+
+static constexpr uint8_t invalidValue = 0xFF;
+
+struct DecodeTable {
+    uint8_t values[256];
+};
+
+static constexpr DecodeTable makeDecodeTable(bool standard, bool url)
+{
+    DecodeTable table {};
+    for (unsigned i = 0; i < 256; i++)
+        table.values[i] = invalidValue;
+    for (unsigned i = 0; i < 64; i++) {
+        if (standard)
+            table.values[static_cast<uint8_t>(standardEncodeTable[i])] = i;
+        if (url)
+            table.values[static_cast<uint8_t>(urlEncodeTable[i])] = i;
+    }
+    return table;
+}
+
+// atob() only accepts the standard alphabet, Buffer accepts either one.
+static constexpr DecodeTable forgivingDecodeTable = makeDecodeTable(true, false);
+static constexpr DecodeTable lenientDecodeTable = makeDecodeTable(true, true);
+
+template<typename CharType>
+static ALWAYS_INLINE uint8_t decodeCharacter(const DecodeTable& table, CharType character)
+{
+    if constexpr (sizeof(CharType) > 1) {
+        if (character > 0xFF)
+            return invalidValue;
+    }
+
+    return table.values[static_cast<uint8_t>(character)];
+}
+
+template<typename CharType>
+static ALWAYS_INLINE bool isForgivingWhitespace(CharType character)
+{
+    // Also skips vertical tab, which WTF::base64Decode tolerated.
+    return character == ' ' || character == '\t' || character == '\n' || character == '\f' || character == '\r' || character == '\v';
+}
+
+static size_t encodeScalar(LChar* destination, const uint8_t* source, size_t length, Alphabet alphabet)
+{
+    const char* table = alphabet == Alphabet::URL ? urlEncodeTable : standardEncodeTable;
+    LChar* out = destination;
+    size_t i = 0;
+
+    for (; i + 3 <= length; i += 3) {
+        uint32_t triple = (source[i] << 16) | (source[i + 1] << 8) | source[i + 2];
+        out[0] = table[(triple >> 18) & 0x3F];
+        out[1] = table[(triple >> 12) & 0x3F];
+        out[2] = table[(triple >> 6) & 0x3F];
+        out[3] = table[triple & 0x3F];
+        out += 4;
+    }
+
+    switch (length - i) {
+    case 1: {
+        uint32_t triple = source[i] << 16;
+        *out++ = table[(triple >> 18) & 0x3F];
+        *out++ = table[(triple >> 12) & 0x3F];
+        if (alphabet == Alphabet::Standard) {
+            *out++ = '=';
+            *out++ = '=';
+        }
+        break;
+    }
+    case 2: {
+        uint32_t triple = (source[i] << 16) | (source[i + 1] << 8);
+        *out++ = table[(triple >> 18) & 0x3F];
+        *out++ = table[(triple >> 12) & 0x3F];
+        *out++ = table[(triple >> 6) & 0x3F];
+        if (alphabet == Alphabet::Standard)
+            *out++ = '=';
+        break;
+    }
+    default:
+        break;
+    }
+
+    return out - destination;
+}
+
+#if BUN_BASE64_X86
+
+static bool hasAVX2()
+{
+#if defined(__AVX2__)
+    return true;
+#else
+    return __builtin_cpu_supports("avx2");
+#endif
+}
+
+static bool hasSSE41()
+{
+#if defined(__SSE4_1__)
+    return true;
+#else
+    return __builtin_cpu_supports("sse4.1");
+#endif
+}
+
+// Maps 6-bit values to ASCII. Values are first reduced to one of 14 ranges
+// and the range selects the offset to add.
+static constexpr int8_t standardEncodeOffsets[16] = { 'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0 };
+static constexpr int8_t urlEncodeOffsets[16] = { 'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '-' - 62, '_' - 63, 'A', 0, 0 };
+
+// A character is valid when the bits selected by its low and high nibbles
+// do not intersect. The offset table is indexed by the high nibble, or by
+// 8 + high nibble for the 63rd character so that it can get its own offset.
+struct VectorDecodeTables {
+    int8_t lowNibbleClasses[16];
+    int8_t highNibbleClasses[16];
+    int8_t offsets[16];
+    uint8_t character63;
+};
+
+static constexpr VectorDecodeTables standardVectorTables = {
+    { 0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x3A, 0x3B, 0x3B, 0x3B, 0x3A },
+    { 0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x20, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10 },
+    { 0, 0, 19, 4, -65, -65, -71, -71, 0, 0, 16, 0, 0, 0, 0, 0 },
+    '/',
+};
+
+static constexpr VectorDecodeTables urlVectorTables = {
+    { 0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x3B, 0x3B, 0x3A, 0x3B, 0x33 },
+    { 0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x20, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10 },
+    { 0, 0, 17, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, -32, 0, 0 },
+    '_',
+};
+
+__attribute__((target("sse4.1"))) static ALWAYS_INLINE __m128i encodeSplitSSE(__m128i input)
+{
+    // 12 bytes -> four 24-bit groups -> sixteen 6-bit values, one per byte
+    input = _mm_shuffle_epi8(input, _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10));
+    __m128i t0 = _mm_and_si128(input, _mm_set1_epi32(0x0fc0fc00));
+    __m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+    __m128i t2 = _mm_and_si128(input, _mm_set1_epi32(0x003f03f0));
+    __m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+    return _mm_or_si128(t1, t3);
+}
+
+__attribute__((target("sse4.1"))) static ALWAYS_INLINE __m128i encodeTranslateSSE(__m128i indices, __m128i offsets)
+{
+    __m128i ranges = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+    __m128i isLetterUppercase = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+    ranges = _mm_or_si128(ranges, _mm_and_si128(isLetterUppercase, _mm_set1_epi8(13)));
+    return _mm_add_epi8(_mm_shuffle_epi8(offsets, ranges), indices);
+}
+
+// Returns the number of input bytes consumed, always a multiple of 12.
+__attribute__((target("sse4.1"))) static size_t encodeSSE(LChar* destination, const uint8_t* source, size_t length, Alphabet alphabet)
+{
+    const __m128i offsets = _mm_loadu_si128(reinterpret_cast<const __m128i*>(alphabet == Alphabet::URL ? urlEncodeOffsets : standardEncodeOffsets));
+    size_t i = 0;
+    LChar* out = destination;
+
+    // Each load reads 16 bytes but only uses 12
+    while (length - i >= 16) {
+        __m128i input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out), encodeTranslateSSE(encodeSplitSSE(input), offsets));
+        i += 12;
+        out += 16;
+    }
+
+    return i;
+}
+
+// Returns the number of input bytes consumed, always a multiple of 24.
+__attribute__((target("avx2"))) static size_t encodeAVX2(LChar* destination, const uint8_t* source, size_t length, Alphabet alphabet)
+{
+    const __m256i offsets = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(alphabet == Alphabet::URL ? urlEncodeOffsets : standardEncodeOffsets)));
+    const __m256i shuffle = _mm256_setr_epi8(
+        1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10,
+        1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+    size_t i = 0;
+    LChar* out = destination;
+
+    // The second lane starts 12 bytes in and reads 16 bytes
+    while (length - i >= 28) {
+        __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i));
+        __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i + 12));
+        __m256i input = _mm256_inserti128_si256(_mm256_castsi128_si256(low), high, 1);
+
+        input = _mm256_shuffle_epi8(input, shuffle);
+        __m256i t0 = _mm256_and_si256(input, _mm256_set1_epi32(0x0fc0fc00));
+        __m256i t1 = _mm256_mulhi_epu16(t0, _mm256_set1_epi32(0x04000040));
+        __m256i t2 = _mm256_and_si256(input, _mm256_set1_epi32(0x003f03f0));
+        __m256i t3 = _mm256_mullo_epi16(t2, _mm256_set1_epi32(0x01000010));
+        __m256i indices = _mm256_or_si256(t1, t3);
+
+        __m256i ranges = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+        __m256i isLetterUppercase = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices);
+        ranges = _mm256_or_si256(ranges, _mm256_and_si256(isLetterUppercase, _mm256_set1_epi8(13)));
+        __m256i result = _mm256_add_epi8(_mm256_shuffle_epi8(offsets, ranges), indices);
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), result);
+        i += 24;
+        out += 32;
+    }
+
+    return i;
+}
+
+template<typename CharType>
+__attribute__((target("sse4.1"))) static ALWAYS_INLINE __m128i loadCharactersSSE(const CharType* source)
+{
+    if constexpr (sizeof(CharType) == 1)
+        return _mm_loadu_si128(reinterpret_cast<const __m128i*>(source));
+
+    // Anything above 0xFF saturates to 0xFF, which is never valid
+    __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source));
+    __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + 8));
+    return _mm_packus_epi16(low, high);
+}
+
+// Decodes 16 characters at a time into 12 bytes. Stops at the first block
+// containing padding, whitespace or anything outside the alphabet.
+template<typename CharType>
+__attribute__((target("sse4.1"))) static void decodeSSE(uint8_t*& out, const uint8_t* outEnd, const CharType*& in, const CharType* inEnd, const VectorDecodeTables& tables)
+{
+    const __m128i lowNibbleClasses = _mm_loadu_si128(reinterpret_cast<const __m128i*>(tables.lowNibbleClasses));
+    const __m128i highNibbleClasses = _mm_loadu_si128(reinterpret_cast<const __m128i*>(tables.highNibbleClasses));
+    const __m128i offsets = _mm_loadu_si128(reinterpret_cast<const __m128i*>(tables.offsets));
+    const __m128i character63 = _mm_set1_epi8(tables.character63);
+    const __m128i nibbleMask = _mm_set1_epi8(0x0F);
+
+    // The store writes 16 bytes but only 12 of them are output
+    while (inEnd - in >= 16 && outEnd - out >= 16) {
+        __m128i input = loadCharactersSSE(in);
+        __m128i highNibbles = _mm_and_si128(_mm_srli_epi32(input, 4), nibbleMask);
+        __m128i lowNibbles = _mm_and_si128(input, nibbleMask);
+        __m128i high = _mm_shuffle_epi8(highNibbleClasses, highNibbles);
+        __m128i low = _mm_shuffle_epi8(lowNibbleClasses, lowNibbles);
+        if (!_mm_testz_si128(low, high))
+            return;
+
+        __m128i is63 = _mm_and_si128(_mm_cmpeq_epi8(input, character63), _mm_set1_epi8(8));
+        __m128i values = _mm_add_epi8(input, _mm_shuffle_epi8(offsets, _mm_or_si128(highNibbles, is63)));
+
+        __m128i merged = _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+        merged = _mm_madd_epi16(merged, _mm_set1_epi32(0x00011000));
+        merged = _mm_shuffle_epi8(merged, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out), merged);
+
+        in += 16;
+        out += 12;
+    }
+}
+
+template<typename CharType>
+__attribute__((target("avx2"))) static ALWAYS_INLINE __m256i loadCharactersAVX2(const CharType* source)
+{
+    if constexpr (sizeof(CharType) == 1)
+        return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source));
+
+    __m256i low = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source));
+    __m256i high = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + 16));
+    // packus works per 128-bit lane, so put the quadwords back in order
+    return _mm256_permute4x64_epi64(_mm256_packus_epi16(low, high), 0xD8);
+}
+
+// Decodes 32 characters at a time into 24 bytes.
+template<typename CharType>
+__attribute__((target("avx2"))) static void decodeAVX2(uint8_t*& out, const uint8_t* outEnd, const CharType*& in, const CharType* inEnd, const VectorDecodeTables& tables)
+{
+    const __m256i lowNibbleClasses = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(tables.lowNibbleClasses)));
+    const __m256i highNibbleClasses = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(tables.highNibbleClasses)));
+    const __m256i offsets = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(tables.offsets)));
+    const __m256i character63 = _mm256_set1_epi8(tables.character63);
+    const __m256i nibbleMask = _mm256_set1_epi8(0x0F);
+    const __m256i pack = _mm256_setr_epi8(
+        2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+        2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+
+    while (inEnd - in >= 32 && outEnd - out >= 32) {
+        __m256i input = loadCharactersAVX2(in);
+        __m256i highNibbles = _mm256_and_si256(_mm256_srli_epi32(input, 4), nibbleMask);
+        __m256i lowNibbles = _mm256_and_si256(input, nibbleMask);
+        __m256i high = _mm256_shuffle_epi8(highNibbleClasses, highNibbles);
+        __m256i low = _mm256_shuffle_epi8(lowNibbleClasses, lowNibbles);
+        if (!_mm256_testz_si256(low, high))
+            return;
+
+        __m256i is63 = _mm256_and_si256(_mm256_cmpeq_epi8(input, character63), _mm256_set1_epi8(8));
+        __m256i values = _mm256_add_epi8(input, _mm256_shuffle_epi8(offsets, _mm256_or_si256(highNibbles, is63)));
+
+        __m256i merged = _mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140));
+        merged = _mm256_madd_epi16(merged, _mm256_set1_epi32(0x00011000));
+        merged = _mm256_shuffle_epi8(merged, pack);
+        merged = _mm256_permutevar8x32_epi32(merged, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), merged);
+
+        in += 32;
+        out += 24;
+    }
+}
+
+#endif
+
+void encode(LChar* destination, const uint8_t* source, size_t length, Alphabet alphabet)
+{
+    size_t consumed = 0;
+
+#if BUN_BASE64_X86
+    if (length >= 28 && hasAVX2())
+        consumed = encodeAVX2(destination, source, length, alphabet);
+    if (length - consumed >= 16 && hasSSE41())
+        consumed += encodeSSE(destination + (consumed / 3) * 4, source + consumed, length - consumed, alphabet);
+#endif
+
+    encodeScalar(destination + (consumed / 3) * 4, source + consumed, length - consumed, alphabet);
+}
+
+template<typename CharType>
+static ALWAYS_INLINE void decodeVector(uint8_t*& out, const uint8_t* outEnd, const CharType*& in, const CharType* inEnd, Alphabet alphabet)
+{
+#if BUN_BASE64_X86
+    const VectorDecodeTables& tables = alphabet == Alphabet::URL ? urlVectorTables : standardVectorTables;
+    if (hasAVX2())
+        decodeAVX2(out, outEnd, in, inEnd, tables);
+    if (hasSSE41())
+        decodeSSE(out, outEnd, in, inEnd, tables);
+#else
+    UNUSED_PARAM(out);
+    UNUSED_PARAM(outEnd);
+    UNUSED_PARAM(in);
+    UNUSED_PARAM(inEnd);
+    UNUSED_PARAM(alphabet);
+#endif
+}
+
+enum class DecodeMode {
+    Lenient,
+    Forgiving,
+};
+
+template<DecodeMode mode, typename CharType>
+static std::optional<size_t> decodeImpl(uint8_t* destination, size_t destinationLength, const CharType* source, size_t sourceLength, Alphabet alphabet)
+{
+    const DecodeTable& table = mode == DecodeMode::Forgiving ? forgivingDecodeTable : lenientDecodeTable;
+    uint8_t* out = destination;
+    const uint8_t* outEnd = destination + destinationLength;
+    const CharType* in = source;
+    const CharType* inEnd = source + sourceLength;
+
+    while (true) {
+        // Take the fast path until something other than the alphabet shows
+        // up, then handle one group of four characters here and try again.
+        decodeVector(out, outEnd, in, inEnd, alphabet);
+
+        uint8_t group[4] = { 0, 0, 0, 0 };
+        unsigned count = 0;
+        bool sawPadding = false;
+        while (count < 4 && in < inEnd) {
+            CharType character = *in++;
+            uint8_t value = decodeCharacter(table, character);
+            if (value != invalidValue) {
+                group[count++] = value;
+                continue;
+            }
+
+            if (character == '=') {
+                sawPadding = true;
+                break;
+            }
+
+            if constexpr (mode == DecodeMode::Forgiving) {
+                if (!isForgivingWhitespace(character))
+                    return std::nullopt;
+            }
+        }
+
+        uint32_t triple = (group[0] << 18) | (group[1] << 12) | (group[2] << 6) | group[3];
+
+        if (count == 4) {
+            if (LIKELY(outEnd - out >= 3)) {
+                out[0] = triple >> 16;
+                out[1] = triple >> 8;
+                out[2] = triple;
+                out += 3;
+                continue;
+            }
+        } else if constexpr (mode == DecodeMode::Forgiving) {
+            if (count == 1)
+                return std::nullopt;
+
+            // Padding must complete the last group and only whitespace may follow it
+            if (sawPadding) {
+                unsigned padding = 1;
+                for (; in < inEnd; in++) {
+                    if (*in == '=')
+                        padding++;
+                    else if (!isForgivingWhitespace(*in))
+                        return std::nullopt;
+                }
+
+                if (count == 0 || count + padding != 4)
+                    return std::nullopt;
+            }
+        }
+
+        // The last, partial group. Leftover bits are discarded.
+        if (count > 1 && out < outEnd)
+            *out++ = triple >> 16;
+        if (count > 2 && out < outEnd)
+            *out++ = triple >> 8;
+        if (count > 3 && out < outEnd)
+            *out++ = triple;
+
+        return out - destination;
+    }
+}
+
+size_t decode(uint8_t* destination, size_t destinationLength, const LChar* source, size_t sourceLength, Alphabet alphabet)
+{
+    return *decodeImpl<DecodeMode::Lenient>(destination, destinationLength, source, sourceLength, alphabet);
+}
+
+size_t decode(uint8_t* destination, size_t destinationLength, const UChar* source, size_t sourceLength, Alphabet alphabet)
+{
+    return *decodeImpl<DecodeMode::Lenient>(destination, destinationLength, source, sourceLength, alphabet);
+}
+
+std::optional<size_t> decodeForgiving(uint8_t* destination, size_t destinationLength, const LChar* source, size_t sourceLength)
+{
+    return decodeImpl<DecodeMode::Forgiving>(destination, destinationLength, source, sourceLength, Alphabet::Standard);
+}
+
+std::optional<size_t> decodeForgiving(uint8_t* destination, size_t destinationLength, const UChar* source, size_t sourceLength)
+{
+    return decodeImpl<DecodeMode::Forgiving>(destination, destinationLength, source, sourceLength, Alphabet::Standard);
+}
+
+}
+}
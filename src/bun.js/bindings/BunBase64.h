@@ -0,0 +1,51 @@
+#pragma once
+
+#include "root.h"
+
+namespace Bun {
+namespace Base64 {
+
+enum class Alphabet : uint8_t {
+    Standard,
+    // base64url is encoded without padding, like Node.js
+    URL,
+};
+
+constexpr size_t encodedLength(size_t length, Alphabet alphabet)
+{
+    if (alphabet == Alphabet::URL)
+        return (length / 3) * 4 + (length % 3 ? length % 3 + 1 : 0);
+
+    return ((length + 2) / 3) * 4;
+}
+
+// Writes exactly encodedLength(length, alphabet) characters into destination.
+void encode(LChar* destination, const uint8_t* source, size_t length, Alphabet alphabet);
+
+// The number of bytes Buffer.byteLength() reports for a base64 or base64url
+// string. This is an upper bound for both decode() and decodeForgiving().
+template<typename CharType>
+size_t decodedLength(const CharType* source, size_t length)
+{
+    if (length > 0 && source[length - 1] == '=')
+        length--;
+    if (length > 0 && source[length - 1] == '=')
+        length--;
+
+    return (length / 4) * 3 + ((length % 4) * 3) / 4;
+}
+
+// Decodes the way Node.js Buffer does: both alphabets are accepted,
+// unrecognized characters are skipped and the first '=' ends the input.
+// Writes at most destinationLength bytes and returns how many were written.
+size_t decode(uint8_t* destination, size_t destinationLength, const LChar* source, size_t sourceLength, Alphabet alphabet);
+size_t decode(uint8_t* destination, size_t destinationLength, const UChar* source, size_t sourceLength, Alphabet alphabet);
+
+// The forgiving-base64 decode from the HTML spec, used by atob().
+// ASCII whitespace is ignored. Returns std::nullopt when the input is not
+// valid base64. destination must be at least decodedLength() bytes.
+std::optional<size_t> decodeForgiving(uint8_t* destination, size_t destinationLength, const LChar* source, size_t sourceLength);
+std::optional<size_t> decodeForgiving(uint8_t* destination, size_t destinationLength, const UChar* source, size_t sourceLength);
+
+}
+}
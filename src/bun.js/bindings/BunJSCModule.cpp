@@ -31,6 +31,10 @@
 #endif
 
 #include "mimalloc.h"
+#include "webcrypto/CryptoWorkQueue.h"
+#include "ScriptExecutionContext.h"
+#include "JavaScriptCore/StrongInlines.h"
+#include <wtf/Scope.h>
 
 using namespace JSC;
 using namespace WTF;
@@ -238,6 +242,175 @@ JSC_DEFINE_HOST_FUNCTION(functionMemoryUsageStatistics, (JSGlobalObject * global
     return JSValue::encode(stats);
 }
 
+struct NapiThreadsafeFunctionStats {
+    size_t functions;
+    size_t queued;
+    size_t queueHighWater;
+};
+extern "C" void Bun__napi_threadsafeFunctionStats(NapiThreadsafeFunctionStats*);
+
+// Thread-safe functions that are not finalized yet, the items queued to them
+// and not called yet, and the most that were ever queued to one of them,
+// including finalized ones.
+JSC_DECLARE_HOST_FUNCTION(functionNapiThreadsafeFunctionStats);
+JSC_DEFINE_HOST_FUNCTION(functionNapiThreadsafeFunctionStats, (JSGlobalObject * globalObject, CallFrame*))
+{
+    auto& vm = globalObject->vm();
+    NapiThreadsafeFunctionStats napiStats {};
+    Bun__napi_threadsafeFunctionStats(&napiStats);
+
+    JSC::JSObject* stats = constructEmptyObject(globalObject);
+    stats->putDirect(vm, Identifier::fromString(vm, "functions"_s), jsNumber(napiStats.functions));
+    stats->putDirect(vm, Identifier::fromString(vm, "queued"_s), jsNumber(napiStats.queued));
+    stats->putDirect(vm, Identifier::fromString(vm, "queueHighWater"_s), jsNumber(napiStats.queueHighWater));
+    return JSValue::encode(stats);
+}
+
+JSC_DECLARE_HOST_FUNCTION(functionCryptoQueueStats);
+JSC_DEFINE_HOST_FUNCTION(functionCryptoQueueStats, (JSGlobalObject * globalObject, CallFrame*))
+{
+    auto& vm = globalObject->vm();
+    JSC::JSObject* stats = constructEmptyObject(globalObject);
+    stats->putDirect(vm, Identifier::fromString(vm, "threads"_s), jsNumber(WebCore::CryptoWorkQueue::threadCount()));
+
+    JSC::JSObject* operations = constructEmptyObject(globalObject);
+    for (unsigned i = 0; i < WebCore::CryptoWorkQueue::operationCount; i++) {
+        auto operation = static_cast<WebCore::CryptoWorkQueue::Operation>(i);
+        auto statistics = WebCore::CryptoWorkQueue::statistics(operation);
+        // Started tasks have a wait time, finished ones a run time
+        size_t started = statistics.completed + statistics.running;
+
+        JSC::JSObject* entry = constructEmptyObject(globalObject);
+        entry->putDirect(vm, Identifier::fromString(vm, "pending"_s), jsNumber(statistics.pending));
+        entry->putDirect(vm, Identifier::fromString(vm, "running"_s), jsNumber(statistics.running));
+        entry->putDirect(vm, Identifier::fromString(vm, "peakRunning"_s), jsNumber(statistics.peakRunning));
+        entry->putDirect(vm, Identifier::fromString(vm, "completed"_s), jsNumber(statistics.completed));
+        entry->putDirect(vm, Identifier::fromString(vm, "averageWaitMs"_s), jsNumber(started ? statistics.totalWaitTime.milliseconds() / started : 0));
+        entry->putDirect(vm, Identifier::fromString(vm, "maxWaitMs"_s), jsNumber(statistics.maxWaitTime.milliseconds()));
+        entry->putDirect(vm, Identifier::fromString(vm, "averageRunMs"_s), jsNumber(statistics.completed ? statistics.totalRunTime.milliseconds() / statistics.completed : 0));
+        operations->putDirect(vm, Identifier::fromString(vm, WebCore::CryptoWorkQueue::name(operation)), entry);
+    }
+    stats->putDirect(vm, Identifier::fromString(vm, "operations"_s), operations);
+
+    return JSValue::encode(stats);
+}
+
+// Registers a scratch context and moves it through `regenerations` fresh
+// identifiers, which is how slots get allocated and retired. Nothing may
+// still find the context under an old identifier, and posts to one must be
+// refused and release their task.
+JSC_DECLARE_HOST_FUNCTION(functionScriptExecutionContextSlotsForTesting);
+JSC_DEFINE_HOST_FUNCTION(functionScriptExecutionContextSlotsForTesting, (JSGlobalObject * globalObject, CallFrame* callFrame))
+{
+    auto& vm = globalObject->vm();
+    auto scope = DECLARE_THROW_SCOPE(vm);
+    unsigned regenerations = callFrame->argument(0).toUInt32(globalObject);
+    RETURN_IF_EXCEPTION(scope, {});
+
+    unsigned staleLookups = 0;
+    unsigned missingLookups = 0;
+    unsigned acceptedPosts = 0;
+    unsigned releasedTasks = 0;
+    auto post = [&](WebCore::ScriptExecutionContextIdentifier identifier) {
+        return WebCore::ScriptExecutionContext::postTaskTo(identifier, [released = makeScopeExit([&] { releasedTasks++; })](WebCore::ScriptExecutionContext&) {});
+    };
+
+    auto* context = new WebCore::ScriptExecutionContext(&vm, globalObject);
+    auto first = context->identifier();
+    for (unsigned i = 0; i < regenerations; i++) {
+        auto previous = context->identifier();
+        context->regenerateIdentifier();
+        if (WebCore::ScriptExecutionContext::getScriptExecutionContext(previous))
+            staleLookups++;
+        if (WebCore::ScriptExecutionContext::getScriptExecutionContext(context->identifier()) != context)
+            missingLookups++;
+        if (post(previous))
+            acceptedPosts++;
+    }
+    auto last = context->identifier();
+    context->removeFromContextsMap();
+    bool postAfterRemoval = post(last);
+    delete context;
+
+    JSC::JSObject* result = constructEmptyObject(globalObject);
+    result->putDirect(vm, Identifier::fromString(vm, "first"_s), jsNumber(first));
+    result->putDirect(vm, Identifier::fromString(vm, "last"_s), jsNumber(last));
+    result->putDirect(vm, Identifier::fromString(vm, "staleLookups"_s), jsNumber(staleLookups));
+    result->putDirect(vm, Identifier::fromString(vm, "missingLookups"_s), jsNumber(missingLookups));
+    result->putDirect(vm, Identifier::fromString(vm, "acceptedPosts"_s), jsNumber(acceptedPosts));
+    result->putDirect(vm, Identifier::fromString(vm, "releasedTasks"_s), jsNumber(releasedTasks));
+    result->putDirect(vm, Identifier::fromString(vm, "postAfterRemoval"_s), jsBoolean(postAfterRemoval));
+    return JSValue::encode(result);
+}
+
+struct PostOrderForTesting : ThreadSafeRefCounted<PostOrderForTesting> {
+    JSC::Strong<JSC::JSPromise> promise;
+    Vector<unsigned> order;
+    unsigned expected { 0 };
+};
+
+// Starts `threads` threads that each post `tasksPerThread` tasks to this
+// context at the same time, `batchSize` tasks per postTasksTo() call (one
+// postTaskTo() per task when it is 0 or 1). Resolves with
+// thread * tasksPerThread + index for every task, in the order they ran.
+JSC_DECLARE_HOST_FUNCTION(functionPostTasksFromThreadsForTesting);
+JSC_DEFINE_HOST_FUNCTION(functionPostTasksFromThreadsForTesting, (JSGlobalObject * globalObject, CallFrame* callFrame))
+{
+    auto& vm = globalObject->vm();
+    auto scope = DECLARE_THROW_SCOPE(vm);
+    unsigned threads = callFrame->argument(0).toUInt32(globalObject);
+    RETURN_IF_EXCEPTION(scope, {});
+    unsigned tasksPerThread = callFrame->argument(1).toUInt32(globalObject);
+    RETURN_IF_EXCEPTION(scope, {});
+    unsigned batchSize = callFrame->argument(2).toUInt32(globalObject);
+    RETURN_IF_EXCEPTION(scope, {});
+
+    auto* promise = JSC::JSPromise::create(vm, globalObject->promiseStructure());
+    if (!threads || !tasksPerThread) {
+        promise->resolve(globalObject, constructEmptyArray(globalObject, nullptr));
+        return JSValue::encode(promise);
+    }
+
+    auto state = adoptRef(*new PostOrderForTesting);
+    state->promise = JSC::Strong<JSC::JSPromise>(vm, promise);
+    state->expected = threads * tasksPerThread;
+    state->order.reserveInitialCapacity(state->expected);
+
+    auto identifier = reinterpret_cast<Zig::GlobalObject*>(globalObject)->scriptExecutionContext()->identifier();
+    for (unsigned thread = 0; thread < threads; thread++) {
+        Thread::create("Bun post order test", [state = state.copyRef(), identifier, thread, tasksPerThread, batchSize] {
+            WebCore::EventLoopTaskBatch batch;
+            for (unsigned index = 0; index < tasksPerThread; index++) {
+                auto* task = WebCore::createEventLoopTask([state = state.copyRef(), value = thread * tasksPerThread + index](WebCore::ScriptExecutionContext& context) {
+                    state->order.append(value);
+                    if (state->order.size() != state->expected)
+                        return;
+
+                    auto* globalObject = context.jsGlobalObject();
+                    JSC::JSArray* order = constructEmptyArray(globalObject, nullptr, state->order.size());
+                    for (unsigned i = 0; i < state->order.size(); i++)
+                        order->putDirectIndex(globalObject, i, jsNumber(state->order[i]));
+                    state->promise->resolve(globalObject, order);
+                    // The last reference may go away on a posting thread.
+                    state->promise.clear();
+                });
+
+                if (batchSize <= 1) {
+                    WebCore::ScriptExecutionContext::postTaskTo(identifier, task);
+                    continue;
+                }
+
+                batch.append(task);
+                if (batch.size() == batchSize)
+                    WebCore::ScriptExecutionContext::postTasksTo(identifier, WTFMove(batch));
+            }
+            WebCore::ScriptExecutionContext::postTasksTo(identifier, WTFMove(batch));
+        })->detach();
+    }
+
+    return JSValue::encode(promise);
+}
+
 JSC_DECLARE_HOST_FUNCTION(functionCreateMemoryFootprint);
 JSC_DEFINE_HOST_FUNCTION(functionCreateMemoryFootprint, (JSGlobalObject * globalObject, CallFrame*))
 {
@@ -451,8 +624,9 @@ JSC::JSObject* createJSCModule(JSC::JSGlobalObject* globalObject)
 
     {
         JSC::ObjectInitializationScope initializationScope(vm);
-        object = JSC::constructEmptyObject(globalObject, globalObject->objectPrototype(), 23);
+        object = JSC::constructEmptyObject(globalObject, globalObject->objectPrototype(), 25);
         object->putDirectNativeFunction(vm, globalObject, JSC::Identifier::fromString(vm, "callerSourceOrigin"_s), 1, functionCallerSourceOrigin, ImplementationVisibility::Public, NoIntrinsic, JSC::PropertyAttribute::ReadOnly | JSC::PropertyAttribute::DontDelete | 0);
+        object->putDirectNativeFunction(vm, globalObject, JSC::Identifier::fromString(vm, "cryptoQueueStats"_s), 0, functionCryptoQueueStats, ImplementationVisibility::Public, NoIntrinsic, JSC::PropertyAttribute::ReadOnly | JSC::PropertyAttribute::DontDelete | 0);
         object->putDirectNativeFunction(vm, globalObject, JSC::Identifier::fromString(vm, "describe"_s), 1, functionDescribe, ImplementationVisibility::Public, NoIntrinsic, JSC::PropertyAttribute::ReadOnly | JSC::PropertyAttribute::DontDelete | 0);
         object->putDirectNativeFunction(vm, globalObject, JSC::Identifier::fromString(vm, "describeArray"_s), 1, functionDescribeArray, ImplementationVisibility::Public, NoIntrinsic, JSC::PropertyAttribute::ReadOnly | JSC::PropertyAttribute::DontDelete | 0);
         object->putDirectNativeFunction(vm, globalObject, JSC::Identifier::fromString(vm, "drainMicrotasks"_s), 1, functionDrainMicrotasks, ImplementationVisibility::Public, NoIntrinsic, JSC::PropertyAttribute::ReadOnly | JSC::PropertyAttribute::DontDelete | 0);
@@ -464,6 +638,7 @@ JSC::JSObject* createJSCModule(JSC::JSGlobalObject* globalObject)
         object->putDirectNativeFunction(vm, globalObject, JSC::Identifier::fromString(vm, "heapStats"_s), 1, functionMemoryUsageStatistics, ImplementationVisibility::Public, NoIntrinsic, JSC::PropertyAttribute::ReadOnly | JSC::PropertyAttribute::DontDelete | 0);
         object->putDirectNativeFunction(vm, globalObject, JSC::Identifier::fromString(vm, "startSamplingProfiler"_s), 1, functionStartSamplingProfiler, ImplementationVisibility::Public, NoIntrinsic, JSC::PropertyAttribute::ReadOnly | JSC::PropertyAttribute::DontDelete | 0);
         object->putDirectNativeFunction(vm, globalObject, JSC::Identifier::fromString(vm, "samplingProfilerStackTraces"_s), 1, functionSamplingProfilerStackTraces, ImplementationVisibility::Public, NoIntrinsic, JSC::PropertyAttribute::ReadOnly | JSC::PropertyAttribute::DontDelete | 0);
+        object->putDirectNativeFunction(vm, globalObject, JSC::Identifier::fromString(vm, "napiThreadsafeFunctionStats"_s), 0, functionNapiThreadsafeFunctionStats, ImplementationVisibility::Public, NoIntrinsic, JSC::PropertyAttribute::ReadOnly | JSC::PropertyAttribute::DontDelete | 0);
         object->putDirectNativeFunction(vm, globalObject, JSC::Identifier::fromString(vm, "noInline"_s), 1, functionNeverInlineFunction, ImplementationVisibility::Public, NoIntrinsic, JSC::PropertyAttribute::ReadOnly | JSC::PropertyAttribute::DontDelete | 0);
         object->putDirectNativeFunction(vm, globalObject, JSC::Identifier::fromString(vm, "isRope"_s), 1, functionIsRope, ImplementationVisibility::Public, NoIntrinsic, JSC::PropertyAttribute::ReadOnly | JSC::PropertyAttribute::DontDelete | 0);
         object->putDirectNativeFunction(vm, globalObject, JSC::Identifier::fromString(vm, "memoryUsage"_s), 1, functionCreateMemoryFootprint, ImplementationVisibility::Public, NoIntrinsic, JSC::PropertyAttribute::ReadOnly | JSC::PropertyAttribute::DontDelete | 0);
@@ -482,3 +657,14 @@ JSC::JSObject* createJSCModule(JSC::JSGlobalObject* globalObject)
 
     return object;
 }
+
+// Hooks for test/bun.js/script-execution-context.test.js, which loads them
+// through Bun.lazy so that they are not part of bun:jsc.
+JSC::JSObject* createScriptExecutionContextTestingObject(JSC::JSGlobalObject* globalObject)
+{
+    VM& vm = globalObject->vm();
+    JSC::JSObject* object = JSC::constructEmptyObject(globalObject, globalObject->objectPrototype(), 2);
+    object->putDirectNativeFunction(vm, globalObject, JSC::Identifier::fromString(vm, "slots"_s), 1, functionScriptExecutionContextSlotsForTesting, ImplementationVisibility::Public, NoIntrinsic, JSC::PropertyAttribute::ReadOnly | JSC::PropertyAttribute::DontDelete | 0);
+    object->putDirectNativeFunction(vm, globalObject, JSC::Identifier::fromString(vm, "postTasksFromThreads"_s), 3, functionPostTasksFromThreadsForTesting, ImplementationVisibility::Public, NoIntrinsic, JSC::PropertyAttribute::ReadOnly | JSC::PropertyAttribute::DontDelete | 0);
+    return object;
+}
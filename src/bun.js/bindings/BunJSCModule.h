@@ -1,4 +1,5 @@
 #include "root.h"
 #include "JavaScriptCore/JSObject.h"
 
-JSC::JSObject* createJSCModule(JSC::JSGlobalObject* globalObject);
\ No newline at end of file
+JSC::JSObject* createJSCModule(JSC::JSGlobalObject* globalObject);
+JSC::JSObject* createScriptExecutionContextTestingObject(JSC::JSGlobalObject* globalObject);
\ No newline at end of file
@@ -77,6 +77,15 @@ ExceptionOr<void> DOMURL::setHref(const String& url)
     return {};
 }
 
+const URL& DOMURL::url() const
+{
+    // searchParams only marks the query stale when it changes, so a run of
+    // set() and append() calls is serialized once, on the next read.
+    if (m_searchParams && m_searchParams->hasPendingURLUpdate())
+        m_url.setQuery(m_searchParams->takePendingURLUpdate());
+    return m_url;
+}
+
 void DOMURL::setQuery(const String& query)
 {
     m_url.setQuery(query);
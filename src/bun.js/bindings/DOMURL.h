@@ -43,13 +43,13 @@ public:
     static ExceptionOr<Ref<DOMURL>> create(const String& url, const DOMURL& base);
     ~DOMURL();
 
-    const URL& href() const { return m_url; }
+    const URL& href() const { return url(); }
     ExceptionOr<void> setHref(const String&);
     void setQuery(const String&);
 
     URLSearchParams& searchParams();
 
-    const String& toJSON() const { return m_url.string(); }
+    const String& toJSON() const { return url().string(); }
 
     // static String createObjectURL(ScriptExecutionContext&, Blob&);
     // static void revokeObjectURL(ScriptExecutionContext&, const String&);
@@ -60,11 +60,13 @@ private:
     static ExceptionOr<Ref<DOMURL>> create(const String& url, const URL& base);
     DOMURL(URL&& completeURL, const URL& baseURL);
 
-    URL fullURL() const final { return m_url; }
+    const URL& url() const;
+    URL fullURL() const final { return url(); }
     void setFullURL(const URL& fullURL) final { setHref(fullURL.string()); }
 
     URL m_baseURL;
-    URL m_url;
+    // Written by url() when searchParams has unserialized changes.
+    mutable URL m_url;
     RefPtr<URLSearchParams> m_searchParams;
 };
 
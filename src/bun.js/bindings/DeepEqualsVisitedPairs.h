@@ -0,0 +1,82 @@
+#pragma once
+
+#include "root.h"
+#include <wtf/HashMap.h>
+#include <wtf/Vector.h>
+#include <optional>
+
+// The pairs of objects Bun__deepEquals is comparing, so that cycles on both
+// sides are matched up instead of followed forever. Deep graphs and large
+// Sets add many pairs, so past a few the lookups go through hash maps.
+class DeepEqualsVisitedPairs {
+public:
+    // Whether left and right were paired with each other, or either with
+    // something else, or std::nullopt if neither was seen.
+    std::optional<bool> find(JSC::JSCell* left, JSC::JSCell* right) const
+    {
+        if (!m_usesHashMaps) {
+            for (auto& pair : m_pairs) {
+                if (pair.first == left)
+                    return pair.second == right;
+                if (pair.second == right)
+                    return false;
+            }
+            return std::nullopt;
+        }
+
+        auto it = m_leftToRight.find(left);
+        if (it != m_leftToRight.end())
+            return it->value == right;
+        if (m_rightToLeft.contains(right))
+            return false;
+        return std::nullopt;
+    }
+
+    void add(JSC::JSCell* left, JSC::JSCell* right)
+    {
+        if (!m_usesHashMaps) {
+            if (m_pairs.size() < maxLinearPairs) {
+                m_pairs.append({ left, right });
+                return;
+            }
+
+            m_usesHashMaps = true;
+            for (auto& pair : m_pairs) {
+                m_leftToRight.add(pair.first, pair.second);
+                m_rightToLeft.add(pair.second, pair.first);
+            }
+            m_pairs.clear();
+        }
+
+        m_leftToRight.add(left, right);
+        m_rightToLeft.add(right, left);
+    }
+
+    void remove(JSC::JSCell* left, JSC::JSCell* right)
+    {
+        if (!m_usesHashMaps) {
+            for (size_t i = m_pairs.size(); i--;) {
+                if (m_pairs[i].first == left && m_pairs[i].second == right) {
+                    m_pairs.remove(i);
+                    return;
+                }
+            }
+            return;
+        }
+
+        auto it = m_leftToRight.find(left);
+        if (it != m_leftToRight.end() && it->value == right)
+            m_leftToRight.remove(it);
+        auto reverse = m_rightToLeft.find(right);
+        if (reverse != m_rightToLeft.end() && reverse->value == left)
+            m_rightToLeft.remove(reverse);
+    }
+
+private:
+    static constexpr size_t maxLinearPairs = 16;
+
+    Vector<std::pair<JSC::JSCell*, JSC::JSCell*>, maxLinearPairs> m_pairs;
+    HashMap<JSC::JSCell*, JSC::JSCell*> m_leftToRight;
+    HashMap<JSC::JSCell*, JSC::JSCell*> m_rightToLeft;
+    bool m_usesHashMaps { false };
+};
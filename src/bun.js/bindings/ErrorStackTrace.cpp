@@ -5,6 +5,7 @@
 
 #include "config.h"
 #include "ErrorStackTrace.h"
+#include "ZigSourceProvider.h"
 
 #include <JavaScriptCore/CatchScope.h>
 #include <JavaScriptCore/DebuggerPrimitives.h>
@@ -126,6 +127,40 @@ JSCStackTrace JSCStackTrace::getStackTraceForThrownValue(JSC::VM& vm, JSC::JSVal
     return fromExisting(vm, *jscStackTrace);
 }
 
+const JSC::ClassInfo JSCapturedStackTrace::s_info = { "CapturedStackTrace"_s, &Base::s_info, nullptr, nullptr, CREATE_METHOD_TABLE(JSCapturedStackTrace) };
+
+void JSCapturedStackTrace::finishCreation(JSC::VM& vm, JSCStackTrace& stackTrace)
+{
+    Base::finishCreation(vm);
+
+    size_t frameCount = stackTrace.size();
+    m_frames.reserveInitialCapacity(frameCount);
+    for (size_t i = 0; i < frameCount; i++) {
+        JSCStackFrame& frame = stackTrace.at(i);
+        if (frame.isWasmFrame()) {
+            m_frames.uncheckedAppend(JSC::StackFrame(frame.wasmFunctionIndexOrName()));
+        } else if (frame.codeBlock()) {
+            m_frames.uncheckedAppend(JSC::StackFrame(vm, this, frame.callee(), frame.codeBlock(),
+                frame.hasBytecodeIndex() ? frame.bytecodeIndex() : JSC::BytecodeIndex()));
+        } else {
+            m_frames.uncheckedAppend(JSC::StackFrame(vm, this, frame.callee()));
+        }
+    }
+}
+
+template<typename Visitor>
+void JSCapturedStackTrace::visitChildrenImpl(JSCell* cell, Visitor& visitor)
+{
+    JSCapturedStackTrace* thisObject = jsCast<JSCapturedStackTrace*>(cell);
+    ASSERT_GC_OBJECT_INHERITS(thisObject, info());
+    Base::visitChildren(thisObject, visitor);
+
+    for (auto& frame : thisObject->m_frames)
+        frame.visitAggregate(visitor);
+}
+
+DEFINE_VISIT_CHILDREN(JSCapturedStackTrace);
+
 JSCStackFrame::JSCStackFrame(JSC::VM& vm, JSC::StackVisitor& visitor)
     : m_vm(vm)
     , m_codeBlock(nullptr)
@@ -336,21 +371,32 @@ bool JSCStackFrame::calculateSourcePositions()
     int expressionStop = divotPoint + endOffset;
 
     // Make sure the range is valid
-    StringView sourceString = m_codeBlock->source().provider()->source();
+    JSC::SourceProvider* provider = m_codeBlock->source().provider();
+    StringView sourceString = provider->source();
     if (!expressionStop || expressionStart > static_cast<int>(sourceString.length())) {
         return false;
     }
 
-    // Search for the beginning of the line
-    unsigned int lineStart = expressionStart;
-    while ((lineStart > 0) && ('\n' != sourceString[lineStart - 1])) {
-        lineStart--;
-    }
-    // Search for the end of the line
-    unsigned int lineStop = expressionStop;
-    unsigned int sourceLength = sourceString.length();
-    while ((lineStop < sourceLength) && ('\n' != sourceString[lineStop])) {
-        lineStop++;
+    unsigned int lineStart;
+    unsigned int lineStop;
+    if (Zig::SourceProvider* zigProvider = Zig::SourceProvider::fromProvider(provider)) {
+        // Modules can be bundles with megabyte long lines, so use their line index
+        // instead of scanning the line character by character for every frame.
+        const SourceLineIndex& lineIndex = zigProvider->lineIndex();
+        lineStart = lineIndex.lineStartForOffset(expressionStart);
+        lineStop = lineIndex.lineStopForOffset(expressionStop);
+    } else {
+        // Search for the beginning of the line
+        lineStart = expressionStart;
+        while ((lineStart > 0) && ('\n' != sourceString[lineStart - 1])) {
+            lineStart--;
+        }
+        // Search for the end of the line
+        lineStop = expressionStop;
+        unsigned int sourceLength = sourceString.length();
+        while ((lineStop < sourceLength) && ('\n' != sourceString[lineStop])) {
+            lineStop++;
+        }
     }
 
     /* Finally, store the source "positions" info.
@@ -6,6 +6,7 @@
 #pragma once
 
 #include <JavaScriptCore/StackVisitor.h>
+#include <JavaScriptCore/StackFrame.h>
 #include <JavaScriptCore/CodeBlock.h>
 #include <JavaScriptCore/WasmIndexOrName.h>
 
@@ -102,6 +103,7 @@ public:
     SourcePositions* getSourcePositions();
 
     bool isWasmFrame() const { return m_isWasmFrame; }
+    const JSC::Wasm::IndexOrName& wasmFunctionIndexOrName() const { return m_wasmFunctionIndexOrName; }
     bool isEval() const { return m_codeBlock && (JSC::EvalCode == m_codeBlock->codeType()); }
     bool isConstructor() const { return m_codeBlock && (JSC::CodeForConstruct == m_codeBlock->specializationKind()); }
 
@@ -177,4 +179,55 @@ private:
     }
 };
 
+/* The frames captured by Error.captureStackTrace, kept until the "stack" property is first read.
+ * Only the callee, code block and bytecode index of each frame are stored (as JSC::StackFrames, which
+ * the GC knows how to visit); source positions, source map remapping and formatting are all deferred
+ * to the first access, like v8 does. */
+class JSCapturedStackTrace final : public JSC::JSDestructibleObject {
+public:
+    using Base = JSC::JSDestructibleObject;
+
+    static JSCapturedStackTrace* create(JSC::VM& vm, JSC::Structure* structure, JSCStackTrace& stackTrace)
+    {
+        JSCapturedStackTrace* capturedStackTrace = new (NotNull, JSC::allocateCell<JSCapturedStackTrace>(vm)) JSCapturedStackTrace(vm, structure);
+        capturedStackTrace->finishCreation(vm, stackTrace);
+        return capturedStackTrace;
+    }
+
+    DECLARE_INFO;
+    DECLARE_VISIT_CHILDREN;
+
+    static JSC::Structure* createStructure(JSC::VM& vm, JSC::JSGlobalObject* globalObject, JSC::JSValue prototype)
+    {
+        return JSC::Structure::create(vm, globalObject, prototype, JSC::TypeInfo(JSC::ObjectType, StructureFlags), info());
+    }
+
+    template<typename, JSC::SubspaceAccess mode> static JSC::GCClient::IsoSubspace* subspaceFor(JSC::VM& vm)
+    {
+        if constexpr (mode == JSC::SubspaceAccess::Concurrently)
+            return nullptr;
+
+        return WebCore::subspaceForImpl<JSCapturedStackTrace, UseCustomHeapCellType::No>(
+            vm,
+            [](auto& spaces) { return spaces.m_clientSubspaceForCapturedStackTrace.get(); },
+            [](auto& spaces, auto&& space) { spaces.m_clientSubspaceForCapturedStackTrace = WTFMove(space); },
+            [](auto& spaces) { return spaces.m_subspaceForCapturedStackTrace.get(); },
+            [](auto& spaces, auto&& space) { spaces.m_subspaceForCapturedStackTrace = WTFMove(space); });
+    }
+
+    static void destroy(JSC::JSCell* cell) { static_cast<JSCapturedStackTrace*>(cell)->JSCapturedStackTrace::~JSCapturedStackTrace(); }
+
+    const WTF::Vector<JSC::StackFrame>& frames() const { return m_frames; }
+
+private:
+    JSCapturedStackTrace(JSC::VM& vm, JSC::Structure* structure)
+        : Base(vm, structure)
+    {
+    }
+
+    void finishCreation(JSC::VM&, JSCStackTrace&);
+
+    WTF::Vector<JSC::StackFrame> m_frames;
+};
+
 }
\ No newline at end of file
@@ -32,6 +32,10 @@
 #include "JavaScriptCore/BuiltinNames.h"
 
 #include "JSBufferEncodingType.h"
+#include "BunBase64.h"
+#include "BufferSearch.h"
+#include "ZigGlobalObject.h"
+#include "wtf-bindings.h"
 #include "JSBufferPrototypeBuiltins.h"
 #include "JSBufferConstructorBuiltins.h"
 #include "JavaScriptCore/JSBase.h"
@@ -42,6 +46,12 @@
 
 // #include "JavaScriptCore/JSTypedArrayViewPrototype.h"
 #include "JavaScriptCore/JSArrayBufferViewInlines.h"
+#include "JavaScriptCore/JSBigInt.h"
+#include <JavaScriptCore/DOMJITAbstractHeap.h>
+#include "DOMJITIDLConvert.h"
+#include "DOMJITIDLType.h"
+#include "DOMJITIDLTypeFilter.h"
+#include "DOMJITHelpers.h"
 
 static JSC_DECLARE_HOST_FUNCTION(jsBufferConstructorFunction_alloc);
 static JSC_DECLARE_HOST_FUNCTION(jsBufferConstructorFunction_allocUnsafe);
@@ -229,6 +239,30 @@ static inline EncodedJSValue constructBufferFromLength(JSGlobalObject* lexicalGl
     return jsBufferConstructorFunction_allocUnsafeBody(lexicalGlobalObject, callFrame);
 }
 
+template<typename CharType>
+static EncodedJSValue constructFromBase64(JSGlobalObject* lexicalGlobalObject, const CharType* characters, size_t length, Bun::Base64::Alphabet alphabet)
+{
+    auto throwScope = DECLARE_THROW_SCOPE(lexicalGlobalObject->vm());
+
+    size_t decodedLength = Bun::Base64::decodedLength(characters, length);
+    if (decodedLength == 0)
+        RELEASE_AND_RETURN(throwScope, JSBuffer__bufferFromLength(lexicalGlobalObject, 0));
+
+    auto arrayBuffer = JSC::ArrayBuffer::tryCreateUninitialized(decodedLength, 1);
+    if (UNLIKELY(!arrayBuffer)) {
+        throwOutOfMemoryError(lexicalGlobalObject, throwScope);
+        return JSC::JSValue::encode(jsUndefined());
+    }
+
+    // Skipped characters make the result shorter than decodedLength, so the
+    // buffer may view only part of its ArrayBuffer, like Node.js.
+    size_t written = Bun::Base64::decode(reinterpret_cast<uint8_t*>(arrayBuffer->data()), decodedLength, characters, length, alphabet);
+    auto* uint8Array = JSC::JSUint8Array::create(lexicalGlobalObject, lexicalGlobalObject->typedArrayStructure(JSC::TypeUint8, false), WTFMove(arrayBuffer), 0, written);
+    toBuffer(lexicalGlobalObject, uint8Array);
+
+    RELEASE_AND_RETURN(throwScope, JSC::JSValue::encode(uint8Array));
+}
+
 static EncodedJSValue constructFromEncoding(JSGlobalObject* lexicalGlobalObject, JSString* str, WebCore::BufferEncodingType encoding)
 {
     auto& vm = JSC::getVM(lexicalGlobalObject);
@@ -237,6 +271,13 @@ static EncodedJSValue constructFromEncoding(JSGlobalObject* lexicalGlobalObject,
     auto view = str->tryGetValue(lexicalGlobalObject);
     JSC::EncodedJSValue result;
 
+    if (encoding == WebCore::BufferEncodingType::base64 || encoding == WebCore::BufferEncodingType::base64url) {
+        auto alphabet = encoding == WebCore::BufferEncodingType::base64url ? Bun::Base64::Alphabet::URL : Bun::Base64::Alphabet::Standard;
+        if (view.is8Bit())
+            RELEASE_AND_RETURN(scope, constructFromBase64(lexicalGlobalObject, view.characters8(), view.length(), alphabet));
+        RELEASE_AND_RETURN(scope, constructFromBase64(lexicalGlobalObject, view.characters16(), view.length(), alphabet));
+    }
+
     if (view.is8Bit()) {
         switch (encoding) {
         case WebCore::BufferEncodingType::utf8:
@@ -403,8 +444,6 @@ static inline JSC::EncodedJSValue jsBufferConstructorFunction_byteLengthBody(JSC
     case WebCore::BufferEncodingType::ascii:
     case WebCore::BufferEncodingType::ucs2:
     case WebCore::BufferEncodingType::utf16le:
-    case WebCore::BufferEncodingType::base64:
-    case WebCore::BufferEncodingType::base64url:
     case WebCore::BufferEncodingType::hex: {
         if (view.is8Bit()) {
             written = Bun__encoding__byteLengthLatin1(view.characters8(), view.length(), static_cast<uint8_t>(encoding));
@@ -413,6 +452,15 @@ static inline JSC::EncodedJSValue jsBufferConstructorFunction_byteLengthBody(JSC
         }
         break;
     }
+    case WebCore::BufferEncodingType::base64:
+    case WebCore::BufferEncodingType::base64url: {
+        if (view.is8Bit()) {
+            written = Bun::Base64::decodedLength(view.characters8(), view.length());
+        } else {
+            written = Bun::Base64::decodedLength(view.characters16(), view.length());
+        }
+        break;
+    }
     }
 
     RELEASE_AND_RETURN(scope, JSC::JSValue::encode(JSC::jsNumber(written)));
@@ -930,25 +978,27 @@ static int64_t indexOf(const uint8_t* thisPtr, int64_t thisLength, const uint8_t
 {
     if (thisLength < valueLength + byteOffset)
         return -1;
-    auto start = thisPtr + byteOffset;
-    auto it = static_cast<uint8_t*>(memmem(start, static_cast<size_t>(thisLength - byteOffset), valuePtr, static_cast<size_t>(valueLength)));
-    if (it != NULL) {
-        return it - thisPtr;
-    }
-    return -1;
+    if (valueLength == 0)
+        return byteOffset;
+
+    auto index = Bun::indexOfBytes(thisPtr + byteOffset, static_cast<size_t>(thisLength - byteOffset), valuePtr, static_cast<size_t>(valueLength));
+    return index < 0 ? -1 : index + byteOffset;
 }
 
 static int64_t lastIndexOf(const uint8_t* thisPtr, int64_t thisLength, const uint8_t* valuePtr, int64_t valueLength, int64_t byteOffset)
 {
-    auto start = thisPtr;
-    auto end = thisPtr + std::min(thisLength, byteOffset + valueLength);
-    auto it = std::find_end(start, end, valuePtr, valuePtr + valueLength);
-    if (it != end) {
-        return it - thisPtr;
-    }
-    return -1;
+    if (valueLength == 0)
+        return -1;
+
+    // A match may start at byteOffset, so it can end after it
+    auto searchLength = std::min(thisLength, byteOffset + valueLength);
+    return Bun::lastIndexOfBytes(thisPtr, static_cast<size_t>(searchLength), valuePtr, static_cast<size_t>(valueLength));
 }
 
+// Strings longer than this are encoded on every call instead of being kept
+// alive by the needle cache.
+static constexpr unsigned maxCachedSearchNeedleLength = 1024;
+
 static int64_t indexOf(JSC::JSGlobalObject* lexicalGlobalObject, JSC::CallFrame* callFrame, typename IDLOperation<JSBuffer>::ClassParameter castedThis, bool last)
 {
     auto& vm = JSC::getVM(lexicalGlobalObject);
@@ -1007,25 +1057,46 @@ static int64_t indexOf(JSC::JSGlobalObject* lexicalGlobalObject, JSC::CallFrame*
         auto* str = value.toStringOrNull(lexicalGlobalObject);
         RETURN_IF_EXCEPTION(scope, -1);
 
-        JSC::EncodedJSValue encodedBuffer = constructFromEncoding(lexicalGlobalObject, str, encoding);
-        auto* arrayValue = JSC::jsDynamicCast<JSC::JSUint8Array*>(JSC::JSValue::decode(encodedBuffer));
-        int64_t lengthValue = static_cast<int64_t>(arrayValue->byteLength());
-        const uint8_t* typedVectorValue = arrayValue->typedVector();
-        if (last) {
-            return lastIndexOf(typedVector, length, typedVectorValue, lengthValue, byteOffset);
-        } else {
-            return indexOf(typedVector, length, typedVectorValue, lengthValue, byteOffset);
+        const String& view = str->value(lexicalGlobalObject);
+        RETURN_IF_EXCEPTION(scope, -1);
+
+        // Latin-1 strings are already in the encoded form for latin1 and
+        // ascii, and for utf8 when every character is ASCII.
+        if (view.is8Bit() && (encoding == WebCore::BufferEncodingType::latin1 || encoding == WebCore::BufferEncodingType::ascii || (encoding == WebCore::BufferEncodingType::utf8 && view.impl()->containsOnlyASCII()))) {
+            if (last)
+                return lastIndexOf(typedVector, length, view.characters8(), view.length(), byteOffset);
+            return indexOf(typedVector, length, view.characters8(), view.length(), byteOffset);
         }
+
+        auto& cached = jsCast<Zig::GlobalObject*>(lexicalGlobalObject)->bufferSearchNeedle;
+        if (cached.string != view.impl() || cached.encoding != static_cast<uint8_t>(encoding)) {
+            JSC::EncodedJSValue encodedBuffer = constructFromEncoding(lexicalGlobalObject, str, encoding);
+            RETURN_IF_EXCEPTION(scope, -1);
+            auto* arrayValue = JSC::jsDynamicCast<JSC::JSUint8Array*>(JSC::JSValue::decode(encodedBuffer));
+            int64_t lengthValue = static_cast<int64_t>(arrayValue->byteLength());
+            const uint8_t* typedVectorValue = arrayValue->typedVector();
+
+            if (view.length() > maxCachedSearchNeedleLength) {
+                if (last)
+                    return lastIndexOf(typedVector, length, typedVectorValue, lengthValue, byteOffset);
+                return indexOf(typedVector, length, typedVectorValue, lengthValue, byteOffset);
+            }
+
+            cached.string = view.impl();
+            cached.encoding = static_cast<uint8_t>(encoding);
+            cached.bytes.clear();
+            cached.bytes.append(typedVectorValue, lengthValue);
+        }
+
+        if (last)
+            return lastIndexOf(typedVector, length, cached.bytes.data(), cached.bytes.size(), byteOffset);
+        return indexOf(typedVector, length, cached.bytes.data(), cached.bytes.size(), byteOffset);
     } else if (value.isNumber()) {
         uint8_t byteValue = static_cast<uint8_t>((value.toInt32(lexicalGlobalObject)) % 256);
         RETURN_IF_EXCEPTION(scope, -1);
 
         if (last) {
-            for (int64_t i = byteOffset; i >= 0; --i) {
-                if (byteValue == typedVector[i]) {
-                    return i;
-                }
-            }
+            return Bun::lastIndexOfBytes(typedVector, static_cast<size_t>(byteOffset + 1), &byteValue, 1);
         } else {
             const void* offset = memchr(reinterpret_cast<const void*>(typedVector + byteOffset), byteValue, length - byteOffset);
             if (offset != NULL) {
@@ -1168,18 +1239,28 @@ static inline JSC::EncodedJSValue jsBufferPrototypeFunction_toStringBody(JSC::JS
     case WebCore::BufferEncodingType::buffer:
     case WebCore::BufferEncodingType::utf8:
     case WebCore::BufferEncodingType::ascii:
-    case WebCore::BufferEncodingType::base64:
-    case WebCore::BufferEncodingType::base64url:
     case WebCore::BufferEncodingType::hex: {
         ret = Bun__encoding__toString(castedThis->typedVector() + offset, length, lexicalGlobalObject, static_cast<uint8_t>(encoding));
         break;
     }
+
+    case WebCore::BufferEncodingType::base64: {
+        ret = WTF__toBase64StringValue(castedThis->typedVector() + offset, length, lexicalGlobalObject);
+        break;
+    }
+
+    case WebCore::BufferEncodingType::base64url: {
+        ret = WTF__toBase64URLStringValue(castedThis->typedVector() + offset, length, lexicalGlobalObject);
+        break;
+    }
     default: {
         throwTypeError(lexicalGlobalObject, scope, "Unsupported encoding? This shouldn't happen"_s);
         break;
     }
     }
 
+    RETURN_IF_EXCEPTION(scope, JSC::JSValue::encode(jsUndefined()));
+
     JSC::JSValue retValue = JSC::JSValue::decode(ret);
     if (UNLIKELY(!retValue.isString())) {
         scope.throwException(lexicalGlobalObject, retValue);
@@ -1259,8 +1340,6 @@ static inline JSC::EncodedJSValue jsBufferPrototypeFunction_writeBody(JSC::JSGlo
     case WebCore::BufferEncodingType::ascii:
     case WebCore::BufferEncodingType::ucs2:
     case WebCore::BufferEncodingType::utf16le:
-    case WebCore::BufferEncodingType::base64:
-    case WebCore::BufferEncodingType::base64url:
     case WebCore::BufferEncodingType::hex: {
         if (view.is8Bit()) {
             written = Bun__encoding__writeLatin1(view.characters8(), view.length(), castedThis->typedVector() + offset, length, static_cast<uint8_t>(encoding));
@@ -1269,6 +1348,16 @@ static inline JSC::EncodedJSValue jsBufferPrototypeFunction_writeBody(JSC::JSGlo
         }
         break;
     }
+    case WebCore::BufferEncodingType::base64:
+    case WebCore::BufferEncodingType::base64url: {
+        auto alphabet = encoding == WebCore::BufferEncodingType::base64url ? Bun::Base64::Alphabet::URL : Bun::Base64::Alphabet::Standard;
+        if (view.is8Bit()) {
+            written = Bun::Base64::decode(castedThis->typedVector() + offset, length, view.characters8(), view.length(), alphabet);
+        } else {
+            written = Bun::Base64::decode(castedThis->typedVector() + offset, length, view.characters16(), view.length(), alphabet);
+        }
+        break;
+    }
     }
 
     RELEASE_AND_RETURN(scope, JSC::JSValue::encode(JSC::jsNumber(written)));
@@ -1439,6 +1528,279 @@ JSC_DEFINE_HOST_FUNCTION(jsBufferPrototypeFunction_write, (JSGlobalObject * lexi
     return IDLOperation<JSBuffer>::call<jsBufferPrototypeFunction_writeBody>(*lexicalGlobalObject, *callFrame, "write");
 }
 
+/* Binary read/write */
+
+// readInt32LE() and friends read the backing store directly instead of going
+// through a DataView. The methods whose arguments are all int32 also get a
+// DOMJIT signature, so the DFG calls them without boxing the offset.
+
+#if CPU(BIG_ENDIAN)
+static constexpr bool hostIsLittleEndian = false;
+#else
+static constexpr bool hostIsLittleEndian = true;
+#endif
+
+template<size_t size> struct BufferBitsForSize;
+template<> struct BufferBitsForSize<1> {
+    using type = uint8_t;
+};
+template<> struct BufferBitsForSize<2> {
+    using type = uint16_t;
+};
+template<> struct BufferBitsForSize<4> {
+    using type = uint32_t;
+};
+template<> struct BufferBitsForSize<8> {
+    using type = uint64_t;
+};
+
+static inline uint8_t byteSwap(uint8_t bits) { return bits; }
+static inline uint16_t byteSwap(uint16_t bits) { return __builtin_bswap16(bits); }
+static inline uint32_t byteSwap(uint32_t bits) { return __builtin_bswap32(bits); }
+static inline uint64_t byteSwap(uint64_t bits) { return __builtin_bswap64(bits); }
+
+template<typename T, bool littleEndian>
+static inline T loadFromBuffer(const uint8_t* data)
+{
+    typename BufferBitsForSize<sizeof(T)>::type bits;
+    memcpy(&bits, data, sizeof(T));
+    if constexpr (littleEndian != hostIsLittleEndian)
+        bits = byteSwap(bits);
+    return bitwise_cast<T>(bits);
+}
+
+template<typename T, bool littleEndian>
+static inline void storeToBuffer(uint8_t* data, T value)
+{
+    auto bits = bitwise_cast<typename BufferBitsForSize<sizeof(T)>::type>(value);
+    if constexpr (littleEndian != hostIsLittleEndian)
+        bits = byteSwap(bits);
+    memcpy(data, &bits, sizeof(T));
+}
+
+template<typename T>
+static inline JSC::JSValue bufferValueToJS(JSC::JSGlobalObject* lexicalGlobalObject, T value)
+{
+    if constexpr (std::is_floating_point_v<T>)
+        return JSC::jsNumber(JSC::purifyNaN(static_cast<double>(value)));
+    else if constexpr (sizeof(T) == 8)
+        return JSC::JSValue(JSC::JSBigInt::createFrom(lexicalGlobalObject, value));
+    else
+        return JSC::jsNumber(static_cast<std::conditional_t<std::is_signed_v<T>, int32_t, uint32_t>>(value));
+}
+
+// Integers wrap and floats round, the same as the DataView setters did.
+template<typename T>
+static inline T bufferValueFromJS(JSC::JSGlobalObject* lexicalGlobalObject, JSC::JSValue value)
+{
+    if constexpr (std::is_floating_point_v<T>)
+        return static_cast<T>(value.toNumber(lexicalGlobalObject));
+    else if constexpr (std::is_same_v<T, int64_t>)
+        return value.toBigInt64(lexicalGlobalObject);
+    else if constexpr (std::is_same_v<T, uint64_t>)
+        return value.toBigUInt64(lexicalGlobalObject);
+    else if constexpr (std::is_signed_v<T>)
+        return static_cast<T>(value.toInt32(lexicalGlobalObject));
+    else
+        return static_cast<T>(value.toUInt32(lexicalGlobalObject));
+}
+
+static void throwBufferOffsetOutOfRange(JSC::JSGlobalObject* lexicalGlobalObject, JSC::ThrowScope& throwScope, size_t byteLength, size_t size)
+{
+    if (byteLength < size)
+        throwRangeError(lexicalGlobalObject, throwScope, "Attempt to access memory outside buffer bounds"_s);
+    else
+        throwRangeError(lexicalGlobalObject, throwScope, makeString("The value of \"offset\" is out of range. It must be >= 0 and <= "_s, byteLength - size));
+}
+
+// Like Node.js, the offset defaults to 0 and must be an integer that leaves
+// room for the value. Unlike DataView, it is not coerced from other types.
+template<typename T>
+static inline std::optional<size_t> bufferOffsetArgument(JSC::JSGlobalObject* lexicalGlobalObject, JSC::ThrowScope& throwScope, JSC::JSUint8Array* castedThis, JSC::JSValue offsetValue)
+{
+    size_t byteLength = castedThis->byteLength();
+    double offset = 0;
+    if (offsetValue.isInt32()) {
+        offset = offsetValue.asInt32();
+    } else if (offsetValue.isNumber()) {
+        offset = offsetValue.asNumber();
+        if (offset != std::trunc(offset)) {
+            throwRangeError(lexicalGlobalObject, throwScope, "The value of \"offset\" must be an integer"_s);
+            return std::nullopt;
+        }
+    } else if (!offsetValue.isUndefined()) {
+        throwTypeError(lexicalGlobalObject, throwScope, "The \"offset\" argument must be of type number"_s);
+        return std::nullopt;
+    }
+
+    if (offset < 0 || byteLength < sizeof(T) || offset > byteLength - sizeof(T)) {
+        throwBufferOffsetOutOfRange(lexicalGlobalObject, throwScope, byteLength, sizeof(T));
+        return std::nullopt;
+    }
+
+    return static_cast<size_t>(offset);
+}
+
+template<typename T, bool littleEndian>
+static inline JSC::EncodedJSValue jsBufferPrototypeFunction_readNumberBody(JSC::JSGlobalObject* lexicalGlobalObject, JSC::CallFrame* callFrame, typename IDLOperation<JSBuffer>::ClassParameter castedThis)
+{
+    auto& vm = JSC::getVM(lexicalGlobalObject);
+    auto throwScope = DECLARE_THROW_SCOPE(vm);
+    auto offset = bufferOffsetArgument<T>(lexicalGlobalObject, throwScope, castedThis, callFrame->argument(0));
+    if (!offset)
+        return JSC::JSValue::encode({});
+
+    RELEASE_AND_RETURN(throwScope, JSC::JSValue::encode(bufferValueToJS(lexicalGlobalObject, loadFromBuffer<T, littleEndian>(castedThis->typedVector() + *offset))));
+}
+
+template<typename T, bool littleEndian>
+static inline JSC::EncodedJSValue jsBufferPrototypeFunction_writeNumberBody(JSC::JSGlobalObject* lexicalGlobalObject, JSC::CallFrame* callFrame, typename IDLOperation<JSBuffer>::ClassParameter castedThis)
+{
+    auto& vm = JSC::getVM(lexicalGlobalObject);
+    auto throwScope = DECLARE_THROW_SCOPE(vm);
+
+    // Convert the value first: valueOf() may run user code that shrinks or
+    // detaches the buffer, so the offset is checked against what is left.
+    T value = bufferValueFromJS<T>(lexicalGlobalObject, callFrame->argument(0));
+    RETURN_IF_EXCEPTION(throwScope, JSC::JSValue::encode({}));
+    auto offset = bufferOffsetArgument<T>(lexicalGlobalObject, throwScope, castedThis, callFrame->argument(1));
+    if (!offset)
+        return JSC::JSValue::encode({});
+
+    storeToBuffer<T, littleEndian>(castedThis->typedVector() + *offset, value);
+    return JSC::JSValue::encode(JSC::jsNumber(*offset + sizeof(T)));
+}
+
+template<typename T, bool littleEndian>
+static inline JSC::EncodedJSValue jsBufferReadWithoutTypeCheck(JSC::JSGlobalObject* lexicalGlobalObject, JSC::VM& vm, JSC::JSUint8Array* castedThis, int32_t offset)
+{
+    size_t byteLength = castedThis->byteLength();
+    if (UNLIKELY(offset < 0 || byteLength < sizeof(T) || static_cast<size_t>(offset) > byteLength - sizeof(T))) {
+        auto throwScope = DECLARE_THROW_SCOPE(vm);
+        throwBufferOffsetOutOfRange(lexicalGlobalObject, throwScope, byteLength, sizeof(T));
+        return JSC::JSValue::encode({});
+    }
+
+    return JSC::JSValue::encode(bufferValueToJS(lexicalGlobalObject, loadFromBuffer<T, littleEndian>(castedThis->typedVector() + offset)));
+}
+
+template<typename T, bool littleEndian>
+static inline JSC::EncodedJSValue jsBufferWriteWithoutTypeCheck(JSC::JSGlobalObject* lexicalGlobalObject, JSC::VM& vm, JSC::JSUint8Array* castedThis, int32_t value, int32_t offset)
+{
+    size_t byteLength = castedThis->byteLength();
+    if (UNLIKELY(offset < 0 || byteLength < sizeof(T) || static_cast<size_t>(offset) > byteLength - sizeof(T))) {
+        auto throwScope = DECLARE_THROW_SCOPE(vm);
+        throwBufferOffsetOutOfRange(lexicalGlobalObject, throwScope, byteLength, sizeof(T));
+        return JSC::JSValue::encode({});
+    }
+
+    storeToBuffer<T, littleEndian>(castedThis->typedVector() + offset, static_cast<T>(value));
+    return JSC::JSValue::encode(JSC::jsNumber(static_cast<size_t>(offset) + sizeof(T)));
+}
+
+// Reading the bytes of a typed array is what GetByVal on one reads, and
+// writing them is what PutByVal writes, so the DFG can still hoist and
+// eliminate these calls around unrelated code.
+constexpr JSC::DFG::AbstractHeapKind bufferReadKinds[4] = { JSC::DFG::MiscFields, JSC::DFG::TypedArrayProperties };
+constexpr JSC::DFG::AbstractHeapKind bufferWriteKinds[4] = { JSC::DFG::TypedArrayProperties };
+constexpr JSC::DFG::AbstractHeapKind bufferNoKinds[4] = {};
+
+// ResultType is the IDL type matching what the read returns, which tells the
+// DFG e.g. that readInt16LE() is always an int32.
+#define DEFINE_BUFFER_READ_FUNCTION(name, T, littleEndian, ResultType) \
+    static JSC_DECLARE_HOST_FUNCTION(jsBufferPrototypeFunction_##name); \
+    JSC_DEFINE_HOST_FUNCTION(jsBufferPrototypeFunction_##name, (JSGlobalObject * lexicalGlobalObject, CallFrame * callFrame)) \
+    { \
+        return IDLOperation<JSBuffer>::call<jsBufferPrototypeFunction_readNumberBody<T, littleEndian>>(*lexicalGlobalObject, *callFrame, #name); \
+    } \
+    static JSC_DECLARE_JIT_OPERATION_WITHOUT_WTF_INTERNAL(jsBufferPrototypeFunction_##name##WithoutTypeCheck, JSC::EncodedJSValue, (JSC::JSGlobalObject*, JSC::JSUint8Array*, DOMJIT::IDLJSArgumentType<IDLLong>)); \
+    JSC_DEFINE_JIT_OPERATION(jsBufferPrototypeFunction_##name##WithoutTypeCheck, JSC::EncodedJSValue, (JSC::JSGlobalObject * lexicalGlobalObject, JSC::JSUint8Array * castedThis, DOMJIT::IDLJSArgumentType<IDLLong> offset)) \
+    { \
+        VM& vm = JSC::getVM(lexicalGlobalObject); \
+        IGNORE_WARNINGS_BEGIN("frame-address") \
+        CallFrame* callFrame = DECLARE_CALL_FRAME(vm); \
+        IGNORE_WARNINGS_END \
+        JSC::JITOperationPrologueCallFrameTracer tracer(vm, callFrame); \
+        return jsBufferReadWithoutTypeCheck<T, littleEndian>(lexicalGlobalObject, vm, castedThis, offset); \
+    } \
+    static const JSC::DOMJIT::Signature DOMJITSignatureForJSBuffer_##name( \
+        jsBufferPrototypeFunction_##name##WithoutTypeCheck, \
+        JSC::JSUint8Array::info(), \
+        JSC::DOMJIT::Effect::forReadWriteKinds(bufferReadKinds, bufferNoKinds), \
+        DOMJIT::IDLResultTypeFilter<ResultType>::value, \
+        DOMJIT::IDLArgumentTypeFilter<IDLLong>::value);
+
+#define DEFINE_BUFFER_WRITE_FUNCTION(name, T, littleEndian) \
+    static JSC_DECLARE_HOST_FUNCTION(jsBufferPrototypeFunction_##name); \
+    JSC_DEFINE_HOST_FUNCTION(jsBufferPrototypeFunction_##name, (JSGlobalObject * lexicalGlobalObject, CallFrame * callFrame)) \
+    { \
+        return IDLOperation<JSBuffer>::call<jsBufferPrototypeFunction_writeNumberBody<T, littleEndian>>(*lexicalGlobalObject, *callFrame, #name); \
+    }
+
+// Only for values that always fit in an int32; the rest have no DOMJIT
+// argument type to speculate on.
+#define DEFINE_BUFFER_INT32_WRITE_FUNCTION(name, T, littleEndian) \
+    DEFINE_BUFFER_WRITE_FUNCTION(name, T, littleEndian) \
+    static JSC_DECLARE_JIT_OPERATION_WITHOUT_WTF_INTERNAL(jsBufferPrototypeFunction_##name##WithoutTypeCheck, JSC::EncodedJSValue, (JSC::JSGlobalObject*, JSC::JSUint8Array*, DOMJIT::IDLJSArgumentType<IDLLong>, DOMJIT::IDLJSArgumentType<IDLLong>)); \
+    JSC_DEFINE_JIT_OPERATION(jsBufferPrototypeFunction_##name##WithoutTypeCheck, JSC::EncodedJSValue, (JSC::JSGlobalObject * lexicalGlobalObject, JSC::JSUint8Array * castedThis, DOMJIT::IDLJSArgumentType<IDLLong> value, DOMJIT::IDLJSArgumentType<IDLLong> offset)) \
+    { \
+        VM& vm = JSC::getVM(lexicalGlobalObject); \
+        IGNORE_WARNINGS_BEGIN("frame-address") \
+        CallFrame* callFrame = DECLARE_CALL_FRAME(vm); \
+        IGNORE_WARNINGS_END \
+        JSC::JITOperationPrologueCallFrameTracer tracer(vm, callFrame); \
+        return jsBufferWriteWithoutTypeCheck<T, littleEndian>(lexicalGlobalObject, vm, castedThis, value, offset); \
+    } \
+    static const JSC::DOMJIT::Signature DOMJITSignatureForJSBuffer_##name( \
+        jsBufferPrototypeFunction_##name##WithoutTypeCheck, \
+        JSC::JSUint8Array::info(), \
+        JSC::DOMJIT::Effect::forReadWriteKinds(bufferReadKinds, bufferWriteKinds), \
+        DOMJIT::IDLResultTypeFilter<IDLUnsignedLong>::value, \
+        DOMJIT::IDLArgumentTypeFilter<IDLLong>::value, \
+        DOMJIT::IDLArgumentTypeFilter<IDLLong>::value);
+
+DEFINE_BUFFER_READ_FUNCTION(readInt8, int8_t, true, IDLByte)
+DEFINE_BUFFER_READ_FUNCTION(readUInt8, uint8_t, true, IDLOctet)
+DEFINE_BUFFER_READ_FUNCTION(readInt16LE, int16_t, true, IDLShort)
+DEFINE_BUFFER_READ_FUNCTION(readInt16BE, int16_t, false, IDLShort)
+DEFINE_BUFFER_READ_FUNCTION(readUInt16LE, uint16_t, true, IDLUnsignedShort)
+DEFINE_BUFFER_READ_FUNCTION(readUInt16BE, uint16_t, false, IDLUnsignedShort)
+DEFINE_BUFFER_READ_FUNCTION(readInt32LE, int32_t, true, IDLLong)
+DEFINE_BUFFER_READ_FUNCTION(readInt32BE, int32_t, false, IDLLong)
+DEFINE_BUFFER_READ_FUNCTION(readUInt32LE, uint32_t, true, IDLUnsignedLong)
+DEFINE_BUFFER_READ_FUNCTION(readUInt32BE, uint32_t, false, IDLUnsignedLong)
+DEFINE_BUFFER_READ_FUNCTION(readFloatLE, float, true, IDLUnrestrictedFloat)
+DEFINE_BUFFER_READ_FUNCTION(readFloatBE, float, false, IDLUnrestrictedFloat)
+DEFINE_BUFFER_READ_FUNCTION(readDoubleLE, double, true, IDLUnrestrictedDouble)
+DEFINE_BUFFER_READ_FUNCTION(readDoubleBE, double, false, IDLUnrestrictedDouble)
+DEFINE_BUFFER_READ_FUNCTION(readBigInt64LE, int64_t, true, IDLAny)
+DEFINE_BUFFER_READ_FUNCTION(readBigInt64BE, int64_t, false, IDLAny)
+DEFINE_BUFFER_READ_FUNCTION(readBigUInt64LE, uint64_t, true, IDLAny)
+DEFINE_BUFFER_READ_FUNCTION(readBigUInt64BE, uint64_t, false, IDLAny)
+
+DEFINE_BUFFER_INT32_WRITE_FUNCTION(writeInt8, int8_t, true)
+DEFINE_BUFFER_INT32_WRITE_FUNCTION(writeUInt8, uint8_t, true)
+DEFINE_BUFFER_INT32_WRITE_FUNCTION(writeInt16LE, int16_t, true)
+DEFINE_BUFFER_INT32_WRITE_FUNCTION(writeInt16BE, int16_t, false)
+DEFINE_BUFFER_INT32_WRITE_FUNCTION(writeUInt16LE, uint16_t, true)
+DEFINE_BUFFER_INT32_WRITE_FUNCTION(writeUInt16BE, uint16_t, false)
+DEFINE_BUFFER_INT32_WRITE_FUNCTION(writeInt32LE, int32_t, true)
+DEFINE_BUFFER_INT32_WRITE_FUNCTION(writeInt32BE, int32_t, false)
+DEFINE_BUFFER_WRITE_FUNCTION(writeUInt32LE, uint32_t, true)
+DEFINE_BUFFER_WRITE_FUNCTION(writeUInt32BE, uint32_t, false)
+DEFINE_BUFFER_WRITE_FUNCTION(writeFloatLE, float, true)
+DEFINE_BUFFER_WRITE_FUNCTION(writeFloatBE, float, false)
+DEFINE_BUFFER_WRITE_FUNCTION(writeDoubleLE, double, true)
+DEFINE_BUFFER_WRITE_FUNCTION(writeDoubleBE, double, false)
+DEFINE_BUFFER_WRITE_FUNCTION(writeBigInt64LE, int64_t, true)
+DEFINE_BUFFER_WRITE_FUNCTION(writeBigInt64BE, int64_t, false)
+DEFINE_BUFFER_WRITE_FUNCTION(writeBigUInt64LE, uint64_t, true)
+DEFINE_BUFFER_WRITE_FUNCTION(writeBigUInt64BE, uint64_t, false)
+
+#undef DEFINE_BUFFER_INT32_WRITE_FUNCTION
+#undef DEFINE_BUFFER_WRITE_FUNCTION
+#undef DEFINE_BUFFER_READ_FUNCTION
+
 /* */
 
 /* Hash table for prototype */
@@ -1462,35 +1824,35 @@ static const HashTableValue JSBufferPrototypeTableValues[]
           { "lastIndexOf"_s, static_cast<unsigned>(JSC::PropertyAttribute::Function), NoIntrinsic, { HashTableValue::NativeFunctionType, jsBufferPrototypeFunction_lastIndexOf, 3 } },
           { "latin1Slice"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Builtin), NoIntrinsic, { HashTableValue::BuiltinGeneratorType, jsBufferPrototypeLatin1SliceCodeGenerator, 2 } },
           { "latin1Write"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Builtin), NoIntrinsic, { HashTableValue::BuiltinGeneratorType, jsBufferPrototypeLatin1WriteCodeGenerator, 1 } },
-          { "readBigInt64"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Builtin), NoIntrinsic, { HashTableValue::BuiltinGeneratorType, jsBufferPrototypeReadBigInt64LECodeGenerator, 1 } },
-          { "readBigInt64BE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Builtin), NoIntrinsic, { HashTableValue::BuiltinGeneratorType, jsBufferPrototypeReadBigInt64BECodeGenerator, 1 } },
-          { "readBigInt64LE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Builtin), NoIntrinsic, { HashTableValue::BuiltinGeneratorType, jsBufferPrototypeReadBigInt64LECodeGenerator, 1 } },
-          { "readBigUInt64"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Builtin), NoIntrinsic, { HashTableValue::BuiltinGeneratorType, jsBufferPrototypeReadBigUInt64LECodeGenerator, 1 } },
-          { "readBigUInt64BE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Builtin), NoIntrinsic, { HashTableValue::BuiltinGeneratorType, jsBufferPrototypeReadBigUInt64BECodeGenerator, 1 } },
-          { "readBigUInt64LE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Builtin), NoIntrinsic, { HashTableValue::BuiltinGeneratorType, jsBufferPrototypeReadBigUInt64LECodeGenerator, 1 } },
-          { "readDouble"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Builtin), NoIntrinsic, { HashTableValue::BuiltinGeneratorType, jsBufferPrototypeReadDoubleLECodeGenerator, 1 } },
-          { "readDoubleBE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Builtin), NoIntrinsic, { HashTableValue::BuiltinGeneratorType, jsBufferPrototypeReadDoubleBECodeGenerator, 1 } },
-          { "readDoubleLE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Builtin), NoIntrinsic, { HashTableValue::BuiltinGeneratorType, jsBufferPrototypeReadDoubleLECodeGenerator, 1 } },
-          { "readFloat"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Builtin), NoIntrinsic, { HashTableValue::BuiltinGeneratorType, jsBufferPrototypeReadFloatLECodeGenerator, 1 } },
-          { "readFloatBE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Builtin), NoIntrinsic, { HashTableValue::BuiltinGeneratorType, jsBufferPrototypeReadFloatBECodeGenerator, 1 } },
-          { "readFloatLE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Builtin), NoIntrinsic, { HashTableValue::BuiltinGeneratorType, jsBufferPrototypeReadFloatLECodeGenerator, 1 } },
-          { "readInt16"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Builtin), NoIntrinsic, { HashTableValue::BuiltinGeneratorType, jsBufferPrototypeReadInt16LECodeGenerator, 1 } },
-          { "readInt16BE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Builtin), NoIntrinsic, { HashTableValue::BuiltinGeneratorType, jsBufferPrototypeReadInt16BECodeGenerator, 1 } },
-          { "readInt16LE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Builtin), NoIntrinsic, { HashTableValue::BuiltinGeneratorType, jsBufferPrototypeReadInt16LECodeGenerator, 1 } },
-          { "readInt32"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Builtin), NoIntrinsic, { HashTableValue::BuiltinGeneratorType, jsBufferPrototypeReadInt32LECodeGenerator, 1 } },
-          { "readInt32BE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Builtin), NoIntrinsic, { HashTableValue::BuiltinGeneratorType, jsBufferPrototypeReadInt32BECodeGenerator, 1 } },
-          { "readInt32LE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Builtin), NoIntrinsic, { HashTableValue::BuiltinGeneratorType, jsBufferPrototypeReadInt32LECodeGenerator, 1 } },
-          { "readInt8"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Builtin), NoIntrinsic, { HashTableValue::BuiltinGeneratorType, jsBufferPrototypeReadInt8CodeGenerator, 2 } },
-          { "readUInt16BE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Builtin), NoIntrinsic, { HashTableValue::BuiltinGeneratorType, jsBufferPrototypeReadUInt16BECodeGenerator, 1 } },
-          { "readUInt16LE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Builtin), NoIntrinsic, { HashTableValue::BuiltinGeneratorType, jsBufferPrototypeReadUInt16LECodeGenerator, 1 } },
-          { "readUInt32BE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Builtin), NoIntrinsic, { HashTableValue::BuiltinGeneratorType, jsBufferPrototypeReadUInt32BECodeGenerator, 1 } },
-          { "readUInt32LE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Builtin), NoIntrinsic, { HashTableValue::BuiltinGeneratorType, jsBufferPrototypeReadUInt32LECodeGenerator, 1 } },
-          { "readUInt8"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Builtin), NoIntrinsic, { HashTableValue::BuiltinGeneratorType, jsBufferPrototypeReadUInt8CodeGenerator, 1 } },
-          { "readUint16BE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Builtin), NoIntrinsic, { HashTableValue::BuiltinGeneratorType, jsBufferPrototypeReadUInt16BECodeGenerator, 1 } },
-          { "readUint16LE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Builtin), NoIntrinsic, { HashTableValue::BuiltinGeneratorType, jsBufferPrototypeReadUInt16LECodeGenerator, 1 } },
-          { "readUint32BE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Builtin), NoIntrinsic, { HashTableValue::BuiltinGeneratorType, jsBufferPrototypeReadUInt32BECodeGenerator, 1 } },
-          { "readUint32LE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Builtin), NoIntrinsic, { HashTableValue::BuiltinGeneratorType, jsBufferPrototypeReadUInt32LECodeGenerator, 1 } },
-          { "readUint8"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Builtin), NoIntrinsic, { HashTableValue::BuiltinGeneratorType, jsBufferPrototypeReadUInt8CodeGenerator, 1 } },
+          { "readBigInt64"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Function | JSC::PropertyAttribute::DOMJITFunction), NoIntrinsic, { HashTableValue::DOMJITFunctionType, jsBufferPrototypeFunction_readBigInt64LE, &DOMJITSignatureForJSBuffer_readBigInt64LE } },
+          { "readBigInt64BE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Function | JSC::PropertyAttribute::DOMJITFunction), NoIntrinsic, { HashTableValue::DOMJITFunctionType, jsBufferPrototypeFunction_readBigInt64BE, &DOMJITSignatureForJSBuffer_readBigInt64BE } },
+          { "readBigInt64LE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Function | JSC::PropertyAttribute::DOMJITFunction), NoIntrinsic, { HashTableValue::DOMJITFunctionType, jsBufferPrototypeFunction_readBigInt64LE, &DOMJITSignatureForJSBuffer_readBigInt64LE } },
+          { "readBigUInt64"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Function | JSC::PropertyAttribute::DOMJITFunction), NoIntrinsic, { HashTableValue::DOMJITFunctionType, jsBufferPrototypeFunction_readBigUInt64LE, &DOMJITSignatureForJSBuffer_readBigUInt64LE } },
+          { "readBigUInt64BE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Function | JSC::PropertyAttribute::DOMJITFunction), NoIntrinsic, { HashTableValue::DOMJITFunctionType, jsBufferPrototypeFunction_readBigUInt64BE, &DOMJITSignatureForJSBuffer_readBigUInt64BE } },
+          { "readBigUInt64LE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Function | JSC::PropertyAttribute::DOMJITFunction), NoIntrinsic, { HashTableValue::DOMJITFunctionType, jsBufferPrototypeFunction_readBigUInt64LE, &DOMJITSignatureForJSBuffer_readBigUInt64LE } },
+          { "readDouble"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Function | JSC::PropertyAttribute::DOMJITFunction), NoIntrinsic, { HashTableValue::DOMJITFunctionType, jsBufferPrototypeFunction_readDoubleLE, &DOMJITSignatureForJSBuffer_readDoubleLE } },
+          { "readDoubleBE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Function | JSC::PropertyAttribute::DOMJITFunction), NoIntrinsic, { HashTableValue::DOMJITFunctionType, jsBufferPrototypeFunction_readDoubleBE, &DOMJITSignatureForJSBuffer_readDoubleBE } },
+          { "readDoubleLE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Function | JSC::PropertyAttribute::DOMJITFunction), NoIntrinsic, { HashTableValue::DOMJITFunctionType, jsBufferPrototypeFunction_readDoubleLE, &DOMJITSignatureForJSBuffer_readDoubleLE } },
+          { "readFloat"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Function | JSC::PropertyAttribute::DOMJITFunction), NoIntrinsic, { HashTableValue::DOMJITFunctionType, jsBufferPrototypeFunction_readFloatLE, &DOMJITSignatureForJSBuffer_readFloatLE } },
+          { "readFloatBE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Function | JSC::PropertyAttribute::DOMJITFunction), NoIntrinsic, { HashTableValue::DOMJITFunctionType, jsBufferPrototypeFunction_readFloatBE, &DOMJITSignatureForJSBuffer_readFloatBE } },
+          { "readFloatLE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Function | JSC::PropertyAttribute::DOMJITFunction), NoIntrinsic, { HashTableValue::DOMJITFunctionType, jsBufferPrototypeFunction_readFloatLE, &DOMJITSignatureForJSBuffer_readFloatLE } },
+          { "readInt16"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Function | JSC::PropertyAttribute::DOMJITFunction), NoIntrinsic, { HashTableValue::DOMJITFunctionType, jsBufferPrototypeFunction_readInt16LE, &DOMJITSignatureForJSBuffer_readInt16LE } },
+          { "readInt16BE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Function | JSC::PropertyAttribute::DOMJITFunction), NoIntrinsic, { HashTableValue::DOMJITFunctionType, jsBufferPrototypeFunction_readInt16BE, &DOMJITSignatureForJSBuffer_readInt16BE } },
+          { "readInt16LE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Function | JSC::PropertyAttribute::DOMJITFunction), NoIntrinsic, { HashTableValue::DOMJITFunctionType, jsBufferPrototypeFunction_readInt16LE, &DOMJITSignatureForJSBuffer_readInt16LE } },
+          { "readInt32"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Function | JSC::PropertyAttribute::DOMJITFunction), NoIntrinsic, { HashTableValue::DOMJITFunctionType, jsBufferPrototypeFunction_readInt32LE, &DOMJITSignatureForJSBuffer_readInt32LE } },
+          { "readInt32BE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Function | JSC::PropertyAttribute::DOMJITFunction), NoIntrinsic, { HashTableValue::DOMJITFunctionType, jsBufferPrototypeFunction_readInt32BE, &DOMJITSignatureForJSBuffer_readInt32BE } },
+          { "readInt32LE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Function | JSC::PropertyAttribute::DOMJITFunction), NoIntrinsic, { HashTableValue::DOMJITFunctionType, jsBufferPrototypeFunction_readInt32LE, &DOMJITSignatureForJSBuffer_readInt32LE } },
+          { "readInt8"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Function | JSC::PropertyAttribute::DOMJITFunction), NoIntrinsic, { HashTableValue::DOMJITFunctionType, jsBufferPrototypeFunction_readInt8, &DOMJITSignatureForJSBuffer_readInt8 } },
+          { "readUInt16BE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Function | JSC::PropertyAttribute::DOMJITFunction), NoIntrinsic, { HashTableValue::DOMJITFunctionType, jsBufferPrototypeFunction_readUInt16BE, &DOMJITSignatureForJSBuffer_readUInt16BE } },
+          { "readUInt16LE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Function | JSC::PropertyAttribute::DOMJITFunction), NoIntrinsic, { HashTableValue::DOMJITFunctionType, jsBufferPrototypeFunction_readUInt16LE, &DOMJITSignatureForJSBuffer_readUInt16LE } },
+          { "readUInt32BE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Function | JSC::PropertyAttribute::DOMJITFunction), NoIntrinsic, { HashTableValue::DOMJITFunctionType, jsBufferPrototypeFunction_readUInt32BE, &DOMJITSignatureForJSBuffer_readUInt32BE } },
+          { "readUInt32LE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Function | JSC::PropertyAttribute::DOMJITFunction), NoIntrinsic, { HashTableValue::DOMJITFunctionType, jsBufferPrototypeFunction_readUInt32LE, &DOMJITSignatureForJSBuffer_readUInt32LE } },
+          { "readUInt8"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Function | JSC::PropertyAttribute::DOMJITFunction), NoIntrinsic, { HashTableValue::DOMJITFunctionType, jsBufferPrototypeFunction_readUInt8, &DOMJITSignatureForJSBuffer_readUInt8 } },
+          { "readUint16BE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Function | JSC::PropertyAttribute::DOMJITFunction), NoIntrinsic, { HashTableValue::DOMJITFunctionType, jsBufferPrototypeFunction_readUInt16BE, &DOMJITSignatureForJSBuffer_readUInt16BE } },
+          { "readUint16LE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Function | JSC::PropertyAttribute::DOMJITFunction), NoIntrinsic, { HashTableValue::DOMJITFunctionType, jsBufferPrototypeFunction_readUInt16LE, &DOMJITSignatureForJSBuffer_readUInt16LE } },
+          { "readUint32BE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Function | JSC::PropertyAttribute::DOMJITFunction), NoIntrinsic, { HashTableValue::DOMJITFunctionType, jsBufferPrototypeFunction_readUInt32BE, &DOMJITSignatureForJSBuffer_readUInt32BE } },
+          { "readUint32LE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Function | JSC::PropertyAttribute::DOMJITFunction), NoIntrinsic, { HashTableValue::DOMJITFunctionType, jsBufferPrototypeFunction_readUInt32LE, &DOMJITSignatureForJSBuffer_readUInt32LE } },
+          { "readUint8"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Function | JSC::PropertyAttribute::DOMJITFunction), NoIntrinsic, { HashTableValue::DOMJITFunctionType, jsBufferPrototypeFunction_readUInt8, &DOMJITSignatureForJSBuffer_readUInt8 } },
           { "slice"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Builtin), NoIntrinsic, { HashTableValue::BuiltinGeneratorType, jsBufferPrototypeSliceCodeGenerator, 2 } },
           { "subarray"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Builtin), NoIntrinsic, { HashTableValue::BuiltinGeneratorType, jsBufferPrototypeSliceCodeGenerator, 2 } },
           { "swap16"_s, static_cast<unsigned>(JSC::PropertyAttribute::Function), NoIntrinsic, { HashTableValue::NativeFunctionType, jsBufferPrototypeFunction_swap16, 0 } },
@@ -1505,37 +1867,37 @@ static const HashTableValue JSBufferPrototypeTableValues[]
           { "utf8Slice"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Builtin), NoIntrinsic, { HashTableValue::BuiltinGeneratorType, jsBufferPrototypeUtf8SliceCodeGenerator, 2 } },
           { "utf8Write"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Builtin), NoIntrinsic, { HashTableValue::BuiltinGeneratorType, jsBufferPrototypeUtf8WriteCodeGenerator, 1 } },
           { "write"_s, static_cast<unsigned>(JSC::PropertyAttribute::Function), NoIntrinsic, { HashTableValue::NativeFunctionType, jsBufferPrototypeFunction_write, 4 } },
-          { "writeBigInt64BE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Builtin), NoIntrinsic, { HashTableValue::BuiltinGeneratorType, jsBufferPrototypeWriteBigInt64BECodeGenerator, 1 } },
-          { "writeBigInt64LE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Builtin), NoIntrinsic, { HashTableValue::BuiltinGeneratorType, jsBufferPrototypeWriteBigInt64LECodeGenerator, 1 } },
-          { "writeBigUInt64BE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Builtin), NoIntrinsic, { HashTableValue::BuiltinGeneratorType, jsBufferPrototypeWriteBigUInt64BECodeGenerator, 1 } },
-          { "writeBigUInt64LE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Builtin), NoIntrinsic, { HashTableValue::BuiltinGeneratorType, jsBufferPrototypeWriteBigUInt64LECodeGenerator, 1 } },
-          { "writeBigUint64BE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Builtin), NoIntrinsic, { HashTableValue::BuiltinGeneratorType, jsBufferPrototypeWriteBigUInt64BECodeGenerator, 1 } },
-          { "writeBigUint64LE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Builtin), NoIntrinsic, { HashTableValue::BuiltinGeneratorType, jsBufferPrototypeWriteBigUInt64LECodeGenerator, 1 } },
-          { "writeDouble"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Builtin), NoIntrinsic, { HashTableValue::BuiltinGeneratorType, jsBufferPrototypeWriteDoubleLECodeGenerator, 1 } },
-          { "writeDoubleBE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Builtin), NoIntrinsic, { HashTableValue::BuiltinGeneratorType, jsBufferPrototypeWriteDoubleBECodeGenerator, 1 } },
-          { "writeDoubleLE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Builtin), NoIntrinsic, { HashTableValue::BuiltinGeneratorType, jsBufferPrototypeWriteDoubleLECodeGenerator, 1 } },
-          { "writeFloat"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Builtin), NoIntrinsic, { HashTableValue::BuiltinGeneratorType, jsBufferPrototypeWriteFloatLECodeGenerator, 1 } },
-          { "writeFloatBE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Builtin), NoIntrinsic, { HashTableValue::BuiltinGeneratorType, jsBufferPrototypeWriteFloatBECodeGenerator, 1 } },
-          { "writeFloatLE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Builtin), NoIntrinsic, { HashTableValue::BuiltinGeneratorType, jsBufferPrototypeWriteFloatLECodeGenerator, 1 } },
-          { "writeInt16BE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Builtin), NoIntrinsic, { HashTableValue::BuiltinGeneratorType, jsBufferPrototypeWriteInt16BECodeGenerator, 1 } },
-          { "writeInt16LE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Builtin), NoIntrinsic, { HashTableValue::BuiltinGeneratorType, jsBufferPrototypeWriteInt16LECodeGenerator, 1 } },
-          { "writeInt32BE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Builtin), NoIntrinsic, { HashTableValue::BuiltinGeneratorType, jsBufferPrototypeWriteInt32BECodeGenerator, 1 } },
-          { "writeInt32LE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Builtin), NoIntrinsic, { HashTableValue::BuiltinGeneratorType, jsBufferPrototypeWriteInt32LECodeGenerator, 1 } },
-          { "writeInt8"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Builtin), NoIntrinsic, { HashTableValue::BuiltinGeneratorType, jsBufferPrototypeWriteInt8CodeGenerator, 1 } },
-          { "writeUInt16"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Builtin), NoIntrinsic, { HashTableValue::BuiltinGeneratorType, jsBufferPrototypeWriteUInt16LECodeGenerator, 1 } },
-          { "writeUInt16BE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Builtin), NoIntrinsic, { HashTableValue::BuiltinGeneratorType, jsBufferPrototypeWriteUInt16BECodeGenerator, 1 } },
-          { "writeUInt16LE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Builtin), NoIntrinsic, { HashTableValue::BuiltinGeneratorType, jsBufferPrototypeWriteUInt16LECodeGenerator, 1 } },
-          { "writeUInt32"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Builtin), NoIntrinsic, { HashTableValue::BuiltinGeneratorType, jsBufferPrototypeWriteUInt32LECodeGenerator, 1 } },
-          { "writeUInt32BE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Builtin), NoIntrinsic, { HashTableValue::BuiltinGeneratorType, jsBufferPrototypeWriteUInt32BECodeGenerator, 1 } },
-          { "writeUInt32LE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Builtin), NoIntrinsic, { HashTableValue::BuiltinGeneratorType, jsBufferPrototypeWriteUInt32LECodeGenerator, 1 } },
-          { "writeUInt8"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Builtin), NoIntrinsic, { HashTableValue::BuiltinGeneratorType, jsBufferPrototypeWriteUInt8CodeGenerator, 1 } },
-          { "writeUint16"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Builtin), NoIntrinsic, { HashTableValue::BuiltinGeneratorType, jsBufferPrototypeWriteUInt16LECodeGenerator, 1 } },
-          { "writeUint16BE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Builtin), NoIntrinsic, { HashTableValue::BuiltinGeneratorType, jsBufferPrototypeWriteUInt16BECodeGenerator, 1 } },
-          { "writeUint16LE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Builtin), NoIntrinsic, { HashTableValue::BuiltinGeneratorType, jsBufferPrototypeWriteUInt16LECodeGenerator, 1 } },
-          { "writeUint32"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Builtin), NoIntrinsic, { HashTableValue::BuiltinGeneratorType, jsBufferPrototypeWriteUInt32LECodeGenerator, 1 } },
-          { "writeUint32BE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Builtin), NoIntrinsic, { HashTableValue::BuiltinGeneratorType, jsBufferPrototypeWriteUInt32BECodeGenerator, 1 } },
-          { "writeUint32LE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Builtin), NoIntrinsic, { HashTableValue::BuiltinGeneratorType, jsBufferPrototypeWriteUInt32LECodeGenerator, 1 } },
-          { "writeUint8"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Builtin), NoIntrinsic, { HashTableValue::BuiltinGeneratorType, jsBufferPrototypeWriteUInt8CodeGenerator, 1 } },
+          { "writeBigInt64BE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Function), NoIntrinsic, { HashTableValue::NativeFunctionType, jsBufferPrototypeFunction_writeBigInt64BE, 2 } },
+          { "writeBigInt64LE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Function), NoIntrinsic, { HashTableValue::NativeFunctionType, jsBufferPrototypeFunction_writeBigInt64LE, 2 } },
+          { "writeBigUInt64BE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Function), NoIntrinsic, { HashTableValue::NativeFunctionType, jsBufferPrototypeFunction_writeBigUInt64BE, 2 } },
+          { "writeBigUInt64LE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Function), NoIntrinsic, { HashTableValue::NativeFunctionType, jsBufferPrototypeFunction_writeBigUInt64LE, 2 } },
+          { "writeBigUint64BE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Function), NoIntrinsic, { HashTableValue::NativeFunctionType, jsBufferPrototypeFunction_writeBigUInt64BE, 2 } },
+          { "writeBigUint64LE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Function), NoIntrinsic, { HashTableValue::NativeFunctionType, jsBufferPrototypeFunction_writeBigUInt64LE, 2 } },
+          { "writeDouble"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Function), NoIntrinsic, { HashTableValue::NativeFunctionType, jsBufferPrototypeFunction_writeDoubleLE, 2 } },
+          { "writeDoubleBE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Function), NoIntrinsic, { HashTableValue::NativeFunctionType, jsBufferPrototypeFunction_writeDoubleBE, 2 } },
+          { "writeDoubleLE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Function), NoIntrinsic, { HashTableValue::NativeFunctionType, jsBufferPrototypeFunction_writeDoubleLE, 2 } },
+          { "writeFloat"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Function), NoIntrinsic, { HashTableValue::NativeFunctionType, jsBufferPrototypeFunction_writeFloatLE, 2 } },
+          { "writeFloatBE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Function), NoIntrinsic, { HashTableValue::NativeFunctionType, jsBufferPrototypeFunction_writeFloatBE, 2 } },
+          { "writeFloatLE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Function), NoIntrinsic, { HashTableValue::NativeFunctionType, jsBufferPrototypeFunction_writeFloatLE, 2 } },
+          { "writeInt16BE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Function | JSC::PropertyAttribute::DOMJITFunction), NoIntrinsic, { HashTableValue::DOMJITFunctionType, jsBufferPrototypeFunction_writeInt16BE, &DOMJITSignatureForJSBuffer_writeInt16BE } },
+          { "writeInt16LE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Function | JSC::PropertyAttribute::DOMJITFunction), NoIntrinsic, { HashTableValue::DOMJITFunctionType, jsBufferPrototypeFunction_writeInt16LE, &DOMJITSignatureForJSBuffer_writeInt16LE } },
+          { "writeInt32BE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Function | JSC::PropertyAttribute::DOMJITFunction), NoIntrinsic, { HashTableValue::DOMJITFunctionType, jsBufferPrototypeFunction_writeInt32BE, &DOMJITSignatureForJSBuffer_writeInt32BE } },
+          { "writeInt32LE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Function | JSC::PropertyAttribute::DOMJITFunction), NoIntrinsic, { HashTableValue::DOMJITFunctionType, jsBufferPrototypeFunction_writeInt32LE, &DOMJITSignatureForJSBuffer_writeInt32LE } },
+          { "writeInt8"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Function | JSC::PropertyAttribute::DOMJITFunction), NoIntrinsic, { HashTableValue::DOMJITFunctionType, jsBufferPrototypeFunction_writeInt8, &DOMJITSignatureForJSBuffer_writeInt8 } },
+          { "writeUInt16"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Function | JSC::PropertyAttribute::DOMJITFunction), NoIntrinsic, { HashTableValue::DOMJITFunctionType, jsBufferPrototypeFunction_writeUInt16LE, &DOMJITSignatureForJSBuffer_writeUInt16LE } },
+          { "writeUInt16BE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Function | JSC::PropertyAttribute::DOMJITFunction), NoIntrinsic, { HashTableValue::DOMJITFunctionType, jsBufferPrototypeFunction_writeUInt16BE, &DOMJITSignatureForJSBuffer_writeUInt16BE } },
+          { "writeUInt16LE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Function | JSC::PropertyAttribute::DOMJITFunction), NoIntrinsic, { HashTableValue::DOMJITFunctionType, jsBufferPrototypeFunction_writeUInt16LE, &DOMJITSignatureForJSBuffer_writeUInt16LE } },
+          { "writeUInt32"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Function), NoIntrinsic, { HashTableValue::NativeFunctionType, jsBufferPrototypeFunction_writeUInt32LE, 2 } },
+          { "writeUInt32BE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Function), NoIntrinsic, { HashTableValue::NativeFunctionType, jsBufferPrototypeFunction_writeUInt32BE, 2 } },
+          { "writeUInt32LE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Function), NoIntrinsic, { HashTableValue::NativeFunctionType, jsBufferPrototypeFunction_writeUInt32LE, 2 } },
+          { "writeUInt8"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Function | JSC::PropertyAttribute::DOMJITFunction), NoIntrinsic, { HashTableValue::DOMJITFunctionType, jsBufferPrototypeFunction_writeUInt8, &DOMJITSignatureForJSBuffer_writeUInt8 } },
+          { "writeUint16"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Function | JSC::PropertyAttribute::DOMJITFunction), NoIntrinsic, { HashTableValue::DOMJITFunctionType, jsBufferPrototypeFunction_writeUInt16LE, &DOMJITSignatureForJSBuffer_writeUInt16LE } },
+          { "writeUint16BE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Function | JSC::PropertyAttribute::DOMJITFunction), NoIntrinsic, { HashTableValue::DOMJITFunctionType, jsBufferPrototypeFunction_writeUInt16BE, &DOMJITSignatureForJSBuffer_writeUInt16BE } },
+          { "writeUint16LE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Function | JSC::PropertyAttribute::DOMJITFunction), NoIntrinsic, { HashTableValue::DOMJITFunctionType, jsBufferPrototypeFunction_writeUInt16LE, &DOMJITSignatureForJSBuffer_writeUInt16LE } },
+          { "writeUint32"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Function), NoIntrinsic, { HashTableValue::NativeFunctionType, jsBufferPrototypeFunction_writeUInt32LE, 2 } },
+          { "writeUint32BE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Function), NoIntrinsic, { HashTableValue::NativeFunctionType, jsBufferPrototypeFunction_writeUInt32BE, 2 } },
+          { "writeUint32LE"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Function), NoIntrinsic, { HashTableValue::NativeFunctionType, jsBufferPrototypeFunction_writeUInt32LE, 2 } },
+          { "writeUint8"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::Function | JSC::PropertyAttribute::DOMJITFunction), NoIntrinsic, { HashTableValue::DOMJITFunctionType, jsBufferPrototypeFunction_writeUInt8, &DOMJITSignatureForJSBuffer_writeUInt8 } },
       };
 
 void JSBufferPrototype::finishCreation(VM& vm, JSC::JSGlobalObject* globalThis)
@@ -1544,7 +1906,6 @@ void JSBufferPrototype::finishCreation(VM& vm, JSC::JSGlobalObject* globalThis)
     JSC_TO_STRING_TAG_WITHOUT_TRANSITION();
     this->setPrototypeDirect(vm, globalThis->m_typedArrayUint8.prototype(globalThis));
     auto clientData = WebCore::clientData(vm);
-    this->putDirect(vm, clientData->builtinNames().dataViewPublicName(), JSC::jsUndefined(), JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::DontDelete | JSC::PropertyAttribute::ReadOnly);
     this->putDirect(vm, clientData->builtinNames().dataViewPrivateName(), JSC::JSValue(true), JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::DontDelete | JSC::PropertyAttribute::ReadOnly);
     reifyStaticProperties(vm, JSBuffer::info(), JSBufferPrototypeTableValues, *this);
 }
@@ -1666,12 +2027,7 @@ Buffer* JSBuffer::toWrapped(JSC::VM& vm, JSC::JSValue value)
 void toBuffer(JSC::JSGlobalObject* lexicalGlobalObject, JSC::JSUint8Array* uint8Array)
 {
     JSC::VM& vm = lexicalGlobalObject->vm();
-    auto clientData = WebCore::clientData(vm);
     JSC::JSObject* object = JSC::JSValue(uint8Array).getObject();
 
     object->setPrototypeDirect(vm, WebCore::JSBuffer::prototype(vm, *JSC::jsCast<WebCore::JSDOMGlobalObject*>(lexicalGlobalObject)));
-
-    auto* dataView = JSC::JSDataView::create(lexicalGlobalObject, lexicalGlobalObject->typedArrayStructure(JSC::TypeDataView, false), uint8Array->possiblySharedBuffer(), uint8Array->byteOffset(), uint8Array->length());
-    // putDirectWithTransition doesn't work here
-    object->putDirectWithoutTransition(vm, clientData->builtinNames().dataViewPublicName(), dataView, JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::DontDelete | JSC::PropertyAttribute::ReadOnly);
 }
@@ -0,0 +1,253 @@
+#include "JSDigestStream.h"
+#include "JavaScriptCore/JSArrayBuffer.h"
+#include "JavaScriptCore/Lookup.h"
+#include "ZigGlobalObject.h"
+#include "JSDOMExceptionHandling.h"
+#include "JSDOMOperation.h"
+#include "JSDOMAttribute.h"
+#include "JSWritableStream.h"
+
+namespace WebCore {
+
+using namespace JSC;
+
+static JSC_DECLARE_HOST_FUNCTION(jsDigestStreamPrototypeFunction_update);
+static JSC_DECLARE_HOST_FUNCTION(jsDigestStreamPrototypeFunction_digest);
+
+static JSC_DECLARE_CUSTOM_GETTER(jsDigestStream_writable);
+
+void JSDigestStream::finishCreation(JSC::VM& vm)
+{
+    Base::finishCreation(vm);
+}
+
+template<typename Visitor>
+void JSDigestStream::visitChildrenImpl(JSCell* cell, Visitor& visitor)
+{
+    JSDigestStream* stream = jsCast<JSDigestStream*>(cell);
+    ASSERT_GC_OBJECT_INHERITS(stream, info());
+    Base::visitChildren(stream, visitor);
+    visitor.append(stream->m_writable);
+}
+DEFINE_VISIT_CHILDREN(JSDigestStream);
+
+// The stream is its own underlying sink: the WritableStream calls write()
+// on it for every chunk, which hashes the chunk in place.
+JSC::JSValue JSDigestStream::writable(JSC::JSGlobalObject* globalObject)
+{
+    if (m_writable)
+        return m_writable.get();
+
+    auto& vm = globalObject->vm();
+    auto scope = DECLARE_THROW_SCOPE(vm);
+
+    JSObject* constructor = JSWritableStream::getConstructor(vm, globalObject).getObject();
+    auto constructData = JSC::getConstructData(constructor);
+    MarkedArgumentBuffer args;
+    args.append(this);
+    JSObject* writable = JSC::construct(globalObject, constructor, constructData, args);
+    RETURN_IF_EXCEPTION(scope, {});
+
+    m_writable.set(vm, this, writable);
+    return writable;
+}
+
+const JSC::ClassInfo JSDigestStream::s_info = { "DigestStream"_s, &Base::s_info, nullptr, nullptr, CREATE_METHOD_TABLE(JSDigestStream) };
+
+JSC::GCClient::IsoSubspace* JSDigestStream::subspaceForImpl(JSC::VM& vm)
+{
+    return WebCore::subspaceForImpl<JSDigestStream, UseCustomHeapCellType::No>(
+        vm,
+        [](auto& spaces) { return spaces.m_clientSubspaceForDigestStream.get(); },
+        [](auto& spaces, auto&& space) { spaces.m_clientSubspaceForDigestStream = WTFMove(space); },
+        [](auto& spaces) { return spaces.m_subspaceForDigestStream.get(); },
+        [](auto& spaces, auto&& space) { spaces.m_subspaceForDigestStream = WTFMove(space); });
+}
+
+STATIC_ASSERT_ISO_SUBSPACE_SHARABLE(JSDigestStreamPrototype, JSDigestStreamPrototype::Base);
+
+static std::optional<PAL::CryptoDigest::Algorithm> digestAlgorithmFromName(const String& name)
+{
+    if (equalLettersIgnoringASCIICase(name, "sha-1"_s))
+        return PAL::CryptoDigest::Algorithm::SHA_1;
+    if (equalLettersIgnoringASCIICase(name, "sha-224"_s))
+        return PAL::CryptoDigest::Algorithm::SHA_224;
+    if (equalLettersIgnoringASCIICase(name, "sha-256"_s))
+        return PAL::CryptoDigest::Algorithm::SHA_256;
+    if (equalLettersIgnoringASCIICase(name, "sha-384"_s))
+        return PAL::CryptoDigest::Algorithm::SHA_384;
+    if (equalLettersIgnoringASCIICase(name, "sha-512"_s))
+        return PAL::CryptoDigest::Algorithm::SHA_512;
+    return std::nullopt;
+}
+
+static inline JSC::EncodedJSValue jsDigestStreamPrototypeFunction_updateBody(JSC::JSGlobalObject* lexicalGlobalObject, JSC::CallFrame* callFrame, typename IDLOperation<JSDigestStream>::ClassParameter castedThis)
+{
+    auto& vm = JSC::getVM(lexicalGlobalObject);
+    auto throwScope = DECLARE_THROW_SCOPE(vm);
+    if (callFrame->argumentCount() < 1) {
+        throwVMError(lexicalGlobalObject, throwScope, createNotEnoughArgumentsError(lexicalGlobalObject));
+        return JSValue::encode(jsUndefined());
+    }
+
+    if (castedThis->isFinished()) {
+        throwInvalidStateError(*lexicalGlobalObject, throwScope, "DigestStream has already been digested"_s);
+        return JSValue::encode(jsUndefined());
+    }
+
+    // Views and buffers are hashed where they are, nothing is copied.
+    auto data = callFrame->uncheckedArgument(0);
+    if (auto* view = JSC::jsDynamicCast<JSC::JSArrayBufferView*>(data)) {
+        castedThis->update(static_cast<const uint8_t*>(view->vector()), view->byteLength());
+    } else if (auto* buffer = JSC::jsDynamicCast<JSC::JSArrayBuffer*>(data)) {
+        auto* impl = buffer->impl();
+        castedThis->update(static_cast<const uint8_t*>(impl->data()), impl->byteLength());
+    } else if (data.isString()) {
+        auto string = data.toWTFString(lexicalGlobalObject);
+        RETURN_IF_EXCEPTION(throwScope, JSValue::encode(jsUndefined()));
+        if (string.is8Bit() && string.isAllASCII()) {
+            castedThis->update(string.characters8(), string.length());
+        } else {
+            auto utf8 = string.utf8();
+            castedThis->update(reinterpret_cast<const uint8_t*>(utf8.data()), utf8.length());
+        }
+    } else {
+        throwVMTypeError(lexicalGlobalObject, throwScope, "Expected a string, ArrayBuffer or ArrayBufferView"_s);
+        return JSValue::encode(jsUndefined());
+    }
+
+    RELEASE_AND_RETURN(throwScope, JSValue::encode(jsUndefined()));
+}
+
+static inline JSC::EncodedJSValue jsDigestStreamPrototypeFunction_digestBody(JSC::JSGlobalObject* lexicalGlobalObject, JSC::CallFrame* callFrame, typename IDLOperation<JSDigestStream>::ClassParameter castedThis)
+{
+    auto& vm = JSC::getVM(lexicalGlobalObject);
+    auto throwScope = DECLARE_THROW_SCOPE(vm);
+
+    if (castedThis->isFinished()) {
+        throwInvalidStateError(*lexicalGlobalObject, throwScope, "DigestStream has already been digested"_s);
+        return JSValue::encode(jsUndefined());
+    }
+
+    auto hash = castedThis->finish();
+    auto arrayBuffer = JSC::ArrayBuffer::tryCreate(hash.data(), hash.size());
+    if (UNLIKELY(!arrayBuffer)) {
+        throwOutOfMemoryError(lexicalGlobalObject, throwScope);
+        return JSValue::encode(jsUndefined());
+    }
+
+    RELEASE_AND_RETURN(throwScope, JSValue::encode(JSC::JSArrayBuffer::create(vm, lexicalGlobalObject->arrayBufferStructure(JSC::ArrayBufferSharingMode::Default), WTFMove(arrayBuffer))));
+}
+
+static JSC_DEFINE_HOST_FUNCTION(jsDigestStreamPrototypeFunction_update,
+    (JSC::JSGlobalObject * globalObject, JSC::CallFrame* callFrame))
+{
+    return IDLOperation<JSDigestStream>::call<jsDigestStreamPrototypeFunction_updateBody>(*globalObject, *callFrame, "update");
+}
+static JSC_DEFINE_HOST_FUNCTION(jsDigestStreamPrototypeFunction_digest,
+    (JSC::JSGlobalObject * globalObject, JSC::CallFrame* callFrame))
+{
+    return IDLOperation<JSDigestStream>::call<jsDigestStreamPrototypeFunction_digestBody>(*globalObject, *callFrame, "digest");
+}
+
+static JSC_DEFINE_CUSTOM_GETTER(jsDigestStream_writable, (JSGlobalObject * lexicalGlobalObject, EncodedJSValue thisValue, PropertyName attributeName))
+{
+    auto& vm = JSC::getVM(lexicalGlobalObject);
+    auto throwScope = DECLARE_THROW_SCOPE(vm);
+    JSDigestStream* thisObject = jsDynamicCast<JSDigestStream*>(JSValue::decode(thisValue));
+    if (UNLIKELY(!thisObject))
+        return throwVMTypeError(lexicalGlobalObject, throwScope);
+    RELEASE_AND_RETURN(throwScope, JSC::JSValue::encode(thisObject->writable(lexicalGlobalObject)));
+}
+
+/* Hash table for prototype */
+static const HashTableValue JSDigestStreamPrototypeTableValues[]
+    = {
+          { "writable"_s, static_cast<unsigned>(JSC::PropertyAttribute::DontDelete | JSC::PropertyAttribute::ReadOnly | JSC::PropertyAttribute::CustomAccessor | JSC::PropertyAttribute::DOMAttribute), NoIntrinsic, { HashTableValue::GetterSetterType, jsDigestStream_writable, 0 } },
+          { "update"_s, static_cast<unsigned>(JSC::PropertyAttribute::Function), NoIntrinsic, { HashTableValue::NativeFunctionType, jsDigestStreamPrototypeFunction_update, 1 } },
+          { "write"_s, static_cast<unsigned>(JSC::PropertyAttribute::Function), NoIntrinsic, { HashTableValue::NativeFunctionType, jsDigestStreamPrototypeFunction_update, 1 } },
+          { "digest"_s, static_cast<unsigned>(JSC::PropertyAttribute::Function), NoIntrinsic, { HashTableValue::NativeFunctionType, jsDigestStreamPrototypeFunction_digest, 0 } },
+      };
+
+void JSDigestStreamPrototype::finishCreation(VM& vm, JSC::JSGlobalObject* globalThis)
+{
+    Base::finishCreation(vm);
+    reifyStaticProperties(vm, JSDigestStream::info(), JSDigestStreamPrototypeTableValues, *this);
+    JSC_TO_STRING_TAG_WITHOUT_TRANSITION();
+}
+
+const ClassInfo JSDigestStreamPrototype::s_info = { "DigestStream"_s, &Base::s_info, nullptr, nullptr, CREATE_METHOD_TABLE(JSDigestStreamPrototype) };
+
+void JSDigestStreamConstructor::finishCreation(VM& vm, JSC::JSGlobalObject* globalObject, JSDigestStreamPrototype* prototype)
+{
+    Base::finishCreation(vm, 1, "DigestStream"_s, PropertyAdditionMode::WithoutStructureTransition);
+    putDirectWithoutTransition(vm, vm.propertyNames->prototype, prototype, PropertyAttribute::DontEnum | PropertyAttribute::DontDelete | PropertyAttribute::ReadOnly);
+    ASSERT(inherits(info()));
+}
+
+JSDigestStreamConstructor* JSDigestStreamConstructor::create(JSC::VM& vm, JSC::JSGlobalObject* globalObject, JSC::Structure* structure, JSDigestStreamPrototype* prototype)
+{
+    JSDigestStreamConstructor* ptr = new (NotNull, JSC::allocateCell<JSDigestStreamConstructor>(vm)) JSDigestStreamConstructor(vm, structure);
+    ptr->finishCreation(vm, globalObject, prototype);
+    return ptr;
+}
+
+JSC::EncodedJSValue JSDigestStreamConstructor::call(JSC::JSGlobalObject* lexicalGlobalObject, JSC::CallFrame* callFrame)
+{
+    auto scope = DECLARE_THROW_SCOPE(lexicalGlobalObject->vm());
+    return throwVMTypeError(lexicalGlobalObject, scope, "Class constructor DigestStream cannot be invoked without 'new'"_s);
+}
+
+JSC::EncodedJSValue JSDigestStreamConstructor::construct(JSC::JSGlobalObject* lexicalGlobalObject, JSC::CallFrame* callFrame)
+{
+    JSC::VM& vm = lexicalGlobalObject->vm();
+    auto scope = DECLARE_THROW_SCOPE(vm);
+    if (callFrame->argumentCount() < 1) {
+        throwVMError(lexicalGlobalObject, scope, createNotEnoughArgumentsError(lexicalGlobalObject));
+        return JSValue::encode(jsUndefined());
+    }
+
+    // Accepts the same algorithm identifiers as SubtleCrypto.digest: a name or
+    // an object with a name.
+    JSValue algorithm = callFrame->uncheckedArgument(0);
+    if (algorithm.isObject()) {
+        algorithm = algorithm.getObject()->get(lexicalGlobalObject, vm.propertyNames->name);
+        RETURN_IF_EXCEPTION(scope, JSValue::encode(jsUndefined()));
+    }
+    auto name = algorithm.toWTFString(lexicalGlobalObject);
+    RETURN_IF_EXCEPTION(scope, JSValue::encode(jsUndefined()));
+
+    auto identifier = digestAlgorithmFromName(name);
+    if (!identifier) {
+        throwNotSupportedError(*lexicalGlobalObject, scope, "Unsupported digest algorithm"_s);
+        return JSValue::encode(jsUndefined());
+    }
+
+    auto digest = PAL::CryptoDigest::create(*identifier);
+    if (UNLIKELY(!digest)) {
+        throwNotSupportedError(*lexicalGlobalObject, scope, "Unsupported digest algorithm"_s);
+        return JSValue::encode(jsUndefined());
+    }
+
+    auto* globalObject = reinterpret_cast<Zig::GlobalObject*>(lexicalGlobalObject);
+    JSObject* newTarget = asObject(callFrame->newTarget());
+    Structure* structure = globalObject->JSDigestStreamStructure();
+    if (globalObject->JSDigestStream() != newTarget) {
+        auto* functionGlobalObject = reinterpret_cast<Zig::GlobalObject*>(
+            // ShadowRealm functions belong to a different global object.
+            getFunctionRealm(globalObject, newTarget));
+        RETURN_IF_EXCEPTION(scope, JSValue::encode(jsUndefined()));
+        structure = InternalFunction::createSubclassStructure(
+            globalObject,
+            newTarget,
+            functionGlobalObject->JSDigestStreamStructure());
+        RETURN_IF_EXCEPTION(scope, JSValue::encode(jsUndefined()));
+    }
+
+    JSDigestStream* stream = JSDigestStream::create(vm, lexicalGlobalObject, structure, WTFMove(digest));
+    return JSC::JSValue::encode(stream);
+}
+
+const ClassInfo JSDigestStreamConstructor::s_info = { "DigestStream"_s, &Base::s_info, nullptr, nullptr, CREATE_METHOD_TABLE(JSDigestStreamConstructor) };
+
+} // namespace WebCore
@@ -0,0 +1,126 @@
+#pragma once
+
+#include "root.h"
+#include "webcrypto/CryptoDigest.h"
+
+namespace WebCore {
+using namespace JSC;
+
+// Incremental hashing for crypto.DigestStream. Chunks go straight into one
+// PAL::CryptoDigest as they are written, so the input is never buffered.
+class JSDigestStream : public JSC::JSDestructibleObject {
+    using Base = JSC::JSDestructibleObject;
+
+public:
+    JSDigestStream(JSC::VM& vm, JSC::Structure* structure, std::unique_ptr<PAL::CryptoDigest>&& digest)
+        : Base(vm, structure)
+        , m_digest(WTFMove(digest))
+    {
+    }
+
+    DECLARE_VISIT_CHILDREN;
+    DECLARE_INFO;
+
+    static constexpr unsigned StructureFlags = Base::StructureFlags;
+
+    template<typename, JSC::SubspaceAccess mode> static JSC::GCClient::IsoSubspace* subspaceFor(JSC::VM& vm)
+    {
+        if constexpr (mode == JSC::SubspaceAccess::Concurrently)
+            return nullptr;
+        return subspaceForImpl(vm);
+    }
+
+    static JSC::GCClient::IsoSubspace* subspaceForImpl(JSC::VM& vm);
+
+    static JSC::Structure* createStructure(JSC::VM& vm, JSC::JSGlobalObject* globalObject,
+        JSC::JSValue prototype)
+    {
+        return JSC::Structure::create(vm, globalObject, prototype,
+            JSC::TypeInfo(JSC::ObjectType, StructureFlags), info());
+    }
+
+    static JSDigestStream* create(JSC::VM& vm, JSC::JSGlobalObject* globalObject, JSC::Structure* structure, std::unique_ptr<PAL::CryptoDigest>&& digest)
+    {
+        JSDigestStream* accessor = new (NotNull, JSC::allocateCell<JSDigestStream>(vm)) JSDigestStream(vm, structure, WTFMove(digest));
+        accessor->finishCreation(vm);
+        return accessor;
+    }
+
+    void finishCreation(JSC::VM& vm);
+    static void destroy(JSCell* cell) { static_cast<JSDigestStream*>(cell)->JSDigestStream::~JSDigestStream(); }
+
+    // The digest is released once digest() has been called; after that the
+    // stream rejects further input.
+    bool isFinished() const { return !m_digest; }
+    void update(const uint8_t* data, size_t length) { m_digest->addBytes(data, length); }
+    Vector<uint8_t> finish()
+    {
+        auto hash = m_digest->computeHash();
+        m_digest = nullptr;
+        return hash;
+    }
+
+    JSC::JSValue writable(JSC::JSGlobalObject*);
+
+private:
+    std::unique_ptr<PAL::CryptoDigest> m_digest;
+    JSC::WriteBarrier<JSC::Unknown> m_writable;
+};
+
+class JSDigestStreamPrototype : public JSC::JSNonFinalObject {
+public:
+    using Base = JSC::JSNonFinalObject;
+    static JSDigestStreamPrototype* create(JSC::VM& vm, JSC::JSGlobalObject* globalObject, JSC::Structure* structure)
+    {
+        JSDigestStreamPrototype* ptr = new (NotNull, JSC::allocateCell<JSDigestStreamPrototype>(vm)) JSDigestStreamPrototype(vm, structure);
+        ptr->finishCreation(vm, globalObject);
+        return ptr;
+    }
+
+    DECLARE_INFO;
+    template<typename CellType, JSC::SubspaceAccess>
+    static JSC::GCClient::IsoSubspace* subspaceFor(JSC::VM& vm)
+    {
+        return &vm.plainObjectSpace();
+    }
+    static JSC::Structure* createStructure(JSC::VM& vm, JSC::JSGlobalObject* globalObject, JSC::JSValue prototype)
+    {
+        return JSC::Structure::create(vm, globalObject, prototype, JSC::TypeInfo(JSC::ObjectType, StructureFlags), info());
+    }
+
+private:
+    JSDigestStreamPrototype(JSC::VM& vm, JSC::Structure* structure)
+        : Base(vm, structure)
+    {
+    }
+
+    void finishCreation(JSC::VM&, JSC::JSGlobalObject*);
+};
+
+class JSDigestStreamConstructor final : public JSC::InternalFunction {
+public:
+    using Base = JSC::InternalFunction;
+    static JSDigestStreamConstructor* create(JSC::VM& vm, JSC::JSGlobalObject* globalObject, JSC::Structure* structure, JSDigestStreamPrototype* prototype);
+
+    static constexpr unsigned StructureFlags = Base::StructureFlags;
+    static constexpr bool needsDestruction = false;
+
+    static JSC::Structure* createStructure(JSC::VM& vm, JSC::JSGlobalObject* globalObject, JSC::JSValue prototype)
+    {
+        return JSC::Structure::create(vm, globalObject, prototype, JSC::TypeInfo(JSC::InternalFunctionType, StructureFlags), info());
+    }
+
+    static JSC::EncodedJSValue JSC_HOST_CALL_ATTRIBUTES construct(JSC::JSGlobalObject*, JSC::CallFrame*);
+    static JSC::EncodedJSValue JSC_HOST_CALL_ATTRIBUTES call(JSC::JSGlobalObject*, JSC::CallFrame*);
+    DECLARE_EXPORT_INFO;
+
+private:
+    JSDigestStreamConstructor(JSC::VM& vm, JSC::Structure* structure)
+        : Base(vm, structure, call, construct)
+    {
+    }
+
+    void finishCreation(JSC::VM&, JSC::JSGlobalObject* globalObject, JSDigestStreamPrototype* prototype);
+};
+
+}
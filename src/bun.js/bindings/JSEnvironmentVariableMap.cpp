@@ -2,70 +2,125 @@
 #include "ZigGlobalObject.h"
 
 #include "helpers.h"
+#include "BunClientData.h"
+#include "JSEnvironmentVariableMap.h"
 
 #include "JavaScriptCore/JSObject.h"
 #include "JavaScriptCore/ObjectConstructor.h"
+#include "JavaScriptCore/PropertyNameArray.h"
 
 extern "C" size_t Bun__getEnvNames(JSGlobalObject*, ZigString* names, size_t max);
 extern "C" bool Bun__getEnvValue(JSGlobalObject* globalObject, ZigString* name, ZigString* value);
 
 namespace Bun {
 
-JSC_DEFINE_CUSTOM_GETTER(jsGetterEnvironmentVariable, (JSGlobalObject * globalObject, EncodedJSValue thisValue, PropertyName propertyName))
+using namespace JSC;
+
+const ClassInfo JSEnvironmentVariableMap::s_info = { "Object"_s, &Base::s_info, nullptr, nullptr, CREATE_METHOD_TABLE(JSEnvironmentVariableMap) };
+
+JSC::GCClient::IsoSubspace* JSEnvironmentVariableMap::subspaceForImpl(JSC::VM& vm)
 {
-    VM& vm = globalObject->vm();
-    auto scope = DECLARE_THROW_SCOPE(vm);
+    return WebCore::subspaceForImpl<JSEnvironmentVariableMap, WebCore::UseCustomHeapCellType::No>(
+        vm,
+        [](auto& spaces) { return spaces.m_clientSubspaceForEnvironmentVariableMap.get(); },
+        [](auto& spaces, auto&& space) { spaces.m_clientSubspaceForEnvironmentVariableMap = WTFMove(space); },
+        [](auto& spaces) { return spaces.m_subspaceForEnvironmentVariableMap.get(); },
+        [](auto& spaces, auto&& space) { spaces.m_subspaceForEnvironmentVariableMap = WTFMove(space); });
+}
 
-    auto* thisObject = jsDynamicCast<JSObject*>(JSValue::decode(thisValue));
-    if (UNLIKELY(!thisObject))
-        return JSValue::encode(jsUndefined());
+JSValue JSEnvironmentVariableMap::materialize(JSGlobalObject* globalObject, PropertyName propertyName)
+{
+    auto* name = propertyName.publicName();
+    if (UNLIKELY(!name || name->length() == 0))
+        return JSValue();
 
-    ZigString name = toZigString(propertyName.publicName());
+    ZigString zigName = toZigString(name);
     ZigString value = { nullptr, 0 };
+    if (!Bun__getEnvValue(globalObject, &zigName, &value))
+        return JSValue();
+
+    VM& vm = globalObject->vm();
+    JSValue result = value.len ? jsString(vm, Zig::toStringCopy(value)) : jsEmptyString(vm);
+    putDirect(vm, propertyName, result, 0);
+    return result;
+}
+
+void JSEnvironmentVariableMap::materializeAll(JSGlobalObject* globalObject)
+{
+    if (m_isFullyMaterialized)
+        return;
 
-    if (UNLIKELY(name.len == 0))
-        return JSValue::encode(jsUndefined());
+    VM& vm = globalObject->vm();
 
-    if (!Bun__getEnvValue(globalObject, &name, &value) || value.len == 0) {
-        return JSValue::encode(jsUndefined());
+    ZigString stackNames[64];
+    ZigString* names = stackNames;
+    size_t count = Bun__getEnvNames(globalObject, stackNames, 64);
+    Vector<ZigString> heapNames;
+    if (count > 64) {
+        heapNames.grow(count);
+        count = Bun__getEnvNames(globalObject, heapNames.data(), count);
+        names = heapNames.data();
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        auto identifier = Identifier::fromString(vm, Zig::toStringCopy(names[i]));
+        // Anything already on the object was either read before or assigned by
+        // the user; both take precedence over the snapshot.
+        if (getDirectOffset(vm, identifier) != invalidOffset)
+            continue;
+        materialize(globalObject, identifier);
     }
 
-    JSValue result = jsString(vm, Zig::toStringCopy(value));
-    thisObject->putDirect(vm, propertyName, result, 0);
-    return JSValue::encode(result);
+    m_isFullyMaterialized = true;
 }
 
-JSC_DEFINE_CUSTOM_SETTER(jsSetterEnvironmentVariable, (JSGlobalObject * globalObject, EncodedJSValue thisValue, EncodedJSValue value, PropertyName propertyName))
+bool JSEnvironmentVariableMap::getOwnPropertySlot(JSObject* object, JSGlobalObject* globalObject, PropertyName propertyName, PropertySlot& slot)
 {
-    VM& vm = globalObject->vm();
-    JSC::JSObject* object = JSValue::decode(thisValue).getObject();
-    if (!object)
+    auto* thisObject = jsCast<JSEnvironmentVariableMap*>(object);
+    if (Base::getOwnPropertySlot(thisObject, globalObject, propertyName, slot))
+        return true;
+
+    if (thisObject->m_isFullyMaterialized || propertyName.isSymbol())
+        return false;
+
+    JSValue value = thisObject->materialize(globalObject, propertyName);
+    if (!value)
         return false;
 
-    object->putDirect(vm, propertyName, JSValue::decode(value), 0);
+    slot.setValue(thisObject, 0, value);
     return true;
 }
 
-JSValue createEnvironmentVariablesMap(Zig::GlobalObject* globalObject)
+bool JSEnvironmentVariableMap::getOwnPropertySlotByIndex(JSObject* object, JSGlobalObject* globalObject, unsigned index, PropertySlot& slot)
 {
-    VM& vm = globalObject->vm();
-    auto scope = DECLARE_THROW_SCOPE(vm);
-
-    size_t max = 768;
-    ZigString names[max];
-    size_t count = Bun__getEnvNames(globalObject, names, max);
-    JSC::JSObject* object = nullptr;
-    if (count < 63) {
-        object = constructEmptyObject(globalObject, globalObject->objectPrototype(), count);
-    } else {
-        object = constructEmptyObject(globalObject, globalObject->objectPrototype());
-    }
+    return getOwnPropertySlot(object, globalObject, Identifier::from(globalObject->vm(), index), slot);
+}
 
-    for (size_t i = 0; i < count; i++) {
-        auto name = Zig::toStringCopy(names[i]);
-        object->putDirectCustomAccessor(vm, Identifier::fromString(vm, name), JSC::CustomGetterSetter::create(vm, jsGetterEnvironmentVariable, jsSetterEnvironmentVariable), JSC::PropertyAttribute::CustomAccessor | 0);
-    }
+void JSEnvironmentVariableMap::getOwnPropertyNames(JSObject* object, JSGlobalObject* globalObject, PropertyNameArray& propertyNames, DontEnumPropertiesMode mode)
+{
+    auto* thisObject = jsCast<JSEnvironmentVariableMap*>(object);
+    thisObject->materializeAll(globalObject);
+    Base::getOwnPropertyNames(thisObject, globalObject, propertyNames, mode);
+}
+
+bool JSEnvironmentVariableMap::deleteProperty(JSCell* cell, JSGlobalObject* globalObject, PropertyName propertyName, DeletePropertySlot& slot)
+{
+    auto* thisObject = jsCast<JSEnvironmentVariableMap*>(cell);
+    thisObject->materializeAll(globalObject);
+    return Base::deleteProperty(thisObject, globalObject, propertyName, slot);
+}
+
+bool JSEnvironmentVariableMap::deletePropertyByIndex(JSCell* cell, JSGlobalObject* globalObject, unsigned index)
+{
+    auto* thisObject = jsCast<JSEnvironmentVariableMap*>(cell);
+    thisObject->materializeAll(globalObject);
+    return Base::deletePropertyByIndex(thisObject, globalObject, index);
+}
 
-    return object;
+JSValue createEnvironmentVariablesMap(Zig::GlobalObject* globalObject)
+{
+    VM& vm = globalObject->vm();
+    auto* structure = JSEnvironmentVariableMap::createStructure(vm, globalObject, globalObject->objectPrototype());
+    return JSEnvironmentVariableMap::create(vm, structure);
+}
 }
-}
\ No newline at end of file
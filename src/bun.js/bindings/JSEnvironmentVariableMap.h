@@ -1,5 +1,9 @@
+#pragma once
+
 #include "root.h"
 
+#include "JavaScriptCore/JSObject.h"
+
 namespace Zig {
 class GlobalObject;
 }
@@ -10,6 +14,58 @@ class JSValue;
 
 namespace Bun {
 
+// process.env / Bun.env
+//
+// Nothing is copied out of the environment when the object is created.
+// A variable becomes a regular own property the first time it is read;
+// enumerating or deleting materializes the rest of the snapshot first, so
+// deleted variables cannot reappear and enumeration order stays stable.
+class JSEnvironmentVariableMap final : public JSC::JSNonFinalObject {
+public:
+    using Base = JSC::JSNonFinalObject;
+    static constexpr unsigned StructureFlags = Base::StructureFlags | JSC::OverridesGetOwnPropertySlot | JSC::OverridesGetOwnPropertyNames | JSC::InterceptsGetOwnPropertySlotByIndexEvenWhenLengthIsNotZero;
+
+    DECLARE_INFO;
+
+    template<typename, JSC::SubspaceAccess mode> static JSC::GCClient::IsoSubspace* subspaceFor(JSC::VM& vm)
+    {
+        if constexpr (mode == JSC::SubspaceAccess::Concurrently)
+            return nullptr;
+        return subspaceForImpl(vm);
+    }
+
+    static JSC::GCClient::IsoSubspace* subspaceForImpl(JSC::VM& vm);
+
+    static JSC::Structure* createStructure(JSC::VM& vm, JSC::JSGlobalObject* globalObject, JSC::JSValue prototype)
+    {
+        return JSC::Structure::create(vm, globalObject, prototype, JSC::TypeInfo(JSC::ObjectType, StructureFlags), info());
+    }
+
+    static JSEnvironmentVariableMap* create(JSC::VM& vm, JSC::Structure* structure)
+    {
+        JSEnvironmentVariableMap* object = new (NotNull, JSC::allocateCell<JSEnvironmentVariableMap>(vm)) JSEnvironmentVariableMap(vm, structure);
+        object->finishCreation(vm);
+        return object;
+    }
+
+    static bool getOwnPropertySlot(JSC::JSObject*, JSC::JSGlobalObject*, JSC::PropertyName, JSC::PropertySlot&);
+    static bool getOwnPropertySlotByIndex(JSC::JSObject*, JSC::JSGlobalObject*, unsigned, JSC::PropertySlot&);
+    static void getOwnPropertyNames(JSC::JSObject*, JSC::JSGlobalObject*, JSC::PropertyNameArray&, JSC::DontEnumPropertiesMode);
+    static bool deleteProperty(JSC::JSCell*, JSC::JSGlobalObject*, JSC::PropertyName, JSC::DeletePropertySlot&);
+    static bool deletePropertyByIndex(JSC::JSCell*, JSC::JSGlobalObject*, unsigned);
+
+private:
+    JSEnvironmentVariableMap(JSC::VM& vm, JSC::Structure* structure)
+        : Base(vm, structure)
+    {
+    }
+
+    JSC::JSValue materialize(JSC::JSGlobalObject*, JSC::PropertyName);
+    void materializeAll(JSC::JSGlobalObject*);
+
+    bool m_isFullyMaterialized { false };
+};
+
 JSC::JSValue createEnvironmentVariablesMap(Zig::GlobalObject* globalObject);
 
-}
\ No newline at end of file
+}
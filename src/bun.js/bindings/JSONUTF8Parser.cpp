@@ -0,0 +1,87 @@
+#include "root.h"
+#include "JSONUTF8Parser.h"
+
+#include "JavaScriptCore/LiteralParser.h"
+#include "simdutf.h"
+
+namespace Bun {
+
+using namespace JSC;
+
+template<typename CharacterType>
+static JSValue parse(JSGlobalObject* globalObject, const CharacterType* characters, unsigned length)
+{
+    VM& vm = globalObject->vm();
+    auto scope = DECLARE_THROW_SCOPE(vm);
+
+    // The parser keeps its own caches of the property names it has seen, so
+    // repeated keys become one identifier each.
+    LiteralParser<CharacterType> parser(globalObject, characters, length, StrictJSON);
+    JSValue result = parser.tryLiteralParse();
+    RETURN_IF_EXCEPTION(scope, {});
+    if (!result)
+        throwSyntaxError(globalObject, scope, parser.getErrorMessage());
+    return result;
+}
+
+// Valid UTF-8 where every code point fits in Latin-1 is converted to 8-bit
+// characters, so that the text is parsed as 8-bit. Returns the new length, or
+// zero when a code point above U+00FF needs 16-bit characters.
+static size_t convertValidUTF8ToLatin1(const LChar* bytes, size_t length, LChar* latin1)
+{
+    LChar* out = latin1;
+    for (size_t i = 0; i < length;) {
+        LChar byte = bytes[i];
+        if (byte < 0x80) {
+            *out++ = byte;
+            i++;
+            continue;
+        }
+
+        // 0xC2 and 0xC3 lead the two-byte sequences of U+0080 to U+00FF.
+        if (byte > 0xC3)
+            return 0;
+        *out++ = ((byte & 0x1F) << 6) | (bytes[i + 1] & 0x3F);
+        i += 2;
+    }
+    return out - latin1;
+}
+
+JSValue parseJSONUTF8(JSGlobalObject* globalObject, const LChar* bytes, size_t length, bool* isAllASCII)
+{
+    VM& vm = globalObject->vm();
+    auto scope = DECLARE_THROW_SCOPE(vm);
+
+    if (UNLIKELY(length > String::MaxLength)) {
+        throwOutOfMemoryError(globalObject, scope);
+        return {};
+    }
+
+    auto* characters = reinterpret_cast<const char*>(bytes);
+
+    // Most JSON is ASCII, which is already Latin-1.
+    bool ascii = simdutf::validate_ascii(characters, length);
+    if (isAllASCII)
+        *isAllASCII = ascii;
+    if (ascii)
+        RELEASE_AND_RETURN(scope, parse(globalObject, bytes, length));
+
+    if (UNLIKELY(!simdutf::validate_utf8(characters, length))) {
+        String string = String::fromUTF8ReplacingInvalidSequences(bytes, length);
+        if (string.is8Bit())
+            RELEASE_AND_RETURN(scope, parse(globalObject, string.characters8(), string.length()));
+        RELEASE_AND_RETURN(scope, parse(globalObject, string.characters16(), string.length()));
+    }
+
+    Vector<LChar> latin1;
+    latin1.grow(length);
+    if (size_t latin1Length = convertValidUTF8ToLatin1(bytes, length, latin1.data()))
+        RELEASE_AND_RETURN(scope, parse(globalObject, latin1.data(), latin1Length));
+
+    Vector<UChar> utf16;
+    utf16.grow(simdutf::utf16_length_from_utf8(characters, length));
+    (void)simdutf::convert_valid_utf8_to_utf16le(characters, length, reinterpret_cast<char16_t*>(utf16.data()));
+    RELEASE_AND_RETURN(scope, parse(globalObject, utf16.data(), utf16.size()));
+}
+
+}
@@ -0,0 +1,13 @@
+#pragma once
+
+#include "root.h"
+
+namespace Bun {
+
+// JSON.parse() of UTF-8 bytes, such as a request body, without decoding them
+// into a string first. Throws a SyntaxError like JSON.parse on bad input.
+// Invalid UTF-8 is replaced with U+FFFD, as TextDecoder would. If isAllASCII
+// is given, it is set to whether the bytes were all ASCII.
+JSC::JSValue parseJSONUTF8(JSC::JSGlobalObject*, const LChar* bytes, size_t length, bool* isAllASCII = nullptr);
+
+}
@@ -0,0 +1,481 @@
+#include "root.h"
+#include "JSONUTF8Serializer.h"
+
+#include "JavaScriptCore/JSArray.h"
+#include "JavaScriptCore/JSONObject.h"
+#include "JavaScriptCore/ObjectConstructor.h"
+#include <wtf/dtoa.h>
+
+namespace Bun {
+
+using namespace JSC;
+
+// Most documents are small, so the chunk starts small and doubles as it
+// fills up. Once it reaches the largest size, it is written out instead.
+static constexpr size_t initialChunkSize = 1024;
+static constexpr size_t maxChunkSize = 64 * 1024;
+// The most bytes one UTF-16 code unit turns into: a lone surrogate is
+// escaped as \udXXX.
+static constexpr size_t maxBytesPerCharacter = 6;
+
+JSONUTF8Serializer::JSONUTF8Serializer(JSGlobalObject* globalObject, void* context, WriteFunction write)
+    : m_globalObject(globalObject)
+    , m_context(context)
+    , m_write(write)
+{
+    m_chunk.grow(initialChunkSize);
+}
+
+void JSONUTF8Serializer::flush()
+{
+    // Once a write fails the document is lost, and serialize() throws.
+    if (m_used && !m_writeFailed && !m_write(m_context, m_chunk.data(), m_used))
+        m_writeFailed = true;
+    m_used = 0;
+}
+
+void JSONUTF8Serializer::makeRoom(size_t length)
+{
+    ASSERT(length <= maxChunkSize);
+    size_t needed = m_used + length;
+    if (m_chunk.size() < maxChunkSize) {
+        m_chunk.grow(std::min(maxChunkSize, std::max(needed, m_chunk.size() * 2)));
+        if (needed <= m_chunk.size())
+            return;
+    }
+    flush();
+}
+
+ALWAYS_INLINE uint8_t* JSONUTF8Serializer::reserve(size_t length)
+{
+    if (UNLIKELY(m_used + length > m_chunk.size()))
+        makeRoom(length);
+    return m_chunk.data() + m_used;
+}
+
+ALWAYS_INLINE void JSONUTF8Serializer::appendCharacter(uint8_t character)
+{
+    *reserve(1) = character;
+    m_used++;
+}
+
+void JSONUTF8Serializer::appendASCII(const char* characters, size_t length)
+{
+    memcpy(reserve(length), characters, length);
+    m_used += length;
+}
+
+template<typename CharacterType>
+void JSONUTF8Serializer::appendQuoted(const CharacterType* characters, unsigned length)
+{
+    static constexpr char hexDigits[] = "0123456789abcdef";
+
+    appendCharacter('"');
+    for (unsigned i = 0; i < length;) {
+        // Convert as many characters as surely fit in what is left of the
+        // chunk without checking the space for each one.
+        size_t room = (m_chunk.size() - m_used) / maxBytesPerCharacter;
+        if (!room) {
+            makeRoom(maxBytesPerCharacter);
+            room = (m_chunk.size() - m_used) / maxBytesPerCharacter;
+        }
+        unsigned end = std::min<size_t>(length, i + room);
+        uint8_t* out = m_chunk.data() + m_used;
+
+        while (i < end) {
+            auto character = characters[i++];
+            if (character < 0x80) {
+                if (LIKELY(character >= 0x20 && character != '"' && character != '\\')) {
+                    *out++ = character;
+                    continue;
+                }
+
+                *out++ = '\\';
+                switch (character) {
+                case '"':
+                case '\\':
+                    *out++ = character;
+                    break;
+                case '\b':
+                    *out++ = 'b';
+                    break;
+                case '\f':
+                    *out++ = 'f';
+                    break;
+                case '\n':
+                    *out++ = 'n';
+                    break;
+                case '\r':
+                    *out++ = 'r';
+                    break;
+                case '\t':
+                    *out++ = 't';
+                    break;
+                default:
+                    *out++ = 'u';
+                    *out++ = '0';
+                    *out++ = '0';
+                    *out++ = hexDigits[character >> 4];
+                    *out++ = hexDigits[character & 0xF];
+                    break;
+                }
+                continue;
+            }
+
+            m_isAllASCII = false;
+            if (character < 0x800) {
+                *out++ = 0xC0 | (character >> 6);
+                *out++ = 0x80 | (character & 0x3F);
+                continue;
+            }
+
+            if constexpr (sizeof(CharacterType) == 2) {
+                if (U16_IS_SURROGATE(character)) {
+                    if (U16_IS_SURROGATE_LEAD(character) && i < length && U16_IS_TRAIL(characters[i])) {
+                        UChar32 codePoint = U16_GET_SUPPLEMENTARY(character, characters[i++]);
+                        *out++ = 0xF0 | (codePoint >> 18);
+                        *out++ = 0x80 | ((codePoint >> 12) & 0x3F);
+                        *out++ = 0x80 | ((codePoint >> 6) & 0x3F);
+                        *out++ = 0x80 | (codePoint & 0x3F);
+                        continue;
+                    }
+
+                    // Well-formed JSON.stringify escapes lone surrogates.
+                    *out++ = '\\';
+                    *out++ = 'u';
+                    *out++ = hexDigits[character >> 12];
+                    *out++ = hexDigits[(character >> 8) & 0xF];
+                    *out++ = hexDigits[(character >> 4) & 0xF];
+                    *out++ = hexDigits[character & 0xF];
+                    continue;
+                }
+
+                *out++ = 0xE0 | (character >> 12);
+                *out++ = 0x80 | ((character >> 6) & 0x3F);
+                *out++ = 0x80 | (character & 0x3F);
+            }
+        }
+
+        m_used = out - m_chunk.data();
+    }
+    appendCharacter('"');
+}
+
+void JSONUTF8Serializer::appendQuoted(const String& string)
+{
+    if (string.is8Bit())
+        appendQuoted(string.characters8(), string.length());
+    else
+        appendQuoted(string.characters16(), string.length());
+}
+
+// Transcodes text that is JSON already, so it has no lone surrogates.
+template<typename CharacterType>
+void JSONUTF8Serializer::appendJSON(const CharacterType* characters, unsigned length)
+{
+    for (unsigned i = 0; i < length;) {
+        size_t room = (m_chunk.size() - m_used) / maxBytesPerCharacter;
+        if (!room) {
+            makeRoom(maxBytesPerCharacter);
+            room = (m_chunk.size() - m_used) / maxBytesPerCharacter;
+        }
+        unsigned end = std::min<size_t>(length, i + room);
+        uint8_t* out = m_chunk.data() + m_used;
+
+        while (i < end) {
+            auto character = characters[i++];
+            if (character < 0x80) {
+                *out++ = character;
+                continue;
+            }
+
+            m_isAllASCII = false;
+            if (character < 0x800) {
+                *out++ = 0xC0 | (character >> 6);
+                *out++ = 0x80 | (character & 0x3F);
+                continue;
+            }
+
+            if constexpr (sizeof(CharacterType) == 2) {
+                if (U16_IS_SURROGATE_LEAD(character) && i < length && U16_IS_TRAIL(characters[i])) {
+                    UChar32 codePoint = U16_GET_SUPPLEMENTARY(character, characters[i++]);
+                    *out++ = 0xF0 | (codePoint >> 18);
+                    *out++ = 0x80 | ((codePoint >> 12) & 0x3F);
+                    *out++ = 0x80 | ((codePoint >> 6) & 0x3F);
+                    *out++ = 0x80 | (codePoint & 0x3F);
+                    continue;
+                }
+
+                *out++ = 0xE0 | (character >> 12);
+                *out++ = 0x80 | ((character >> 6) & 0x3F);
+                *out++ = 0x80 | (character & 0x3F);
+            }
+        }
+
+        m_used = out - m_chunk.data();
+    }
+}
+
+void JSONUTF8Serializer::appendNumber(JSValue value)
+{
+    if (value.isInt32()) {
+        int32_t number = value.asInt32();
+        uint8_t* out = reserve(11);
+        uint32_t magnitude = number < 0 ? -static_cast<uint32_t>(number) : number;
+        if (number < 0)
+            *out++ = '-';
+        uint8_t digits[10];
+        unsigned count = 0;
+        do {
+            digits[count++] = '0' + magnitude % 10;
+            magnitude /= 10;
+        } while (magnitude);
+        while (count)
+            *out++ = digits[--count];
+        m_used = out - m_chunk.data();
+        return;
+    }
+
+    double number = value.asDouble();
+    if (!std::isfinite(number)) {
+        appendASCII("null", 4);
+        return;
+    }
+
+    NumberToStringBuffer buffer;
+    const char* string = WTF::numberToString(number, buffer);
+    appendASCII(string, strlen(string));
+}
+
+void JSONUTF8Serializer::writePendingKey()
+{
+    if (!m_pendingKey)
+        return;
+
+    if (m_pendingKeyNeedsComma)
+        appendCharacter(',');
+    UniquedStringImpl* key = std::exchange(m_pendingKey, nullptr);
+    if (key->is8Bit())
+        appendQuoted(key->characters8(), key->length());
+    else
+        appendQuoted(key->characters16(), key->length());
+    appendCharacter(':');
+}
+
+static bool canSerializeStructureDirectly(Structure* structure)
+{
+    if (structure->typeInfo().overridesGetOwnPropertySlot())
+        return false;
+    if (structure->typeInfo().overridesAnyFormOfGetOwnPropertyNames())
+        return false;
+    if (hasIndexedProperties(structure->indexingType()))
+        return false;
+    if (structure->hasGetterSetterProperties())
+        return false;
+    if (structure->hasCustomGetterSetterProperties())
+        return false;
+    if (structure->isUncacheableDictionary())
+        return false;
+    return true;
+}
+
+// Serializes the value stored under key, like SerializeJSONProperty. Returns
+// false without writing anything for the values JSON.stringify leaves out:
+// undefined, functions and symbols.
+bool JSONUTF8Serializer::appendValue(JSValue value, const Key& key)
+{
+    VM& vm = m_globalObject->vm();
+    auto scope = DECLARE_THROW_SCOPE(vm);
+
+    // Nothing more can be written, so stop walking the value.
+    if (UNLIKELY(m_writeFailed))
+        return false;
+
+    if (value.isNumber()) {
+        writePendingKey();
+        appendNumber(value);
+        return true;
+    }
+
+    if (value.isString()) {
+        String string = asString(value)->value(m_globalObject);
+        RETURN_IF_EXCEPTION(scope, false);
+        writePendingKey();
+        appendQuoted(string);
+        return true;
+    }
+
+    if (value.isNull()) {
+        writePendingKey();
+        appendASCII("null", 4);
+        return true;
+    }
+
+    if (value.isBoolean()) {
+        writePendingKey();
+        if (value.isTrue())
+            appendASCII("true", 4);
+        else
+            appendASCII("false", 5);
+        return true;
+    }
+
+    if (!value.isObject()) {
+        // A BigInt throws unless BigInt.prototype.toJSON is defined.
+        if (value.isBigInt())
+            RELEASE_AND_RETURN(scope, appendStringified(value, key));
+        return false;
+    }
+
+    JSObject* object = asObject(value);
+    if (object->isCallable())
+        return false;
+
+    JSType type = object->type();
+    if (type != FinalObjectType && type != ArrayType)
+        RELEASE_AND_RETURN(scope, appendStringified(value, key));
+
+    Structure* structure = object->structure();
+    if (type == FinalObjectType && !canSerializeStructureDirectly(structure))
+        RELEASE_AND_RETURN(scope, appendStringified(value, key));
+
+    PropertySlot slot(object, PropertySlot::InternalMethodType::Get);
+    bool hasToJSON = object->getPropertySlot(m_globalObject, vm.propertyNames->toJSON, slot);
+    RETURN_IF_EXCEPTION(scope, false);
+    if (hasToJSON)
+        RELEASE_AND_RETURN(scope, appendStringified(value, key));
+
+    if (UNLIKELY(!vm.isSafeToRecurseSoft())) {
+        throwStackOverflowError(m_globalObject, scope);
+        return false;
+    }
+
+    if (UNLIKELY(m_stack.contains(object))) {
+        throwTypeError(m_globalObject, scope, "JSON.stringify cannot serialize cyclic structures."_s);
+        return false;
+    }
+
+    writePendingKey();
+    m_stack.append(object);
+    if (type == ArrayType)
+        appendArray(jsCast<JSArray*>(object));
+    else
+        appendObject(object, structure);
+    m_stack.removeLast();
+    RETURN_IF_EXCEPTION(scope, false);
+    return true;
+}
+
+bool JSONUTF8Serializer::appendObject(JSObject* object, Structure* structure)
+{
+    VM& vm = m_globalObject->vm();
+    auto scope = DECLARE_THROW_SCOPE(vm);
+
+    // The keys are fixed before any value is serialized. A toJSON or getter
+    // further down can still change the object, in which case the values are
+    // looked up again by name.
+    StructureID structureID = structure->id();
+    Vector<std::pair<RefPtr<UniquedStringImpl>, PropertyOffset>, 16> properties;
+    structure->forEachProperty(vm, [&](const PropertyTableEntry& entry) -> bool {
+        if (!(entry.attributes() & PropertyAttribute::DontEnum) && !entry.key()->isSymbol())
+            properties.append({ entry.key(), entry.offset() });
+        return true;
+    });
+
+    appendCharacter('{');
+    bool wroteMember = false;
+    for (auto& [name, offset] : properties) {
+        JSValue value = object->structureID() == structureID
+            ? object->getDirect(offset)
+            : object->get(m_globalObject, PropertyName(name.get()));
+        RETURN_IF_EXCEPTION(scope, false);
+
+        m_pendingKey = name.get();
+        m_pendingKeyNeedsComma = wroteMember;
+        if (appendValue(value, Key { name.get(), 0 }))
+            wroteMember = true;
+        m_pendingKey = nullptr;
+        RETURN_IF_EXCEPTION(scope, false);
+    }
+    appendCharacter('}');
+    return true;
+}
+
+void JSONUTF8Serializer::appendArray(JSArray* array)
+{
+    VM& vm = m_globalObject->vm();
+    auto scope = DECLARE_THROW_SCOPE(vm);
+
+    unsigned length = array->length();
+    appendCharacter('[');
+    for (unsigned i = 0; i < length; i++) {
+        if (i)
+            appendCharacter(',');
+
+        JSValue element = array->canGetIndexQuickly(i)
+            ? array->getIndexQuickly(i)
+            : array->get(m_globalObject, i);
+        RETURN_IF_EXCEPTION(scope, void());
+
+        // Arrays of numbers skip the dispatch in appendValue().
+        if (element.isNumber()) {
+            appendNumber(element);
+            continue;
+        }
+
+        if (!appendValue(element, Key { nullptr, i }))
+            appendASCII("null", 4);
+        RETURN_IF_EXCEPTION(scope, void());
+    }
+    appendCharacter(']');
+}
+
+// JSON.stringify({ [key]: value }) calls toJSON with the right key, and the
+// serialized value is what follows the key.
+bool JSONUTF8Serializer::appendStringified(JSValue value, const Key& key)
+{
+    VM& vm = m_globalObject->vm();
+    auto scope = DECLARE_THROW_SCOPE(vm);
+
+    JSObject* holder = constructEmptyObject(m_globalObject);
+    Identifier name = key.name ? Identifier::fromUid(vm, key.name) : Identifier::from(vm, key.index);
+    holder->putDirectMayBeIndex(m_globalObject, name, value);
+    RETURN_IF_EXCEPTION(scope, false);
+
+    String json = JSONStringify(m_globalObject, holder, 0);
+    RETURN_IF_EXCEPTION(scope, false);
+
+    // `{}` when the value is left out, otherwise `{"key":value}`.
+    unsigned length = json.length();
+    if (length <= 2)
+        return false;
+    unsigned start = 2;
+    while (json[start] != '"')
+        start += json[start] == '\\' ? 2 : 1;
+    start += 2;
+    ASSERT(json[start - 1] == ':');
+
+    writePendingKey();
+    if (json.is8Bit())
+        appendJSON(json.characters8() + start, length - 1 - start);
+    else
+        appendJSON(json.characters16() + start, length - 1 - start);
+    return true;
+}
+
+bool JSONUTF8Serializer::serialize(JSValue value)
+{
+    VM& vm = m_globalObject->vm();
+    auto scope = DECLARE_THROW_SCOPE(vm);
+
+    appendValue(value, Key { vm.propertyNames->emptyIdentifier.impl(), 0 });
+    RETURN_IF_EXCEPTION(scope, false);
+    flush();
+    if (UNLIKELY(m_writeFailed)) {
+        throwOutOfMemoryError(m_globalObject, scope);
+        return false;
+    }
+    return true;
+}
+
+}
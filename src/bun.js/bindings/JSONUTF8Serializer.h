@@ -0,0 +1,72 @@
+#pragma once
+
+#include "root.h"
+
+namespace Bun {
+
+// Serializes like JSON.stringify(value) without a replacer or indentation,
+// but into UTF-8 bytes handed to write() a chunk at a time as they fill up,
+// instead of into a string holding the whole document, which is UTF-16 as
+// soon as one character needs it and then has to be transcoded again.
+//
+// Plain objects with cacheable structures and arrays are walked directly.
+// Anything else, including values with a toJSON method, is handed to
+// JSC::JSONStringify, so the output is always what JSON.stringify returns.
+class JSONUTF8Serializer {
+    WTF_MAKE_NONCOPYABLE(JSONUTF8Serializer);
+
+public:
+    // Returns false when it runs out of memory.
+    using WriteFunction = bool (*)(void* context, const uint8_t* bytes, size_t length);
+
+    JSONUTF8Serializer(JSC::JSGlobalObject*, void* context, WriteFunction);
+
+    // Returns false if an exception was thrown, in which case part of the
+    // document may have been written already. A write that fails throws an
+    // out of memory error. Writes nothing when
+    // JSON.stringify would return undefined.
+    bool serialize(JSC::JSValue);
+
+    bool isAllASCII() const { return m_isAllASCII; }
+
+private:
+    // The key a value is stored under, which toJSON is called with.
+    struct Key {
+        UniquedStringImpl* name;
+        unsigned index;
+    };
+
+    bool appendValue(JSC::JSValue, const Key&);
+    bool appendObject(JSC::JSObject*, JSC::Structure*);
+    void appendArray(JSC::JSArray*);
+    bool appendStringified(JSC::JSValue, const Key&);
+
+    void appendNumber(JSC::JSValue);
+    template<typename CharacterType> void appendQuoted(const CharacterType*, unsigned length);
+    template<typename CharacterType> void appendJSON(const CharacterType*, unsigned length);
+    void appendQuoted(const String&);
+    void appendCharacter(uint8_t);
+    void appendASCII(const char*, size_t length);
+    void writePendingKey();
+
+    uint8_t* reserve(size_t length);
+    void makeRoom(size_t length);
+    void flush();
+
+    JSC::JSGlobalObject* m_globalObject;
+    void* m_context;
+    WriteFunction m_write;
+    Vector<uint8_t> m_chunk;
+    size_t m_used { 0 };
+    bool m_isAllASCII { true };
+    bool m_writeFailed { false };
+
+    // The key of the object member being serialized, written only once its
+    // value turns out not to be skipped.
+    UniquedStringImpl* m_pendingKey { nullptr };
+    bool m_pendingKeyNeedsComma { false };
+
+    Vector<JSC::JSObject*, 16> m_stack;
+};
+
+}
@@ -7,6 +7,8 @@
 #include "JSDOMAttribute.h"
 #include "headers.h"
 #include "JSDOMConvertEnumeration.h"
+#include "simdutf.h"
+#include <wtf/unicode/CharacterNames.h>
 
 namespace WebCore {
 
@@ -29,26 +31,6 @@ JSC::JSValue JSStringDecoder::fillLast(JSC::VM& vm, JSC::JSGlobalObject* globalO
 {
     auto throwScope = DECLARE_THROW_SCOPE(vm);
 
-    if (m_encoding == BufferEncodingType::utf8) {
-        // utf8CheckExtraBytes
-        if ((bufPtr[0] & 0xC0) != 0x80) {
-            m_lastNeed = 0;
-            RELEASE_AND_RETURN(throwScope, JSC::jsString(vm, WTF::String(u"\uFFFD", 1)));
-        }
-        if (m_lastNeed > 1 && length > 1) {
-            if ((bufPtr[1] & 0xC0) != 0x80) {
-                m_lastNeed = 1;
-                RELEASE_AND_RETURN(throwScope, JSC::jsString(vm, WTF::String(u"\uFFFD", 1)));
-            }
-            if (m_lastNeed > 2 && length > 2) {
-                if ((bufPtr[2] & 0xC0) != 0x80) {
-                    m_lastNeed = 2;
-                    RELEASE_AND_RETURN(throwScope, JSC::jsString(vm, WTF::String(u"\uFFFD", 1)));
-                }
-            }
-        }
-    }
-
     if (m_lastNeed <= length) {
         memmove(m_lastChar + m_lastTotal - m_lastNeed, bufPtr, m_lastNeed);
         RELEASE_AND_RETURN(throwScope, JSC::JSValue::decode(Bun__encoding__toString(m_lastChar, m_lastTotal, globalObject, static_cast<uint8_t>(m_encoding))));
@@ -78,16 +60,16 @@ int8_t utf8CheckByte(uint8_t byte)
 // needed to complete the UTF-8 character (if applicable) are returned.
 uint8_t JSStringDecoder::utf8CheckIncomplete(uint8_t* bufPtr, uint32_t length, uint32_t i)
 {
-    uint32_t j = length - 1;
-    if (j < i)
+    if (length <= i)
         return 0;
+    uint32_t j = length - 1;
     int8_t nb = utf8CheckByte(bufPtr[j]);
     if (nb >= 0) {
         if (nb > 0)
             m_lastNeed = nb - 1;
         return nb;
     }
-    if (--j < i || nb == -2)
+    if (j-- == i || nb == -2)
         return 0;
     nb = utf8CheckByte(bufPtr[j]);
     if (nb >= 0) {
@@ -95,7 +77,7 @@ uint8_t JSStringDecoder::utf8CheckIncomplete(uint8_t* bufPtr, uint32_t length, u
             m_lastNeed = nb - 2;
         return nb;
     }
-    if (--j < i || nb == -2)
+    if (j-- == i || nb == -2)
         return 0;
     nb = utf8CheckByte(bufPtr[j]);
     if (nb >= 0) {
@@ -136,16 +118,6 @@ JSC::JSValue JSStringDecoder::text(JSC::VM& vm, JSC::JSGlobalObject* globalObjec
         m_lastChar[0] = bufPtr[length - 1];
         RELEASE_AND_RETURN(throwScope, JSC::JSValue::decode(Bun__encoding__toString(bufPtr + offset, length - offset - 1, globalObject, static_cast<uint8_t>(m_encoding))));
     }
-    case BufferEncodingType::utf8: {
-        uint32_t total = utf8CheckIncomplete(bufPtr, length, offset);
-        if (!m_lastNeed)
-            RELEASE_AND_RETURN(throwScope, JSC::JSValue::decode(Bun__encoding__toString(bufPtr + offset, length - offset, globalObject, static_cast<uint8_t>(m_encoding))));
-        m_lastTotal = total;
-        uint32_t end = length - (total - m_lastNeed);
-        if (end < length)
-            memmove(m_lastChar, bufPtr + end, std::min(4U, length - end));
-        RELEASE_AND_RETURN(throwScope, JSC::JSValue::decode(Bun__encoding__toString(bufPtr + offset, end - offset, globalObject, static_cast<uint8_t>(m_encoding))));
-    }
     case BufferEncodingType::base64:
     case BufferEncodingType::base64url: {
         uint32_t n = (length - offset) % 3;
@@ -168,6 +140,106 @@ JSC::JSValue JSStringDecoder::text(JSC::VM& vm, JSC::JSGlobalObject* globalObjec
     }
 }
 
+// Decodes head followed by body as one string. head is the code point carried
+// over from the previous write, so body starts on a code point boundary and
+// valid input needs no copy.
+static JSC::JSValue decodeUTF8(JSC::VM& vm, JSC::JSGlobalObject* globalObject, const uint8_t* head, size_t headLength, const uint8_t* body, size_t bodyLength)
+{
+    auto throwScope = DECLARE_THROW_SCOPE(vm);
+    const char* headChars = reinterpret_cast<const char*>(head);
+    const char* bodyChars = reinterpret_cast<const char*>(body);
+
+    if (!headLength) {
+        if (!bodyLength)
+            RELEASE_AND_RETURN(throwScope, JSC::jsEmptyString(vm));
+        if (simdutf::validate_ascii(bodyChars, bodyLength)) {
+            LChar* data = nullptr;
+            auto impl = bodyLength <= WTF::StringImpl::MaxLength ? WTF::StringImpl::tryCreateUninitialized(bodyLength, data) : nullptr;
+            if (UNLIKELY(!impl)) {
+                throwOutOfMemoryError(globalObject, throwScope);
+                return {};
+            }
+            memcpy(data, body, bodyLength);
+            RELEASE_AND_RETURN(throwScope, JSC::jsString(vm, WTF::String(WTFMove(impl))));
+        }
+    }
+
+    if (simdutf::validate_utf8(headChars, headLength) && simdutf::validate_utf8(bodyChars, bodyLength)) {
+        size_t headUTF16Length = simdutf::utf16_length_from_utf8(headChars, headLength);
+        size_t utf16Length = headUTF16Length + simdutf::utf16_length_from_utf8(bodyChars, bodyLength);
+        UChar* data = nullptr;
+        auto impl = utf16Length <= WTF::StringImpl::MaxLength ? WTF::StringImpl::tryCreateUninitialized(utf16Length, data) : nullptr;
+        if (UNLIKELY(!impl)) {
+            throwOutOfMemoryError(globalObject, throwScope);
+            return {};
+        }
+        (void)simdutf::convert_valid_utf8_to_utf16le(headChars, headLength, reinterpret_cast<char16_t*>(data));
+        (void)simdutf::convert_valid_utf8_to_utf16le(bodyChars, bodyLength, reinterpret_cast<char16_t*>(data + headUTF16Length));
+        RELEASE_AND_RETURN(throwScope, JSC::jsString(vm, WTF::String(WTFMove(impl))));
+    }
+
+    // Invalid UTF-8 goes through the replacing decoder in one piece, so that
+    // a bad sequence split across writes is replaced as if it were not.
+    if (!headLength)
+        RELEASE_AND_RETURN(throwScope, JSC::JSValue::decode(Bun__encoding__toString(body, bodyLength, globalObject, static_cast<uint8_t>(BufferEncodingType::utf8))));
+
+    Vector<uint8_t> combined;
+    combined.reserveInitialCapacity(headLength + bodyLength);
+    combined.append(head, headLength);
+    combined.append(body, bodyLength);
+    RELEASE_AND_RETURN(throwScope, JSC::JSValue::decode(Bun__encoding__toString(combined.data(), combined.size(), globalObject, static_cast<uint8_t>(BufferEncodingType::utf8))));
+}
+
+JSC::JSValue JSStringDecoder::writeUTF8(JSC::VM& vm, JSC::JSGlobalObject* globalObject, uint8_t* bufPtr, uint32_t length, bool flush)
+{
+    auto throwScope = DECLARE_THROW_SCOPE(vm);
+    if (length == 0 && !m_lastNeed)
+        RELEASE_AND_RETURN(throwScope, JSC::jsEmptyString(vm));
+
+    // Complete the code point left over from the last write with as many
+    // continuation bytes as this chunk has for it. If another byte or end()
+    // cuts it short, the whole sequence becomes a single U+FFFD, as in Node.
+    uint8_t head[4];
+    uint32_t headLength = 0;
+    uint32_t offset = 0;
+    if (m_lastNeed) {
+        headLength = m_lastTotal - m_lastNeed;
+        memcpy(head, m_lastChar, headLength);
+        while (offset < m_lastNeed && offset < length && (bufPtr[offset] & 0xC0) == 0x80)
+            head[headLength++] = bufPtr[offset++];
+
+        if (offset < m_lastNeed) {
+            if (!flush && offset == length) {
+                memcpy(m_lastChar, head, headLength);
+                m_lastNeed -= offset;
+                RELEASE_AND_RETURN(throwScope, JSC::jsEmptyString(vm));
+            }
+            static constexpr uint8_t replacementCharacterUTF8[] = { 0xEF, 0xBF, 0xBD };
+            memcpy(head, replacementCharacterUTF8, sizeof(replacementCharacterUTF8));
+            headLength = sizeof(replacementCharacterUTF8);
+        }
+        m_lastNeed = 0;
+    }
+
+    // Hold back an incomplete code point at the end for the next write. On
+    // end() it is replaced by a single U+FFFD instead.
+    uint32_t end = length;
+    uint32_t total = utf8CheckIncomplete(bufPtr, length, offset);
+    if (m_lastNeed) {
+        end = length - (total - m_lastNeed);
+        if (flush) {
+            m_lastNeed = 0;
+            JSC::JSValue decoded = decodeUTF8(vm, globalObject, head, headLength, bufPtr + offset, end - offset);
+            RETURN_IF_EXCEPTION(throwScope, {});
+            RELEASE_AND_RETURN(throwScope, JSC::jsString(globalObject, asString(decoded), JSC::jsString(vm, WTF::String(&WTF::Unicode::replacementCharacter, 1))));
+        }
+        m_lastTotal = total;
+        memcpy(m_lastChar, bufPtr + end, length - end);
+    }
+
+    RELEASE_AND_RETURN(throwScope, decodeUTF8(vm, globalObject, head, headLength, bufPtr + offset, end - offset));
+}
+
 JSC::JSValue JSStringDecoder::write(JSC::VM& vm, JSC::JSGlobalObject* globalObject, uint8_t* bufPtr, uint32_t length)
 {
     auto throwScope = DECLARE_THROW_SCOPE(vm);
@@ -175,9 +247,11 @@ JSC::JSValue JSStringDecoder::write(JSC::VM& vm, JSC::JSGlobalObject* globalObje
         RELEASE_AND_RETURN(throwScope, JSC::jsEmptyString(vm));
 
     switch (m_encoding) {
+    case BufferEncodingType::utf8: {
+        RELEASE_AND_RETURN(throwScope, writeUTF8(vm, globalObject, bufPtr, length, false));
+    }
     case BufferEncodingType::ucs2:
     case BufferEncodingType::utf16le:
-    case BufferEncodingType::utf8:
     case BufferEncodingType::base64:
     case BufferEncodingType::base64url: {
         uint32_t offset = 0;
@@ -228,12 +302,7 @@ JSC::JSValue JSStringDecoder::end(JSC::VM& vm, JSC::JSGlobalObject* globalObject
         }
     }
     case BufferEncodingType::utf8: {
-        if (length == 0) {
-            RELEASE_AND_RETURN(throwScope, m_lastNeed ? JSC::jsString(vm, WTF::String(u"\uFFFD", 1)) : JSC::jsEmptyString(vm));
-        }
-        JSString* firstHalf = write(vm, globalObject, bufPtr, length).toString(globalObject);
-        RETURN_IF_EXCEPTION(throwScope, JSC::jsUndefined());
-        RELEASE_AND_RETURN(throwScope, m_lastNeed ? JSC::jsString(globalObject, firstHalf, WTF::String(u"\uFFFD", 1)) : firstHalf);
+        RELEASE_AND_RETURN(throwScope, writeUTF8(vm, globalObject, bufPtr, length, true));
     }
     case BufferEncodingType::base64:
     case BufferEncodingType::base64url: {
@@ -55,6 +55,7 @@ public:
 private:
     JSC::JSValue fillLast(JSC::VM&, JSC::JSGlobalObject*, uint8_t*, uint32_t);
     JSC::JSValue text(JSC::VM&, JSC::JSGlobalObject*, uint8_t*, uint32_t, uint32_t);
+    JSC::JSValue writeUTF8(JSC::VM&, JSC::JSGlobalObject*, uint8_t*, uint32_t, bool flush);
     uint8_t utf8CheckIncomplete(uint8_t*, uint32_t, uint32_t);
 
     BufferEncodingType m_encoding;
@@ -3,6 +3,7 @@
 
 #include "BunClientData.h"
 
+#include "JavaScriptCore/DOMJITAbstractHeap.h"
 #include "JavaScriptCore/JSFunction.h"
 #include "JavaScriptCore/JSMicrotask.h"
 #include "JavaScriptCore/ObjectConstructor.h"
@@ -27,24 +28,15 @@ namespace JSCastingHelpers = JSC::JSCastingHelpers;
 
 using namespace JSC;
 
+// The platform is baked into each function instead of being read off of
+// `this`, so the functions also work when called detached from the module
+// object. Arguments are handed to Zig straight from the call frame.
 // clang-format off
-#define DEFINE_CALLBACK_FUNCTION_BODY(ZigFunction) JSC::VM& vm = globalObject->vm(); \
-    auto* thisObject = JSC::jsDynamicCast<JSC::JSFinalObject*>( callFrame->thisValue()); \
+#define DEFINE_CALLBACK_FUNCTION_BODY(ZigFunction, isWindows) JSC::VM& vm = globalObject->vm(); \
     auto scope = DECLARE_THROW_SCOPE(vm); \
-    if (!thisObject) \
-        return throwVMTypeError(globalObject, scope); \
     auto argCount = static_cast<uint16_t>(callFrame->argumentCount()); \
-    WTF::Vector<JSC::EncodedJSValue, 16> arguments; \
-    arguments.reserveInitialCapacity(argCount); \
-     if (argCount) { \
-        for (uint16_t i = 0; i < argCount; ++i) { \
-            arguments.uncheckedAppend(JSC::JSValue::encode(callFrame->uncheckedArgument(i))); \
-        } \
-     } \
-    auto clientData = WebCore::clientData(vm); \
-    auto isWindows = thisObject->get(globalObject, clientData->builtinNames().isWindowsPrivateName()); \
     JSC::JSValue result = JSC::JSValue::decode( \
-        ZigFunction(globalObject, isWindows.asBoolean(), reinterpret_cast<JSC__JSValue*>(arguments.data()), argCount) \
+        ZigFunction(globalObject, isWindows, reinterpret_cast<JSC__JSValue*>(callFrame->addressOfArgumentsStart()), argCount) \
     ); \
     JSC::JSObject *obj = result.getObject(); \
     if (UNLIKELY(obj != nullptr && obj->isErrorInstance())) { \
@@ -55,69 +47,468 @@ using namespace JSC;
         return JSC::JSValue::encode(JSC::jsUndefined()); \
     return JSC::JSValue::encode(result);
 
+#define DEFINE_PATH_FUNCTION(name, ZigFunction) \
+    static JSC_DECLARE_HOST_FUNCTION(Path_function##name##Posix); \
+    static JSC_DEFINE_HOST_FUNCTION(Path_function##name##Posix, \
+        (JSC::JSGlobalObject * globalObject, JSC::CallFrame* callFrame)) \
+    { \
+        DEFINE_CALLBACK_FUNCTION_BODY(ZigFunction, false); \
+    } \
+    static JSC_DECLARE_HOST_FUNCTION(Path_function##name##Win32); \
+    static JSC_DEFINE_HOST_FUNCTION(Path_function##name##Win32, \
+        (JSC::JSGlobalObject * globalObject, JSC::CallFrame* callFrame)) \
+    { \
+        DEFINE_CALLBACK_FUNCTION_BODY(ZigFunction, true); \
+    }
+
 // clang-format on
 
-static JSC_DECLARE_HOST_FUNCTION(Path_functionBasename);
-static JSC_DEFINE_HOST_FUNCTION(Path_functionBasename,
+#pragma mark - posix fast paths
+
+// These follow Node's implementations for string arguments of either width.
+// basename, dirname and extname return substrings of the input, so nothing
+// is copied.
+
+static JSC::JSString* substringOrSelf(JSC::VM& vm, JSC::JSString* input, const WTF::String& string, unsigned start, unsigned end)
+{
+    if (start == 0 && end == string.length())
+        return input;
+    if (start == end)
+        return JSC::jsEmptyString(vm);
+    return JSC::jsSubstring(vm, string, start, end - start);
+}
+
+template<typename CharacterType>
+static JSC::JSString* basenamePosix(JSC::VM& vm, JSC::JSString* input, const WTF::String& string, const CharacterType* chars, const WTF::String* ext)
+{
+    unsigned length = string.length();
+    unsigned end = length;
+    while (end > 0 && chars[end - 1] == '/')
+        end--;
+    if (end == 0)
+        return JSC::jsEmptyString(vm);
+    unsigned start = end;
+    while (start > 0 && chars[start - 1] != '/')
+        start--;
+
+    if (ext) {
+        unsigned baseLength = end - start;
+        if ((ext->length() != baseLength || baseLength == length) && ext->length() <= baseLength
+            && WTF::StringView(string).substring(end - ext->length(), ext->length()) == *ext)
+            end -= ext->length();
+    }
+
+    return substringOrSelf(vm, input, string, start, end);
+}
+
+static JSC::JSString* basenamePosix(JSC::JSGlobalObject* globalObject, JSC::JSString* input, JSC::JSString* suffix)
+{
+    JSC::VM& vm = globalObject->vm();
+    auto scope = DECLARE_THROW_SCOPE(vm);
+    const WTF::String& string = input->value(globalObject);
+    RETURN_IF_EXCEPTION(scope, nullptr);
+
+    const WTF::String* ext = nullptr;
+    if (suffix) {
+        ext = &suffix->value(globalObject);
+        RETURN_IF_EXCEPTION(scope, nullptr);
+    }
+
+    if (string.is8Bit())
+        return basenamePosix(vm, input, string, string.characters8(), ext);
+    return basenamePosix(vm, input, string, string.characters16(), ext);
+}
+
+template<typename CharacterType>
+static JSC::JSString* dirnamePosix(JSC::VM& vm, JSC::JSString* input, const WTF::String& string, const CharacterType* chars)
+{
+    unsigned length = string.length();
+    if (length == 0)
+        return JSC::jsSingleCharacterString(vm, '.');
+
+    bool hasRoot = chars[0] == '/';
+    unsigned end = 0;
+    bool matchedSlash = true;
+    for (unsigned i = length - 1; i >= 1; --i) {
+        if (chars[i] == '/') {
+            if (!matchedSlash) {
+                end = i;
+                break;
+            }
+        } else {
+            matchedSlash = false;
+        }
+    }
+
+    if (end == 0)
+        return JSC::jsSingleCharacterString(vm, hasRoot ? '/' : '.');
+    if (hasRoot && end == 1)
+        return substringOrSelf(vm, input, string, 0, 2);
+    return substringOrSelf(vm, input, string, 0, end);
+}
+
+static JSC::JSString* dirnamePosix(JSC::JSGlobalObject* globalObject, JSC::JSString* input)
+{
+    JSC::VM& vm = globalObject->vm();
+    auto scope = DECLARE_THROW_SCOPE(vm);
+    const WTF::String& string = input->value(globalObject);
+    RETURN_IF_EXCEPTION(scope, nullptr);
+
+    if (string.is8Bit())
+        return dirnamePosix(vm, input, string, string.characters8());
+    return dirnamePosix(vm, input, string, string.characters16());
+}
+
+template<typename CharacterType>
+static JSC::JSString* extnamePosix(JSC::VM& vm, JSC::JSString* input, const WTF::String& string, const CharacterType* chars)
+{
+    unsigned length = string.length();
+    int startDot = -1;
+    int startPart = 0;
+    int end = -1;
+    bool matchedSlash = true;
+    // 0: no dot seen before the last one, 1: only dots, -1: a regular character.
+    int preDotState = 0;
+    for (int i = static_cast<int>(length) - 1; i >= 0; --i) {
+        CharacterType c = chars[i];
+        if (c == '/') {
+            if (!matchedSlash) {
+                startPart = i + 1;
+                break;
+            }
+            continue;
+        }
+        if (end == -1) {
+            matchedSlash = false;
+            end = i + 1;
+        }
+        if (c == '.') {
+            if (startDot == -1)
+                startDot = i;
+            else if (preDotState != 1)
+                preDotState = 1;
+        } else if (startDot != -1) {
+            preDotState = -1;
+        }
+    }
+
+    if (startDot == -1 || end == -1 || preDotState == 0
+        || (preDotState == 1 && startDot == end - 1 && startDot == startPart + 1))
+        return JSC::jsEmptyString(vm);
+
+    return substringOrSelf(vm, input, string, startDot, end);
+}
+
+static JSC::JSString* extnamePosix(JSC::JSGlobalObject* globalObject, JSC::JSString* input)
+{
+    JSC::VM& vm = globalObject->vm();
+    auto scope = DECLARE_THROW_SCOPE(vm);
+    const WTF::String& string = input->value(globalObject);
+    RETURN_IF_EXCEPTION(scope, nullptr);
+
+    if (string.is8Bit())
+        return extnamePosix(vm, input, string, string.characters8());
+    return extnamePosix(vm, input, string, string.characters16());
+}
+
+// Node's normalizeString() with '/' as the separator: appends path to result
+// with empty and '.' segments dropped and '..' segments applied.
+template<typename CharacterType>
+static void normalizeStringPosix(const CharacterType* path, unsigned length, bool allowAboveRoot, Vector<CharacterType>& result)
+{
+    unsigned lastSegmentLength = 0;
+    int lastSlash = -1;
+    int dots = 0;
+    CharacterType code = 0;
+    for (unsigned i = 0; i <= length; ++i) {
+        if (i < length)
+            code = path[i];
+        else if (code == '/')
+            break;
+        else
+            code = '/';
+
+        if (code != '/') {
+            if (code == '.' && dots != -1)
+                ++dots;
+            else
+                dots = -1;
+            continue;
+        }
+
+        if (lastSlash == static_cast<int>(i) - 1 || dots == 1) {
+            // An empty or '.' segment.
+        } else if (dots == 2) {
+            size_t size = result.size();
+            if (size < 2 || lastSegmentLength != 2 || result[size - 1] != '.' || result[size - 2] != '.') {
+                if (size > 2) {
+                    size_t lastSlashIndex = result.reverseFind('/');
+                    if (lastSlashIndex == WTF::notFound) {
+                        result.shrink(0);
+                        lastSegmentLength = 0;
+                    } else {
+                        result.shrink(lastSlashIndex);
+                        size_t previousSlash = result.reverseFind('/');
+                        lastSegmentLength = previousSlash == WTF::notFound ? result.size() : result.size() - 1 - previousSlash;
+                    }
+                    lastSlash = i;
+                    dots = 0;
+                    continue;
+                }
+                if (size) {
+                    result.shrink(0);
+                    lastSegmentLength = 0;
+                    lastSlash = i;
+                    dots = 0;
+                    continue;
+                }
+            }
+            if (allowAboveRoot) {
+                if (!result.isEmpty())
+                    result.append('/');
+                result.append('.');
+                result.append('.');
+                lastSegmentLength = 2;
+            }
+        } else {
+            if (!result.isEmpty())
+                result.append('/');
+            result.append(path + lastSlash + 1, i - lastSlash - 1);
+            lastSegmentLength = i - lastSlash - 1;
+        }
+        lastSlash = i;
+        dots = 0;
+    }
+}
+
+// posix join() and resolve() both normalize their non-empty arguments joined
+// with '/'. resolve() only gets here once one of them is absolute, so it
+// never needs the working directory.
+template<typename CharacterType>
+static JSC::JSString* joinAndNormalizePosix(JSC::VM& vm, const Vector<WTF::String, 8>& parts, bool isResolve)
+{
+    Vector<CharacterType> joined;
+    for (auto& part : parts) {
+        if (!joined.isEmpty())
+            joined.append('/');
+        size_t offset = joined.size();
+        joined.grow(offset + part.length());
+        WTF::StringView(part).getCharactersWithUpconvert(joined.data() + offset);
+    }
+    if (joined.isEmpty())
+        return JSC::jsSingleCharacterString(vm, '.');
+
+    bool isAbsolute = joined[0] == '/';
+    bool trailingSeparator = !isResolve && joined.last() == '/';
+
+    Vector<CharacterType> result;
+    result.reserveInitialCapacity(joined.size() + 2);
+    if (isAbsolute)
+        result.append('/');
+    Vector<CharacterType> normalized;
+    normalizeStringPosix(joined.data(), joined.size(), !isAbsolute, normalized);
+    result.appendVector(normalized);
+
+    if (result.isEmpty())
+        return JSC::jsString(vm, WTF::String(trailingSeparator ? "./"_s : "."_s));
+    if (trailingSeparator && !normalized.isEmpty())
+        result.append('/');
+    return JSC::jsString(vm, WTF::String(result.data(), result.size()));
+}
+
+static JSC::JSString* joinAndNormalizePosix(JSC::VM& vm, const Vector<WTF::String, 8>& parts, bool isResolve)
+{
+    for (auto& part : parts) {
+        if (!part.is8Bit())
+            return joinAndNormalizePosix<UChar>(vm, parts, isResolve);
+    }
+    return joinAndNormalizePosix<LChar>(vm, parts, isResolve);
+}
+
+// Collects the non-empty arguments from `first` on, or returns false if one
+// of them is not a string.
+static bool nonEmptyStringArguments(JSC::JSGlobalObject* globalObject, JSC::CallFrame* callFrame, size_t first, Vector<WTF::String, 8>& parts)
+{
+    auto scope = DECLARE_THROW_SCOPE(globalObject->vm());
+    for (size_t i = first; i < callFrame->argumentCount(); i++) {
+        JSC::JSValue argument = callFrame->uncheckedArgument(i);
+        if (!argument.isString())
+            return false;
+        const WTF::String& part = asString(argument)->value(globalObject);
+        RETURN_IF_EXCEPTION(scope, false);
+        if (!part.isEmpty())
+            parts.append(part);
+    }
+    return true;
+}
+
+static JSC_DECLARE_HOST_FUNCTION(Path_functionBasenamePosix);
+static JSC_DEFINE_HOST_FUNCTION(Path_functionBasenamePosix,
     (JSC::JSGlobalObject * globalObject, JSC::CallFrame* callFrame))
 {
-    DEFINE_CALLBACK_FUNCTION_BODY(Bun__Path__basename);
+    size_t argumentCount = callFrame->argumentCount();
+    if (argumentCount == 1 || argumentCount == 2) {
+        auto scope = DECLARE_THROW_SCOPE(globalObject->vm());
+        JSC::JSValue path = callFrame->uncheckedArgument(0);
+        JSC::JSValue suffix = callFrame->argument(1);
+        if (path.isString() && (suffix.isUndefined() || suffix.isString())) {
+            auto* result = basenamePosix(globalObject, asString(path), suffix.isString() ? asString(suffix) : nullptr);
+            RETURN_IF_EXCEPTION(scope, {});
+            if (result)
+                return JSC::JSValue::encode(result);
+        }
+    }
+
+    DEFINE_CALLBACK_FUNCTION_BODY(Bun__Path__basename, false);
 }
 
-static JSC_DECLARE_HOST_FUNCTION(Path_functionDirname);
-static JSC_DEFINE_HOST_FUNCTION(Path_functionDirname,
+static JSC_DECLARE_HOST_FUNCTION(Path_functionDirnamePosix);
+static JSC_DEFINE_HOST_FUNCTION(Path_functionDirnamePosix,
     (JSC::JSGlobalObject * globalObject, JSC::CallFrame* callFrame))
 {
-    DEFINE_CALLBACK_FUNCTION_BODY(Bun__Path__dirname);
+    if (callFrame->argumentCount() == 1 && callFrame->uncheckedArgument(0).isString()) {
+        auto scope = DECLARE_THROW_SCOPE(globalObject->vm());
+        auto* result = dirnamePosix(globalObject, asString(callFrame->uncheckedArgument(0)));
+        RETURN_IF_EXCEPTION(scope, {});
+        if (result)
+            return JSC::JSValue::encode(result);
+    }
+
+    DEFINE_CALLBACK_FUNCTION_BODY(Bun__Path__dirname, false);
 }
-static JSC_DECLARE_HOST_FUNCTION(Path_functionExtname);
-static JSC_DEFINE_HOST_FUNCTION(Path_functionExtname,
+
+static JSC_DECLARE_HOST_FUNCTION(Path_functionExtnamePosix);
+static JSC_DEFINE_HOST_FUNCTION(Path_functionExtnamePosix,
     (JSC::JSGlobalObject * globalObject, JSC::CallFrame* callFrame))
 {
-    DEFINE_CALLBACK_FUNCTION_BODY(Bun__Path__extname);
+    if (callFrame->argumentCount() == 1 && callFrame->uncheckedArgument(0).isString()) {
+        auto scope = DECLARE_THROW_SCOPE(globalObject->vm());
+        auto* result = extnamePosix(globalObject, asString(callFrame->uncheckedArgument(0)));
+        RETURN_IF_EXCEPTION(scope, {});
+        if (result)
+            return JSC::JSValue::encode(result);
+    }
+
+    DEFINE_CALLBACK_FUNCTION_BODY(Bun__Path__extname, false);
 }
-static JSC_DECLARE_HOST_FUNCTION(Path_functionFormat);
-static JSC_DEFINE_HOST_FUNCTION(Path_functionFormat,
+
+static JSC_DECLARE_HOST_FUNCTION(Path_functionJoinPosix);
+static JSC_DEFINE_HOST_FUNCTION(Path_functionJoinPosix,
     (JSC::JSGlobalObject * globalObject, JSC::CallFrame* callFrame))
 {
-    DEFINE_CALLBACK_FUNCTION_BODY(Bun__Path__format);
+    {
+        auto scope = DECLARE_THROW_SCOPE(globalObject->vm());
+        Vector<WTF::String, 8> parts;
+        bool allStrings = nonEmptyStringArguments(globalObject, callFrame, 0, parts);
+        RETURN_IF_EXCEPTION(scope, {});
+        if (allStrings)
+            return JSC::JSValue::encode(joinAndNormalizePosix(globalObject->vm(), parts, false));
+    }
+
+    DEFINE_CALLBACK_FUNCTION_BODY(Bun__Path__join, false);
 }
-static JSC_DECLARE_HOST_FUNCTION(Path_functionIsAbsolute);
-static JSC_DEFINE_HOST_FUNCTION(Path_functionIsAbsolute,
+
+static JSC_DECLARE_HOST_FUNCTION(Path_functionResolvePosix);
+static JSC_DEFINE_HOST_FUNCTION(Path_functionResolvePosix,
     (JSC::JSGlobalObject * globalObject, JSC::CallFrame* callFrame))
 {
-    DEFINE_CALLBACK_FUNCTION_BODY(Bun__Path__isAbsolute);
+    {
+        auto scope = DECLARE_THROW_SCOPE(globalObject->vm());
+        // Like Node, arguments before the last absolute one are ignored.
+        // Without an absolute one, Zig resolves against the working directory.
+        for (size_t i = callFrame->argumentCount(); i-- > 0;) {
+            JSC::JSValue argument = callFrame->uncheckedArgument(i);
+            if (!argument.isString())
+                break;
+            const WTF::String& path = asString(argument)->value(globalObject);
+            RETURN_IF_EXCEPTION(scope, {});
+            if (path.isEmpty() || path[0] != '/')
+                continue;
+
+            Vector<WTF::String, 8> parts;
+            nonEmptyStringArguments(globalObject, callFrame, i, parts);
+            RETURN_IF_EXCEPTION(scope, {});
+            return JSC::JSValue::encode(joinAndNormalizePosix(globalObject->vm(), parts, true));
+        }
+    }
+
+    DEFINE_CALLBACK_FUNCTION_BODY(Bun__Path__resolve, false);
 }
-static JSC_DECLARE_HOST_FUNCTION(Path_functionJoin);
-static JSC_DEFINE_HOST_FUNCTION(Path_functionJoin,
+
+#pragma mark - DOMJIT
+
+// clang-format off
+#define DEFINE_PATH_DOMJIT_FUNCTION(name, FastFunction, ZigFunction) \
+    static JSC_DECLARE_JIT_OPERATION_WITHOUT_WTF_INTERNAL(Path_function##name##PosixWithoutTypeCheck, JSC::EncodedJSValue, (JSC::JSGlobalObject*, void*, JSC::JSString*)); \
+    JSC_DEFINE_JIT_OPERATION(Path_function##name##PosixWithoutTypeCheck, JSC::EncodedJSValue, (JSC::JSGlobalObject * globalObject, void* thisValue, JSC::JSString* path)) \
+    { \
+        JSC::VM& vm = JSC::getVM(globalObject); \
+        IGNORE_WARNINGS_BEGIN("frame-address") \
+        JSC::CallFrame* callFrame = DECLARE_CALL_FRAME(vm); \
+        IGNORE_WARNINGS_END \
+        JSC::JITOperationPrologueCallFrameTracer tracer(vm, callFrame); \
+        auto scope = DECLARE_THROW_SCOPE(vm); \
+        auto* fastResult = FastFunction; \
+        RETURN_IF_EXCEPTION(scope, {}); \
+        if (fastResult) \
+            return JSC::JSValue::encode(fastResult); \
+        JSC::EncodedJSValue argument = JSC::JSValue::encode(path); \
+        JSC::JSValue result = JSC::JSValue::decode(ZigFunction(globalObject, false, reinterpret_cast<JSC__JSValue*>(&argument), 1)); \
+        JSC::JSObject* obj = result.getObject(); \
+        if (UNLIKELY(obj != nullptr && obj->isErrorInstance())) { \
+            scope.throwException(globalObject, obj); \
+            return {}; \
+        } \
+        RELEASE_AND_RETURN(scope, JSC::JSValue::encode(result)); \
+    }
+
+// clang-format on
+
+DEFINE_PATH_DOMJIT_FUNCTION(Basename, basenamePosix(globalObject, path, nullptr), Bun__Path__basename)
+DEFINE_PATH_DOMJIT_FUNCTION(Dirname, dirnamePosix(globalObject, path), Bun__Path__dirname)
+DEFINE_PATH_DOMJIT_FUNCTION(Extname, extnamePosix(globalObject, path), Bun__Path__extname)
+
+#undef DEFINE_PATH_DOMJIT_FUNCTION
+
+static JSC_DECLARE_HOST_FUNCTION(Path_functionBasenameWin32);
+static JSC_DEFINE_HOST_FUNCTION(Path_functionBasenameWin32,
     (JSC::JSGlobalObject * globalObject, JSC::CallFrame* callFrame))
 {
-    DEFINE_CALLBACK_FUNCTION_BODY(Bun__Path__join);
+    DEFINE_CALLBACK_FUNCTION_BODY(Bun__Path__basename, true);
 }
-static JSC_DECLARE_HOST_FUNCTION(Path_functionNormalize);
-static JSC_DEFINE_HOST_FUNCTION(Path_functionNormalize,
+static JSC_DECLARE_HOST_FUNCTION(Path_functionDirnameWin32);
+static JSC_DEFINE_HOST_FUNCTION(Path_functionDirnameWin32,
     (JSC::JSGlobalObject * globalObject, JSC::CallFrame* callFrame))
 {
-    DEFINE_CALLBACK_FUNCTION_BODY(Bun__Path__normalize);
+    DEFINE_CALLBACK_FUNCTION_BODY(Bun__Path__dirname, true);
 }
-static JSC_DECLARE_HOST_FUNCTION(Path_functionParse);
-static JSC_DEFINE_HOST_FUNCTION(Path_functionParse,
+static JSC_DECLARE_HOST_FUNCTION(Path_functionExtnameWin32);
+static JSC_DEFINE_HOST_FUNCTION(Path_functionExtnameWin32,
     (JSC::JSGlobalObject * globalObject, JSC::CallFrame* callFrame))
 {
-    DEFINE_CALLBACK_FUNCTION_BODY(Bun__Path__parse);
+    DEFINE_CALLBACK_FUNCTION_BODY(Bun__Path__extname, true);
 }
-static JSC_DECLARE_HOST_FUNCTION(Path_functionRelative);
-static JSC_DEFINE_HOST_FUNCTION(Path_functionRelative,
+static JSC_DECLARE_HOST_FUNCTION(Path_functionJoinWin32);
+static JSC_DEFINE_HOST_FUNCTION(Path_functionJoinWin32,
     (JSC::JSGlobalObject * globalObject, JSC::CallFrame* callFrame))
 {
-    DEFINE_CALLBACK_FUNCTION_BODY(Bun__Path__relative);
+    DEFINE_CALLBACK_FUNCTION_BODY(Bun__Path__join, true);
 }
-static JSC_DECLARE_HOST_FUNCTION(Path_functionResolve);
-static JSC_DEFINE_HOST_FUNCTION(Path_functionResolve,
+static JSC_DECLARE_HOST_FUNCTION(Path_functionResolveWin32);
+static JSC_DEFINE_HOST_FUNCTION(Path_functionResolveWin32,
     (JSC::JSGlobalObject * globalObject, JSC::CallFrame* callFrame))
 {
-    DEFINE_CALLBACK_FUNCTION_BODY(Bun__Path__resolve);
+    DEFINE_CALLBACK_FUNCTION_BODY(Bun__Path__resolve, true);
 }
+
+DEFINE_PATH_FUNCTION(Format, Bun__Path__format)
+DEFINE_PATH_FUNCTION(IsAbsolute, Bun__Path__isAbsolute)
+DEFINE_PATH_FUNCTION(Normalize, Bun__Path__normalize)
+DEFINE_PATH_FUNCTION(Parse, Bun__Path__parse)
+DEFINE_PATH_FUNCTION(Relative, Bun__Path__relative)
+
+#undef DEFINE_PATH_FUNCTION
+
 static JSC_DECLARE_HOST_FUNCTION(Path_functionToNamespacedPath);
 static JSC_DEFINE_HOST_FUNCTION(Path_functionToNamespacedPath,
     (JSC::JSGlobalObject * globalObject, JSC::CallFrame* callFrame))
@@ -127,56 +518,62 @@ static JSC_DEFINE_HOST_FUNCTION(Path_functionToNamespacedPath,
     return JSC::JSValue::encode(callFrame->argument(0));
 }
 
+static const JSC::DOMJIT::Signature DOMJITSignatureForPathBasenamePosix(
+    Path_functionBasenamePosixWithoutTypeCheck,
+    JSC::JSFinalObject::info(),
+    JSC::DOMJIT::Effect::forPure(),
+    JSC::SpecString,
+    JSC::SpecString);
+static const JSC::DOMJIT::Signature DOMJITSignatureForPathDirnamePosix(
+    Path_functionDirnamePosixWithoutTypeCheck,
+    JSC::JSFinalObject::info(),
+    JSC::DOMJIT::Effect::forPure(),
+    JSC::SpecString,
+    JSC::SpecString);
+static const JSC::DOMJIT::Signature DOMJITSignatureForPathExtnamePosix(
+    Path_functionExtnamePosixWithoutTypeCheck,
+    JSC::JSFinalObject::info(),
+    JSC::DOMJIT::Effect::forPure(),
+    JSC::SpecString,
+    JSC::SpecString);
+
+static void putPathFunction(JSC::VM& vm, JSGlobalObject* globalThis, JSC::JSObject* path, const JSC::Identifier& identifier, JSC::NativeFunction function, const JSC::DOMJIT::Signature* signature = nullptr)
+{
+    auto* fn = JSC::JSFunction::create(vm, globalThis, 0, identifier.string(), function, ImplementationVisibility::Public, NoIntrinsic, JSC::callHostFunctionAsConstructor, signature);
+    path->putDirect(vm, identifier, fn, signature ? JSC::PropertyAttribute::DOMJITFunction | 0 : 0);
+}
+
 static JSC::JSObject* createPath(JSGlobalObject* globalThis, bool isWindows)
 {
     JSC::VM& vm = globalThis->vm();
     JSC::Structure* plainObjectStructure = JSC::JSFinalObject::createStructure(vm, globalThis, globalThis->objectPrototype(), 0);
     JSC::JSObject* path = JSC::JSFinalObject::create(vm, plainObjectStructure);
     auto clientData = WebCore::clientData(vm);
+    auto& names = clientData->builtinNames();
 
-    path->putDirect(vm, clientData->builtinNames().isWindowsPrivateName(),
-        JSC::jsBoolean(isWindows), 0);
-
-    path->putDirect(vm, clientData->builtinNames().basenamePublicName(),
-        JSC::JSFunction::create(vm, JSC::jsCast<JSC::JSGlobalObject*>(globalThis), 0,
-            "basename"_s, Path_functionBasename, ImplementationVisibility::Public),
-        0);
-    path->putDirect(vm, clientData->builtinNames().dirnamePublicName(),
-        JSC::JSFunction::create(vm, JSC::jsCast<JSC::JSGlobalObject*>(globalThis), 0,
-            "dirname"_s, Path_functionDirname, ImplementationVisibility::Public),
-        0);
-    path->putDirect(vm, clientData->builtinNames().extnamePublicName(),
-        JSC::JSFunction::create(vm, JSC::jsCast<JSC::JSGlobalObject*>(globalThis), 0,
-            "extname"_s, Path_functionExtname, ImplementationVisibility::Public),
-        0);
-    path->putDirect(vm, clientData->builtinNames().formatPublicName(),
-        JSC::JSFunction::create(vm, JSC::jsCast<JSC::JSGlobalObject*>(globalThis), 0,
-            "format"_s, Path_functionFormat, ImplementationVisibility::Public),
-        0);
-    path->putDirect(vm, clientData->builtinNames().isAbsolutePublicName(),
-        JSC::JSFunction::create(vm, JSC::jsCast<JSC::JSGlobalObject*>(globalThis), 0,
-            "isAbsolute"_s, Path_functionIsAbsolute, ImplementationVisibility::Public),
-        0);
-    path->putDirect(vm, clientData->builtinNames().joinPublicName(),
-        JSC::JSFunction::create(vm, JSC::jsCast<JSC::JSGlobalObject*>(globalThis), 0,
-            "join"_s, Path_functionJoin, ImplementationVisibility::Public),
-        0);
-    path->putDirect(vm, clientData->builtinNames().normalizePublicName(),
-        JSC::JSFunction::create(vm, JSC::jsCast<JSC::JSGlobalObject*>(globalThis), 0,
-            "normalize"_s, Path_functionNormalize, ImplementationVisibility::Public),
-        0);
-    path->putDirect(vm, clientData->builtinNames().parsePublicName(),
-        JSC::JSFunction::create(vm, JSC::jsCast<JSC::JSGlobalObject*>(globalThis), 0,
-            "parse"_s, Path_functionParse, ImplementationVisibility::Public),
-        0);
-    path->putDirect(vm, clientData->builtinNames().relativePublicName(),
-        JSC::JSFunction::create(vm, JSC::jsCast<JSC::JSGlobalObject*>(globalThis), 0,
-            "relative"_s, Path_functionRelative, ImplementationVisibility::Public),
-        0);
-    path->putDirect(vm, clientData->builtinNames().resolvePublicName(),
-        JSC::JSFunction::create(vm, JSC::jsCast<JSC::JSGlobalObject*>(globalThis), 0,
-            "resolve"_s, Path_functionResolve, ImplementationVisibility::Public),
-        0);
+    if (isWindows) {
+        putPathFunction(vm, globalThis, path, names.basenamePublicName(), Path_functionBasenameWin32);
+        putPathFunction(vm, globalThis, path, names.dirnamePublicName(), Path_functionDirnameWin32);
+        putPathFunction(vm, globalThis, path, names.extnamePublicName(), Path_functionExtnameWin32);
+        putPathFunction(vm, globalThis, path, names.formatPublicName(), Path_functionFormatWin32);
+        putPathFunction(vm, globalThis, path, names.isAbsolutePublicName(), Path_functionIsAbsoluteWin32);
+        putPathFunction(vm, globalThis, path, names.joinPublicName(), Path_functionJoinWin32);
+        putPathFunction(vm, globalThis, path, names.normalizePublicName(), Path_functionNormalizeWin32);
+        putPathFunction(vm, globalThis, path, names.parsePublicName(), Path_functionParseWin32);
+        putPathFunction(vm, globalThis, path, names.relativePublicName(), Path_functionRelativeWin32);
+        putPathFunction(vm, globalThis, path, names.resolvePublicName(), Path_functionResolveWin32);
+    } else {
+        putPathFunction(vm, globalThis, path, names.basenamePublicName(), Path_functionBasenamePosix, &DOMJITSignatureForPathBasenamePosix);
+        putPathFunction(vm, globalThis, path, names.dirnamePublicName(), Path_functionDirnamePosix, &DOMJITSignatureForPathDirnamePosix);
+        putPathFunction(vm, globalThis, path, names.extnamePublicName(), Path_functionExtnamePosix, &DOMJITSignatureForPathExtnamePosix);
+        putPathFunction(vm, globalThis, path, names.formatPublicName(), Path_functionFormatPosix);
+        putPathFunction(vm, globalThis, path, names.isAbsolutePublicName(), Path_functionIsAbsolutePosix);
+        putPathFunction(vm, globalThis, path, names.joinPublicName(), Path_functionJoinPosix);
+        putPathFunction(vm, globalThis, path, names.normalizePublicName(), Path_functionNormalizePosix);
+        putPathFunction(vm, globalThis, path, names.parsePublicName(), Path_functionParsePosix);
+        putPathFunction(vm, globalThis, path, names.relativePublicName(), Path_functionRelativePosix);
+        putPathFunction(vm, globalThis, path, names.resolvePublicName(), Path_functionResolvePosix);
+    }
 
     path->putDirect(vm, clientData->builtinNames().toNamespacedPathPublicName(),
         JSC::JSFunction::create(vm, JSC::jsCast<JSC::JSGlobalObject*>(globalThis), 0,
@@ -13,6 +13,7 @@ namespace WebCore {
 static unsigned lastUniqueIdentifier = 0;
 
 static Lock allScriptExecutionContextsMapLock;
+// Only contexts whose identifier does not fit in the slot table below.
 static HashMap<ScriptExecutionContextIdentifier, ScriptExecutionContext*>& allScriptExecutionContextsMap() WTF_REQUIRES_LOCK(allScriptExecutionContextsMapLock)
 {
     static NeverDestroyed<HashMap<ScriptExecutionContextIdentifier, ScriptExecutionContext*>> contexts;
@@ -20,6 +21,76 @@ static HashMap<ScriptExecutionContextIdentifier, ScriptExecutionContext*>& allSc
     return contexts;
 }
 
+// Posting from another thread looks its context up here without taking the
+// lock. Identifiers are never reused, so a slot belongs to one context for
+// good. Posts count themselves in the slot while they use the context, and
+// removing it waits for them to finish, so a context is never used after
+// its global object is gone.
+struct ScriptExecutionContextSlot {
+    WTF_MAKE_STRUCT_FAST_ALLOCATED;
+
+    std::atomic<ScriptExecutionContext*> context { nullptr };
+    std::atomic<unsigned> posts { 0 };
+};
+
+static constexpr unsigned contextSlotsPerSegment = 1024;
+static constexpr unsigned contextSegmentCount = 256;
+// Segments are allocated on first use under allScriptExecutionContextsMapLock
+// and never freed.
+static std::atomic<ScriptExecutionContextSlot*> contextSegments[contextSegmentCount];
+
+static ScriptExecutionContextSlot* contextSlot(ScriptExecutionContextIdentifier identifier)
+{
+    unsigned segment = identifier / contextSlotsPerSegment;
+    if (segment >= contextSegmentCount)
+        return nullptr;
+    auto* slots = contextSegments[segment].load(std::memory_order_acquire);
+    return slots ? &slots[identifier % contextSlotsPerSegment] : nullptr;
+}
+
+static void addContext(ScriptExecutionContextIdentifier identifier, ScriptExecutionContext* context) WTF_REQUIRES_LOCK(allScriptExecutionContextsMapLock)
+{
+    unsigned segment = identifier / contextSlotsPerSegment;
+    if (segment >= contextSegmentCount) {
+        ASSERT(!allScriptExecutionContextsMap().contains(identifier));
+        allScriptExecutionContextsMap().add(identifier, context);
+        return;
+    }
+
+    if (!contextSegments[segment].load(std::memory_order_relaxed))
+        contextSegments[segment].store(new ScriptExecutionContextSlot[contextSlotsPerSegment], std::memory_order_release);
+    auto* slot = contextSlot(identifier);
+    ASSERT(!slot->context.load(std::memory_order_relaxed));
+    slot->context.store(context);
+}
+
+// Returns the slot whose posts the caller has to wait for once it has let go
+// of allScriptExecutionContextsMapLock, if any.
+static ScriptExecutionContextSlot* removeContext(ScriptExecutionContextIdentifier identifier) WTF_REQUIRES_LOCK(allScriptExecutionContextsMapLock)
+{
+    auto* slot = contextSlot(identifier);
+    if (!slot) {
+        ASSERT(allScriptExecutionContextsMap().contains(identifier));
+        allScriptExecutionContextsMap().remove(identifier);
+        return nullptr;
+    }
+
+    ASSERT(slot->context.load(std::memory_order_relaxed));
+    slot->context.store(nullptr);
+    return slot;
+}
+
+// A post that loaded the context before it was removed may still be using
+// it. Posts never take the lock, so waiting for them without it held keeps
+// other threads free to register and remove their own contexts meanwhile.
+static void waitForPosts(ScriptExecutionContextSlot* slot)
+{
+    if (!slot)
+        return;
+    while (slot->posts.load())
+        Thread::yield();
+}
+
 template<bool SSL, bool isServer>
 static void registerHTTPContextForWebSocket(ScriptExecutionContext* script, us_socket_context_t* ctx, us_loop_t* loop)
 {
@@ -49,16 +120,108 @@ us_socket_context_t* ScriptExecutionContext::webSocketContextSSL()
     return m_ssl_client_websockets_ctx;
 }
 
-bool ScriptExecutionContext::postTaskTo(ScriptExecutionContextIdentifier identifier, Function<void(ScriptExecutionContext&)>&& task)
+ScriptExecutionContext::~ScriptExecutionContext()
 {
+    releaseConcurrentTasks();
+}
+
+// Tasks posted after the last drain never run once the context is gone, but
+// what they captured still has to be released.
+void ScriptExecutionContext::releaseConcurrentTasks()
+{
+    for (auto* task = m_concurrentTasks.exchange(nullptr, std::memory_order_acquire); task;) {
+        auto* next = task->m_nextConcurrentTask;
+        delete task;
+        task = next;
+    }
+}
+
+ScriptExecutionContext* ScriptExecutionContext::getScriptExecutionContext(ScriptExecutionContextIdentifier identifier)
+{
+    if (auto* slot = contextSlot(identifier))
+        return slot->context.load();
+
     Locker locker { allScriptExecutionContextsMapLock };
-    auto* context = allScriptExecutionContextsMap().get(identifier);
+    return allScriptExecutionContextsMap().get(identifier);
+}
+
+bool ScriptExecutionContext::postTaskTo(ScriptExecutionContextIdentifier identifier, EventLoopTask* task)
+{
+    EventLoopTaskBatch batch;
+    batch.append(task);
+    return postTasksTo(identifier, WTFMove(batch));
+}
+
+bool ScriptExecutionContext::postTasksTo(ScriptExecutionContextIdentifier identifier, EventLoopTaskBatch&& tasks)
+{
+    // Whatever is not handed to a context is deleted with the batch.
+    EventLoopTaskBatch batch = WTFMove(tasks);
+    auto* slot = contextSlot(identifier);
+    if (!slot) {
+        Locker locker { allScriptExecutionContextsMapLock };
+        auto* context = allScriptExecutionContextsMap().get(identifier);
+        if (!context)
+            return false;
+
+        context->postTasksConcurrently(WTFMove(batch));
+        return true;
+    }
+
+    // Sequentially consistent, so that either removeContext() sees this post
+    // and waits for it, or this post sees the context is gone.
+    slot->posts.fetch_add(1);
+    auto* context = slot->context.load();
+    if (context)
+        context->postTasksConcurrently(WTFMove(batch));
+    slot->posts.fetch_sub(1, std::memory_order_release);
+    return !!context;
+}
+
+void ScriptExecutionContext::postTaskConcurrently(EventLoopTask* task)
+{
+    EventLoopTaskBatch batch;
+    batch.append(task);
+    postTasksConcurrently(WTFMove(batch));
+}
 
-    if (!context)
-        return false;
+void ScriptExecutionContext::postTasksConcurrently(EventLoopTaskBatch&& tasks)
+{
+    if (tasks.isEmpty())
+        return;
+
+    auto* first = std::exchange(tasks.m_newest, nullptr);
+    auto* last = std::exchange(tasks.m_oldest, nullptr);
+    tasks.m_size = 0;
+    auto* head = m_concurrentTasks.load(std::memory_order_relaxed);
+    do {
+        last->m_nextConcurrentTask = head;
+    } while (!m_concurrentTasks.compare_exchange_weak(head, first, std::memory_order_release, std::memory_order_relaxed));
 
-    context->postTaskConcurrently(WTFMove(task));
-    return true;
+    // Posts made before the drain runs join this one without a wakeup.
+    if (!head)
+        reinterpret_cast<Zig::GlobalObject*>(m_globalObject)->queueTaskConcurrently(createEventLoopTask([](ScriptExecutionContext& context) { context.drainConcurrentTasks(); }));
+}
+
+void ScriptExecutionContext::drainConcurrentTasks()
+{
+    // The queue is newest first; run the tasks in the order they were posted.
+    EventLoopTask* task = nullptr;
+    for (auto* newest = m_concurrentTasks.exchange(nullptr, std::memory_order_acquire); newest;) {
+        auto* next = newest->m_nextConcurrentTask;
+        newest->m_nextConcurrentTask = task;
+        task = newest;
+        newest = next;
+    }
+
+    while (task) {
+        auto* next = task->m_nextConcurrentTask;
+        task->performTask(*this);
+        // The event loop drains microtasks after each task, and after the
+        // last one of these.
+        if (next)
+            m_vm->drainMicrotasks();
+        task = next;
+    }
 }
 
 us_socket_context_t* ScriptExecutionContext::webSocketContextNoSSL()
@@ -102,29 +265,38 @@ us_socket_context_t* ScriptExecutionContext::connectedWebSocketKindClientSSL()
 
 void ScriptExecutionContext::regenerateIdentifier()
 {
-    Locker locker { allScriptExecutionContextsMapLock };
+    ScriptExecutionContextSlot* previousSlot = nullptr;
+    {
+        Locker locker { allScriptExecutionContextsMapLock };
 
-    ASSERT(allScriptExecutionContextsMap().contains(m_identifier));
-    allScriptExecutionContextsMap().remove(m_identifier);
+        if (m_identifier)
+            previousSlot = removeContext(m_identifier);
 
-    m_identifier = ++lastUniqueIdentifier;
+        m_identifier = ++lastUniqueIdentifier;
 
-    ASSERT(!allScriptExecutionContextsMap().contains(m_identifier));
-    allScriptExecutionContextsMap().add(m_identifier, this);
+        addContext(m_identifier, this);
+    }
+    waitForPosts(previousSlot);
 }
 
 void ScriptExecutionContext::addToContextsMap()
 {
     Locker locker { allScriptExecutionContextsMapLock };
-    ASSERT(!allScriptExecutionContextsMap().contains(m_identifier));
-    allScriptExecutionContextsMap().add(m_identifier, this);
+    addContext(m_identifier, this);
 }
 
 void ScriptExecutionContext::removeFromContextsMap()
 {
-    Locker locker { allScriptExecutionContextsMapLock };
-    ASSERT(allScriptExecutionContextsMap().contains(m_identifier));
-    allScriptExecutionContextsMap().remove(m_identifier);
+    ScriptExecutionContextSlot* slot = nullptr;
+    {
+        Locker locker { allScriptExecutionContextsMapLock };
+        slot = removeContext(m_identifier);
+    }
+    waitForPosts(slot);
+
+    // Nothing can post to the context anymore, and its global object is on
+    // the way out, so the queued drain will not run.
+    releaseConcurrentTasks();
 }
 
 }
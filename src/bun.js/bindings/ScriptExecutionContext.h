@@ -56,16 +56,104 @@ public:
     {
     }
 
+    virtual ~EventLoopTask() = default;
+
     void performTask(ScriptExecutionContext& context)
     {
-        m_task(context);
+        run(context);
         delete this;
     }
     bool isCleanupTask() const { return m_isCleanupTask; }
 
 protected:
+    EventLoopTask()
+        : m_isCleanupTask(false)
+    {
+    }
+
+    virtual void run(ScriptExecutionContext& context) { m_task(context); }
+
     Function<void(ScriptExecutionContext&)> m_task;
     bool m_isCleanupTask;
+
+private:
+    friend class ScriptExecutionContext;
+    friend class EventLoopTaskBatch;
+
+    // Link in a context's queue of tasks posted from other threads.
+    EventLoopTask* m_nextConcurrentTask { nullptr };
+};
+
+// Stores the lambda in the task itself, so that posting it is one allocation
+// instead of one for the task and another for a Function.
+template<typename Lambda>
+class InlineEventLoopTask final : public EventLoopTask {
+public:
+    template<typename T>
+    explicit InlineEventLoopTask(T&& lambda)
+        : m_lambda(std::forward<T>(lambda))
+    {
+    }
+
+private:
+    void run(ScriptExecutionContext& context) final { m_lambda(context); }
+
+    Lambda m_lambda;
+};
+
+template<typename Lambda>
+EventLoopTask* createEventLoopTask(Lambda&& lambda)
+{
+    return new InlineEventLoopTask<std::decay_t<Lambda>>(std::forward<Lambda>(lambda));
+}
+
+// Tasks posted to a context together, which takes one CAS and wakes its
+// thread up at most once. Tasks that are never posted are destroyed without
+// running.
+class EventLoopTaskBatch {
+    WTF_MAKE_NONCOPYABLE(EventLoopTaskBatch);
+
+public:
+    EventLoopTaskBatch() = default;
+    EventLoopTaskBatch(EventLoopTaskBatch&& other)
+        : m_newest(std::exchange(other.m_newest, nullptr))
+        , m_oldest(std::exchange(other.m_oldest, nullptr))
+        , m_size(std::exchange(other.m_size, 0))
+    {
+    }
+    ~EventLoopTaskBatch() { clear(); }
+
+    template<typename Lambda, typename = typename std::enable_if<!std::is_convertible<Lambda, EventLoopTask*>::value>::type>
+    void append(Lambda&& lambda) { append(createEventLoopTask(std::forward<Lambda>(lambda))); }
+    void append(EventLoopTask* task)
+    {
+        // Kept newest first, the order of the context's queue.
+        task->m_nextConcurrentTask = m_newest;
+        m_newest = task;
+        if (!m_oldest)
+            m_oldest = task;
+        m_size++;
+    }
+
+    bool isEmpty() const { return !m_newest; }
+    size_t size() const { return m_size; }
+
+    void clear()
+    {
+        while (auto* task = m_newest) {
+            m_newest = task->m_nextConcurrentTask;
+            delete task;
+        }
+        m_oldest = nullptr;
+        m_size = 0;
+    }
+
+private:
+    friend class ScriptExecutionContext;
+
+    EventLoopTask* m_newest { nullptr };
+    EventLoopTask* m_oldest { nullptr };
+    size_t m_size { 0 };
 };
 
 using ScriptExecutionContextIdentifier = uint32_t;
@@ -80,6 +168,7 @@ public:
     {
         regenerateIdentifier();
     }
+    ~ScriptExecutionContext();
 
     JSC::JSGlobalObject* jsGlobalObject()
     {
@@ -110,21 +199,38 @@ public:
     // {
     // }
 
-    static bool postTaskTo(ScriptExecutionContextIdentifier identifier, Function<void(ScriptExecutionContext&)>&& task);
+    // Posts to the context with the identifier from any thread, unless it is
+    // gone, in which case false is returned and the task is not run.
+    template<typename Lambda, typename = typename std::enable_if<!std::is_convertible<Lambda, EventLoopTask*>::value>::type>
+    static bool postTaskTo(ScriptExecutionContextIdentifier identifier, Lambda&& lambda)
+    {
+        return postTaskTo(identifier, createEventLoopTask(std::forward<Lambda>(lambda)));
+    }
+    static bool postTaskTo(ScriptExecutionContextIdentifier identifier, EventLoopTask* task);
+    // Like postTaskTo(), for every task in the batch at once. The batch is
+    // empty afterwards either way.
+    static bool postTasksTo(ScriptExecutionContextIdentifier identifier, EventLoopTaskBatch&& tasks);
+
+    // Only safe to use on the context's thread, or while something else
+    // keeps the context registered.
+    static ScriptExecutionContext* getScriptExecutionContext(ScriptExecutionContextIdentifier identifier);
 
     void regenerateIdentifier();
     void addToContextsMap();
     void removeFromContextsMap();
 
-    void postTaskConcurrently(Function<void(ScriptExecutionContext&)>&& lambda)
+    template<typename Lambda, typename = typename std::enable_if<!std::is_convertible<Lambda, EventLoopTask*>::value>::type>
+    void postTaskConcurrently(Lambda&& lambda)
     {
-        auto* task = new EventLoopTask(WTFMove(lambda));
-        reinterpret_cast<Zig::GlobalObject*>(m_globalObject)->queueTaskConcurrently(task);
+        postTaskConcurrently(createEventLoopTask(std::forward<Lambda>(lambda)));
     } // Executes the task on context's thread asynchronously.
+    void postTaskConcurrently(EventLoopTask* task);
+    void postTasksConcurrently(EventLoopTaskBatch&& tasks);
 
-    void postTask(Function<void(ScriptExecutionContext&)>&& lambda)
+    template<typename Lambda, typename = typename std::enable_if<!std::is_convertible<Lambda, EventLoopTask*>::value>::type>
+    void postTask(Lambda&& lambda)
     {
-        auto* task = new EventLoopTask(WTFMove(lambda));
+        auto* task = createEventLoopTask(std::forward<Lambda>(lambda));
         reinterpret_cast<Zig::GlobalObject*>(m_globalObject)->queueTask(task);
     } // Executes the task on context's thread asynchronously.
     void postTask(EventLoopTask* task)
@@ -158,6 +264,12 @@ private:
     WTF::URL m_url = WTF::URL();
     ScriptExecutionContextIdentifier m_identifier;
 
+    // Tasks posted from other threads, newest first. Only the post that finds
+    // it empty wakes the context's thread up to drain it.
+    std::atomic<EventLoopTask*> m_concurrentTasks { nullptr };
+    void drainConcurrentTasks();
+    void releaseConcurrentTasks();
+
     us_socket_context_t* webSocketContextSSL();
     us_socket_context_t* webSocketContextNoSSL();
     us_socket_context_t* connectedWebSocketKindClientSSL();
@@ -0,0 +1,78 @@
+#include "root.h"
+#include "SourceLineIndex.h"
+
+#include <algorithm>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define BUN_LINE_INDEX_X86 1
+#include <immintrin.h>
+#else
+#define BUN_LINE_INDEX_X86 0
+#endif
+
+namespace Zig {
+
+static void appendLineStarts(const LChar* characters, unsigned length, Vector<unsigned>& lineStarts)
+{
+    // memchr is vectorized by libc.
+    const LChar* cursor = characters;
+    const LChar* end = characters + length;
+    while (cursor < end) {
+        const void* newline = memchr(cursor, '\n', end - cursor);
+        if (!newline)
+            break;
+        cursor = static_cast<const LChar*>(newline) + 1;
+        lineStarts.append(cursor - characters);
+    }
+}
+
+static void appendLineStarts(const UChar* characters, unsigned length, Vector<unsigned>& lineStarts)
+{
+    unsigned i = 0;
+#if BUN_LINE_INDEX_X86
+    const __m128i newline = _mm_set1_epi16('\n');
+    for (; i + 8 <= length; i += 8) {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(characters + i));
+        // Two mask bits per UChar; keep the low one of each pair.
+        unsigned mask = _mm_movemask_epi8(_mm_cmpeq_epi16(block, newline)) & 0x5555;
+        while (mask) {
+            lineStarts.append(i + (__builtin_ctz(mask) >> 1) + 1);
+            mask &= mask - 1;
+        }
+    }
+#endif
+    for (; i < length; i++) {
+        if (characters[i] == '\n')
+            lineStarts.append(i + 1);
+    }
+}
+
+SourceLineIndex::SourceLineIndex(StringView source)
+    : m_length(source.length())
+{
+    m_lineStarts.append(0);
+    if (source.is8Bit())
+        appendLineStarts(source.characters8(), source.length(), m_lineStarts);
+    else
+        appendLineStarts(source.characters16(), source.length(), m_lineStarts);
+    m_lineStarts.shrinkToFit();
+}
+
+unsigned SourceLineIndex::lineForOffset(unsigned offset) const
+{
+    // The last line start that is <= offset. m_lineStarts[0] is 0, so there
+    // always is one.
+    auto* upper = std::upper_bound(m_lineStarts.begin(), m_lineStarts.end(), offset);
+    return (upper - m_lineStarts.begin()) - 1;
+}
+
+unsigned SourceLineIndex::lineStopForOffset(unsigned offset) const
+{
+    if (offset >= m_length)
+        return offset;
+
+    unsigned nextLine = lineForOffset(offset) + 1;
+    return nextLine < m_lineStarts.size() ? m_lineStarts[nextLine] - 1 : m_length;
+}
+
+}
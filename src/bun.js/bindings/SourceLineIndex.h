@@ -0,0 +1,33 @@
+#pragma once
+
+#include "root.h"
+#include <wtf/Vector.h>
+#include <wtf/text/StringView.h>
+
+namespace Zig {
+
+// The offset of the first character of every line in a source, so that the
+// line around an offset is a binary search instead of a scan over the line,
+// which for minified bundles can be megabytes long.
+class SourceLineIndex {
+    WTF_MAKE_FAST_ALLOCATED;
+
+public:
+    explicit SourceLineIndex(StringView source);
+
+    unsigned lineCount() const { return m_lineStarts.size(); }
+
+    // Zero-based line containing offset.
+    unsigned lineForOffset(unsigned offset) const;
+    // Offset of the first character of the line containing offset.
+    unsigned lineStartForOffset(unsigned offset) const { return m_lineStarts[lineForOffset(offset)]; }
+    // Offset of the '\n' ending the line containing offset, or the source
+    // length on the last line. Offsets past the end are returned as is.
+    unsigned lineStopForOffset(unsigned offset) const;
+
+private:
+    WTF::Vector<unsigned> m_lineStarts;
+    unsigned m_length;
+};
+
+}
@@ -29,9 +29,17 @@
 
 namespace WebCore {
 
+// Below this many pairs, scanning them is cheaper than hashing the name.
+static constexpr size_t nameIndexThreshold = 16;
+
+static const String& nameIndexKey(const String& name)
+{
+    return name.isNull() ? emptyString() : name;
+}
+
 URLSearchParams::URLSearchParams(const String& init, DOMURL* associatedURL)
     : m_associatedURL(associatedURL)
-    , m_pairs(init.startsWith('?') ? WTF::URLParser::parseURLEncodedForm(StringView(init).substring(1)) : WTF::URLParser::parseURLEncodedForm(init))
+    , m_unparsedQuery(init)
 {
 }
 
@@ -53,9 +61,43 @@ ExceptionOr<Ref<URLSearchParams>> URLSearchParams::create(std::variant<Vector<Ve
     return std::visit(visitor, variant);
 }
 
+void URLSearchParams::parse() const
+{
+    StringView query = m_unparsedQuery;
+    if (query.startsWith('?'))
+        query = query.substring(1);
+    m_pairs = WTF::URLParser::parseURLEncodedForm(query);
+    m_unparsedQuery = String();
+}
+
+const Vector<unsigned, 1>* URLSearchParams::positionsOf(const String& name) const
+{
+    if (!m_hasNameIndex) {
+        for (unsigned i = 0; i < m_pairs.size(); i++)
+            m_nameIndex.ensure(nameIndexKey(m_pairs[i].key), [] { return Vector<unsigned, 1> {}; }).iterator->value.append(i);
+        m_hasNameIndex = true;
+    }
+
+    auto it = m_nameIndex.find(nameIndexKey(name));
+    return it == m_nameIndex.end() ? nullptr : &it->value;
+}
+
+void URLSearchParams::appendToNameIndex(const String& name, unsigned position)
+{
+    if (!m_hasNameIndex)
+        return;
+    m_nameIndex.ensure(nameIndexKey(name), [] { return Vector<unsigned, 1> {}; }).iterator->value.append(position);
+}
+
 String URLSearchParams::get(const String& name) const
 {
-    for (const auto& pair : m_pairs) {
+    auto& pairs = this->pairs();
+    if (pairs.size() >= nameIndexThreshold) {
+        auto* positions = positionsOf(name);
+        return positions ? pairs[positions->first()].value : String();
+    }
+
+    for (const auto& pair : pairs) {
         if (pair.key == name)
             return pair.value;
     }
@@ -64,7 +106,11 @@ String URLSearchParams::get(const String& name) const
 
 bool URLSearchParams::has(const String& name) const
 {
-    for (const auto& pair : m_pairs) {
+    auto& pairs = this->pairs();
+    if (pairs.size() >= nameIndexThreshold)
+        return positionsOf(name);
+
+    for (const auto& pair : pairs) {
         if (pair.key == name)
             return true;
     }
@@ -73,21 +119,43 @@ bool URLSearchParams::has(const String& name) const
 
 void URLSearchParams::sort()
 {
-    std::stable_sort(m_pairs.begin(), m_pairs.end(), [](const auto& a, const auto& b) {
+    auto& pairs = this->pairs();
+    std::stable_sort(pairs.begin(), pairs.end(), [](const auto& a, const auto& b) {
         return WTF::codePointCompareLessThan(a.key, b.key);
     });
+    invalidateNameIndex();
     updateURL();
 }
 
 void URLSearchParams::set(const String& name, const String& value)
 {
-    for (auto& pair : m_pairs) {
+    auto& pairs = this->pairs();
+    if (pairs.size() >= nameIndexThreshold) {
+        auto* positions = positionsOf(name);
+        if (!positions) {
+            pairs.append({ name, value });
+            appendToNameIndex(name, pairs.size() - 1);
+            needsSorting = true;
+            updateURL();
+            return;
+        }
+        // With a single match the pair is updated in place and the
+        // positions in the index stay valid.
+        if (positions->size() == 1) {
+            pairs[positions->first()].value = value;
+            needsSorting = true;
+            updateURL();
+            return;
+        }
+    }
+
+    for (auto& pair : pairs) {
         if (pair.key != name)
             continue;
         if (pair.value != value)
             pair.value = value;
         bool skippedFirstMatch = false;
-        m_pairs.removeAllMatching([&](const auto& pair) {
+        pairs.removeAllMatching([&](const auto& pair) {
             if (pair.key == name) {
                 if (skippedFirstMatch)
                     return true;
@@ -95,27 +163,41 @@ void URLSearchParams::set(const String& name, const String& value)
             }
             return false;
         });
+        invalidateNameIndex();
         updateURL();
         needsSorting = true;
         return;
     }
-    m_pairs.append({ name, value });
+    pairs.append({ name, value });
+    appendToNameIndex(name, pairs.size() - 1);
     needsSorting = true;
     updateURL();
 }
 
 void URLSearchParams::append(const String& name, const String& value)
 {
-    m_pairs.append({ name, value });
+    auto& pairs = this->pairs();
+    pairs.append({ name, value });
+    appendToNameIndex(name, pairs.size() - 1);
     updateURL();
     needsSorting = true;
 }
 
 Vector<String> URLSearchParams::getAll(const String& name) const
 {
+    auto& pairs = this->pairs();
     Vector<String> values;
-    values.reserveInitialCapacity(m_pairs.size());
-    for (const auto& pair : m_pairs) {
+    if (pairs.size() >= nameIndexThreshold) {
+        if (auto* positions = positionsOf(name)) {
+            values.reserveInitialCapacity(positions->size());
+            for (unsigned position : *positions)
+                values.uncheckedAppend(pairs[position].value);
+        }
+        return values;
+    }
+
+    values.reserveInitialCapacity(pairs.size());
+    for (const auto& pair : pairs) {
         if (pair.key == name)
             values.uncheckedAppend(pair.value);
     }
@@ -125,30 +207,45 @@ Vector<String> URLSearchParams::getAll(const String& name) const
 
 void URLSearchParams::remove(const String& name)
 {
-    if (!m_pairs.removeAllMatching([&](const auto& pair) {
+    auto& pairs = this->pairs();
+    if (pairs.size() >= nameIndexThreshold && !positionsOf(name))
+        return;
+
+    if (!pairs.removeAllMatching([&](const auto& pair) {
             return pair.key == name;
         }))
         return;
+    invalidateNameIndex();
     updateURL();
     needsSorting = true;
 }
 
 String URLSearchParams::toString() const
 {
-    return WTF::URLParser::serialize(m_pairs);
+    return WTF::URLParser::serialize(pairs());
 }
 
 void URLSearchParams::updateURL()
 {
     if (m_associatedURL)
-        m_associatedURL->setQuery(WTF::URLParser::serialize(m_pairs));
+        m_needsURLUpdate = true;
+}
+
+String URLSearchParams::takePendingURLUpdate()
+{
+    m_needsURLUpdate = false;
+    return WTF::URLParser::serialize(pairs());
 }
 
 void URLSearchParams::updateFromAssociatedURL()
 {
     ASSERT(m_associatedURL);
-    String search = m_associatedURL->search();
-    m_pairs = search.startsWith('?') ? WTF::URLParser::parseURLEncodedForm(StringView(search).substring(1)) : WTF::URLParser::parseURLEncodedForm(search);
+    // The URL was replaced, so changes not yet written to it are dropped.
+    // This has to happen before search(), which would otherwise write them.
+    m_needsURLUpdate = false;
+    m_unparsedQuery = m_associatedURL->search();
+    m_pairs.clear();
+    invalidateNameIndex();
 }
 
 std::optional<KeyValuePair<String, String>> URLSearchParams::Iterator::next()
@@ -26,6 +26,7 @@
 #include "root.h"
 
 #include "ExceptionOr.h"
+#include "wtf/HashMap.h"
 #include "wtf/Vector.h"
 #include "wtf/WeakPtr.h"
 #include "wtf/text/WTFString.h"
@@ -53,6 +54,11 @@ public:
     void updateFromAssociatedURL();
     void sort();
 
+    // Set when the pairs changed since the associated URL's query was last
+    // written. DOMURL serializes them lazily, the next time it is read.
+    bool hasPendingURLUpdate() const { return m_needsURLUpdate; }
+    String takePendingURLUpdate();
+
     class Iterator {
     public:
         explicit Iterator(URLSearchParams&);
@@ -65,13 +71,36 @@ public:
     Iterator createIterator() { return Iterator { *this }; }
 
 private:
-    const Vector<KeyValuePair<String, String>>& pairs() const { return m_pairs; }
+    const Vector<KeyValuePair<String, String>>& pairs() const
+    {
+        if (!m_unparsedQuery.isNull())
+            parse();
+        return m_pairs;
+    }
+    Vector<KeyValuePair<String, String>>& pairs()
+    {
+        if (!m_unparsedQuery.isNull())
+            parse();
+        return m_pairs;
+    }
     URLSearchParams(const String&, DOMURL*);
     URLSearchParams(const Vector<KeyValuePair<String, String>>&);
+    void parse() const;
     void updateURL();
 
+    // Positions in m_pairs of every pair with the given name, or nullptr
+    // when there are none. Builds the name index on first use.
+    const Vector<unsigned, 1>* positionsOf(const String& name) const;
+    void appendToNameIndex(const String& name, unsigned position);
+    void invalidateNameIndex() { m_nameIndex.clear(); m_hasNameIndex = false; }
+
     WeakPtr<DOMURL> m_associatedURL;
-    Vector<KeyValuePair<String, String>> m_pairs;
+    // The query as given, until something needs the pairs.
+    mutable String m_unparsedQuery;
+    mutable Vector<KeyValuePair<String, String>> m_pairs;
+    mutable HashMap<String, Vector<unsigned, 1>> m_nameIndex;
+    mutable bool m_hasNameIndex { false };
+    bool m_needsURLUpdate { false };
     bool needsSorting { true };
 };
 
@@ -29,6 +29,7 @@
 #include "JavaScriptCore/JSClassRef.h"
 #include "JavaScriptCore/JSMicrotask.h"
 #include "ZigConsoleClient.h"
+#include "DeepEqualsVisitedPairs.h"
 // #include "JavaScriptCore/JSContextInternal.h"
 #include "JavaScriptCore/CatchScope.h"
 #include "JavaScriptCore/DeferredWorkTimer.h"
@@ -64,7 +65,7 @@
 #include "wtf/text/StringView.h"
 #include "wtf/text/WTFString.h"
 
-#include "wtf/text/Base64.h"
+#include "BunBase64.h"
 // #include "JavaScriptCore/CachedType.h"
 #include "JavaScriptCore/JSCallbackObject.h"
 #include "JavaScriptCore/JSClassRef.h"
@@ -89,6 +90,7 @@
 #include "JSCloseEvent.h"
 #include "JSFetchHeaders.h"
 #include "JSStringDecoder.h"
+#include "JSDigestStream.h"
 #include "JSReadableState.h"
 #include "JSReadableHelper.h"
 #include "Process.h"
@@ -827,59 +829,108 @@ static JSC_DEFINE_HOST_FUNCTION(functionBTOA,
     (JSC::JSGlobalObject * globalObject, JSC::CallFrame* callFrame))
 {
     JSC::VM& vm = globalObject->vm();
+    auto scope = DECLARE_THROW_SCOPE(vm);
 
     if (callFrame->argumentCount() == 0) {
-        auto scope = DECLARE_THROW_SCOPE(globalObject->vm());
         JSC::throwTypeError(globalObject, scope, "btoa requires 1 argument (a string)"_s);
         return JSC::JSValue::encode(JSC::JSValue {});
     }
 
     const String& stringToEncode = callFrame->argument(0).toWTFString(globalObject);
+    RETURN_IF_EXCEPTION(scope, encodedJSValue());
 
     if (!stringToEncode || stringToEncode.isNull()) {
         return JSC::JSValue::encode(JSC::jsString(vm, WTF::String()));
     }
 
     if (!stringToEncode.isAllLatin1()) {
-        auto scope = DECLARE_THROW_SCOPE(globalObject->vm());
         // TODO: DOMException
         JSC::throwTypeError(globalObject, scope, "The string contains invalid characters."_s);
         return JSC::JSValue::encode(JSC::JSValue {});
     }
 
-    return JSC::JSValue::encode(JSC::jsString(vm, WTF::base64EncodeToString(stringToEncode.latin1())));
+    size_t length = stringToEncode.length();
+    if (length == 0)
+        return JSC::JSValue::encode(JSC::jsEmptyString(vm));
+
+    // 8-bit strings are encoded in place, only 16-bit Latin-1 strings are narrowed first
+    Vector<LChar> narrowed;
+    const LChar* bytes = nullptr;
+    if (stringToEncode.is8Bit()) {
+        bytes = stringToEncode.characters8();
+    } else {
+        narrowed.grow(length);
+        WTF::StringImpl::copyCharacters(narrowed.data(), stringToEncode.characters16(), length);
+        bytes = narrowed.data();
+    }
+
+    size_t encodedLength = Bun::Base64::encodedLength(length, Bun::Base64::Alphabet::Standard);
+    LChar* data = nullptr;
+    auto impl = encodedLength <= WTF::StringImpl::MaxLength ? WTF::StringImpl::tryCreateUninitialized(encodedLength, data) : nullptr;
+    if (UNLIKELY(!impl)) {
+        throwOutOfMemoryError(globalObject, scope);
+        return JSC::JSValue::encode(JSC::JSValue {});
+    }
+
+    Bun::Base64::encode(data, bytes, length, Bun::Base64::Alphabet::Standard);
+    return JSC::JSValue::encode(JSC::jsString(vm, WTF::String(WTFMove(impl))));
+}
+
+template<typename CharType>
+static JSC::EncodedJSValue decodeBase64ForATOB(JSC::JSGlobalObject* globalObject, const CharType* characters, size_t length)
+{
+    JSC::VM& vm = globalObject->vm();
+    auto scope = DECLARE_THROW_SCOPE(vm);
+
+    // Exact unless the input contains whitespace
+    size_t decodedLength = Bun::Base64::decodedLength(characters, length);
+    LChar* data = nullptr;
+    RefPtr<WTF::StringImpl> impl;
+    if (decodedLength > 0) {
+        impl = decodedLength <= WTF::StringImpl::MaxLength ? WTF::StringImpl::tryCreateUninitialized(decodedLength, data) : nullptr;
+        if (UNLIKELY(!impl)) {
+            throwOutOfMemoryError(globalObject, scope);
+            return JSC::JSValue::encode(JSC::JSValue {});
+        }
+    }
+
+    auto written = Bun::Base64::decodeForgiving(reinterpret_cast<uint8_t*>(data), decodedLength, characters, length);
+    if (!written) {
+        // TODO: DOMException
+        JSC::throwTypeError(globalObject, scope, "The string contains invalid characters."_s);
+        return JSC::JSValue::encode(JSC::JSValue {});
+    }
+
+    if (*written == 0)
+        return JSC::JSValue::encode(JSC::jsEmptyString(vm));
+
+    if (UNLIKELY(*written != decodedLength))
+        impl = WTF::StringImpl::create(data, *written);
+
+    return JSC::JSValue::encode(JSC::jsString(vm, WTF::String(WTFMove(impl))));
 }
 
 static JSC_DEFINE_HOST_FUNCTION(functionATOB,
     (JSC::JSGlobalObject * globalObject, JSC::CallFrame* callFrame))
 {
     JSC::VM& vm = globalObject->vm();
+    auto scope = DECLARE_THROW_SCOPE(vm);
 
     if (callFrame->argumentCount() == 0) {
-        auto scope = DECLARE_THROW_SCOPE(globalObject->vm());
         JSC::throwTypeError(globalObject, scope, "atob requires 1 argument (a string)"_s);
         return JSC::JSValue::encode(JSC::JSValue {});
     }
 
     const WTF::String& encodedString = callFrame->argument(0).toWTFString(globalObject);
+    RETURN_IF_EXCEPTION(scope, encodedJSValue());
 
     if (encodedString.isNull()) {
         return JSC::JSValue::encode(JSC::jsEmptyString(vm));
     }
 
-    auto decodedData = WTF::base64Decode(encodedString, {
-                                                            WTF::Base64DecodeOptions::ValidatePadding,
-                                                            WTF::Base64DecodeOptions::IgnoreSpacesAndNewLines,
-                                                            WTF::Base64DecodeOptions::DiscardVerticalTab,
-                                                        });
-    if (!decodedData) {
-        auto scope = DECLARE_THROW_SCOPE(globalObject->vm());
-        // TODO: DOMException
-        JSC::throwTypeError(globalObject, scope, "The string contains invalid characters."_s);
-        return JSC::JSValue::encode(JSC::JSValue {});
-    }
-
-    return JSC::JSValue::encode(JSC::jsString(vm, WTF::String(decodedData->data(), decodedData->size())));
+    if (encodedString.is8Bit())
+        RELEASE_AND_RETURN(scope, decodeBase64ForATOB(globalObject, encodedString.characters8(), encodedString.length()));
+    RELEASE_AND_RETURN(scope, decodeBase64ForATOB(globalObject, encodedString.characters16(), encodedString.length()));
 }
 
 static JSC_DEFINE_HOST_FUNCTION(functionHashCode,
@@ -1060,6 +1111,7 @@ JSC:
         static NeverDestroyed<const String> bunStreamString(MAKE_STATIC_STRING_IMPL("bun:stream"));
         static NeverDestroyed<const String> noopString(MAKE_STATIC_STRING_IMPL("noop"));
         static NeverDestroyed<const String> createImportMeta(MAKE_STATIC_STRING_IMPL("createImportMeta"));
+        static NeverDestroyed<const String> scriptExecutionContextForTestingString(MAKE_STATIC_STRING_IMPL("scriptExecutionContextForTesting"));
 
         JSC::JSValue moduleName = callFrame->argument(0);
         if (moduleName.isNumber()) {
@@ -1139,6 +1191,10 @@ JSC:
             return JSValue::encode(obj);
         }
 
+        if (UNLIKELY(string == scriptExecutionContextForTestingString)) {
+            return JSC::JSValue::encode(createScriptExecutionContextTestingObject(globalObject));
+        }
+
         if (UNLIKELY(string == noopString)) {
             auto* obj = constructEmptyObject(globalObject);
             obj->putDirectCustomAccessor(vm, JSC::PropertyName(JSC::Identifier::fromString(vm, "getterSetter"_s)), JSC::CustomGetterSetter::create(vm, noop_getter, noop_setter), 0);
@@ -1305,6 +1361,12 @@ JSC_DEFINE_CUSTOM_GETTER(getterSubtleCryptoConstructor, (JSGlobalObject * lexica
         JSSubtleCrypto::getConstructor(thisObject->vm(), thisObject));
 }
 
+JSC_DEFINE_CUSTOM_GETTER(getterDigestStreamConstructor, (JSGlobalObject * lexicalGlobalObject, EncodedJSValue thisValue, PropertyName attributeName))
+{
+    Zig::GlobalObject* thisObject = JSC::jsCast<Zig::GlobalObject*>(lexicalGlobalObject);
+    return JSValue::encode(thisObject->JSDigestStream());
+}
+
 JSC_DEFINE_CUSTOM_GETTER(getterCryptoKeyConstructor, (JSGlobalObject * lexicalGlobalObject, EncodedJSValue thisValue, PropertyName attributeName))
 {
     Zig::GlobalObject* thisObject = JSC::jsCast<Zig::GlobalObject*>(lexicalGlobalObject);
@@ -1817,7 +1879,7 @@ JSC_DEFINE_HOST_FUNCTION(functionBunDeepEquals, (JSGlobalObject * globalObject,
     JSC::JSValue arg1 = callFrame->argument(0);
     JSC::JSValue arg2 = callFrame->argument(1);
 
-    Vector<std::pair<JSValue, JSValue>, 16> stack;
+    DeepEqualsVisitedPairs stack;
 
     bool isEqual = Bun__deepEquals<false>(globalObject, arg1, arg2, stack, &scope, true);
     RETURN_IF_EXCEPTION(scope, {});
@@ -2282,6 +2344,95 @@ JSC::JSValue GlobalObject::formatStackTrace(JSC::VM& vm, JSC::JSGlobalObject* le
 
 extern "C" void Bun__remapStackFramePositions(JSC::JSGlobalObject*, ZigStackFrame*, size_t);
 
+// Creates the call sites for the captured frames, remaps their positions to the
+// original source and formats them, calling Error.prepareStackTrace if set.
+static JSC::JSValue computeErrorStackTrace(GlobalObject* globalObject, JSC::JSObject* errorObject, JSCStackTrace& stackTrace)
+{
+    JSC::VM& vm = globalObject->vm();
+
+    // Create an (uninitialized) array for our "call sites"
+    JSC::JSArray* callSites;
+    {
+        JSC::GCDeferralContext deferralContext(vm);
+        JSC::ObjectInitializationScope objectScope(vm);
+        callSites = JSC::JSArray::tryCreateUninitializedRestricted(objectScope,
+            &deferralContext,
+            globalObject->arrayStructureForIndexingTypeDuringAllocation(JSC::ArrayWithContiguous),
+            stackTrace.size());
+        RELEASE_ASSERT(callSites);
+
+        // Create the call sites (one per frame)
+        GlobalObject::createCallSitesFromFrames(globalObject, objectScope, stackTrace, callSites);
+    }
+
+    size_t framesCount = stackTrace.size();
+    ZigStackFrame remappedFrames[framesCount];
+    for (int i = 0; i < framesCount; i++) {
+        remappedFrames[i].source_url = Zig::toZigString(stackTrace.at(i).sourceURL(), globalObject);
+        if (JSCStackFrame::SourcePositions* sourcePositions = stackTrace.at(i).getSourcePositions()) {
+            remappedFrames[i].position.line = sourcePositions->line.zeroBasedInt();
+            remappedFrames[i].position.column_start = sourcePositions->startColumn.zeroBasedInt() + 1;
+        } else {
+            remappedFrames[i].position.line = -1;
+            remappedFrames[i].position.column_start = -1;
+        }
+    }
+
+    // remap line and column start to original source
+    Bun__remapStackFramePositions(globalObject, remappedFrames, framesCount);
+
+    return globalObject->formatStackTrace(vm, globalObject, errorObject, callSites, remappedFrames);
+}
+
+static JSC::JSValue putErrorStackTrace(JSC::JSGlobalObject* lexicalGlobalObject, JSC::JSObject* errorObject, JSC::JSValue formattedStackTrace)
+{
+    JSC::VM& vm = lexicalGlobalObject->vm();
+    auto scope = DECLARE_THROW_SCOPE(vm);
+    JSC::JSValue stack = jsUndefined();
+    if (!formattedStackTrace.isUndefinedOrNull()) {
+        stack = formattedStackTrace.toString(lexicalGlobalObject);
+        RETURN_IF_EXCEPTION(scope, {});
+    }
+
+    errorObject->putDirect(vm, vm.propertyNames->stack, stack, JSC::PropertyAttribute::ReadOnly | JSC::PropertyAttribute::DontEnum);
+    return stack;
+}
+
+// Getter for the "stack" property installed by Error.captureStackTrace. The
+// first read formats the captured frames and replaces the accessor with the
+// resulting string.
+JSC_DEFINE_CUSTOM_GETTER(errorInstanceLazyStackTraceGetter, (JSGlobalObject * lexicalGlobalObject, EncodedJSValue thisValue, PropertyName))
+{
+    GlobalObject* globalObject = reinterpret_cast<GlobalObject*>(lexicalGlobalObject);
+    JSC::VM& vm = globalObject->vm();
+    auto scope = DECLARE_THROW_SCOPE(vm);
+
+    JSC::JSObject* errorObject = JSValue::decode(thisValue).getObject();
+    if (UNLIKELY(!errorObject)) {
+        return JSValue::encode(jsUndefined());
+    }
+
+    auto& builtinNames = WebCore::builtinNames(vm);
+    auto* capturedStackTrace = jsDynamicCast<JSCapturedStackTrace*>(errorObject->getDirect(vm, builtinNames.capturedStackTracePrivateName()));
+    if (UNLIKELY(!capturedStackTrace)) {
+        return JSValue::encode(jsUndefined());
+    }
+
+    JSCStackTrace stackTrace = JSCStackTrace::fromExisting(vm, capturedStackTrace->frames());
+    JSC::JSValue formattedStackTrace = computeErrorStackTrace(globalObject, errorObject, stackTrace);
+    RETURN_IF_EXCEPTION(scope, {});
+
+    // Formatting can run user code (Error.prepareStackTrace, message getters)
+    // which may already have replaced the accessor.
+    if (errorObject->getDirect(vm, builtinNames.capturedStackTracePrivateName()) != capturedStackTrace) {
+        RELEASE_AND_RETURN(scope, JSValue::encode(errorObject->get(globalObject, vm.propertyNames->stack)));
+    }
+
+    errorObject->deleteProperty(globalObject, builtinNames.capturedStackTracePrivateName());
+    errorObject->deleteProperty(globalObject, vm.propertyNames->stack);
+    RELEASE_AND_RETURN(scope, JSValue::encode(putErrorStackTrace(globalObject, errorObject, formattedStackTrace)));
+}
+
 JSC_DECLARE_HOST_FUNCTION(errorConstructorFuncCaptureStackTrace);
 JSC_DEFINE_HOST_FUNCTION(errorConstructorFuncCaptureStackTrace, (JSC::JSGlobalObject * lexicalGlobalObject, JSC::CallFrame* callFrame))
 {
@@ -2311,53 +2462,32 @@ JSC_DEFINE_HOST_FUNCTION(errorConstructorFuncCaptureStackTrace, (JSC::JSGlobalOb
     }
     JSCStackTrace stackTrace = JSCStackTrace::captureCurrentJSStackTrace(globalObject, callFrame, stackTraceLimit, caller);
 
-    // Create an (uninitialized) array for our "call sites"
-    JSC::GCDeferralContext deferralContext(vm);
-    JSC::ObjectInitializationScope objectScope(vm);
-    JSC::JSArray* callSites = JSC::JSArray::tryCreateUninitializedRestricted(objectScope,
-        &deferralContext,
-        globalObject->arrayStructureForIndexingTypeDuringAllocation(JSC::ArrayWithContiguous),
-        stackTrace.size());
-    RELEASE_ASSERT(callSites);
-
-    // Create the call sites (one per frame)
-    GlobalObject::createCallSitesFromFrames(lexicalGlobalObject, objectScope, stackTrace, callSites);
-
-    /* Foramt the stack trace.
-     * Note that v8 won't actually format the stack trace here, but will create a "stack" accessor
-     * on the error object, which will format the stack trace on the first access. For now, since
-     * we're not being used internally by JSC, we can assume callers of Error.captureStackTrace in
-     * node are interested in the (formatted) stack. */
-
-    size_t framesCount = stackTrace.size();
-    ZigStackFrame remappedFrames[framesCount];
-    for (int i = 0; i < framesCount; i++) {
-        remappedFrames[i].source_url = Zig::toZigString(stackTrace.at(i).sourceURL(), lexicalGlobalObject);
-        if (JSCStackFrame::SourcePositions* sourcePositions = stackTrace.at(i).getSourcePositions()) {
-            remappedFrames[i].position.line = sourcePositions->line.zeroBasedInt();
-            remappedFrames[i].position.column_start = sourcePositions->startColumn.zeroBasedInt() + 1;
-        } else {
-            remappedFrames[i].position.line = -1;
-            remappedFrames[i].position.column_start = -1;
-        }
+    if (errorObject->hasProperty(lexicalGlobalObject, vm.propertyNames->stack)) {
+        errorObject->deleteProperty(lexicalGlobalObject, vm.propertyNames->stack);
     }
+    RETURN_IF_EXCEPTION(scope, JSC::JSValue::encode(JSValue {}));
 
-    // remap line and column start to original source
-    Bun__remapStackFramePositions(lexicalGlobalObject, remappedFrames, framesCount);
+    /* Error.prepareStackTrace receives call sites with their "this" values, which are only
+     * reachable while the frames are still on the stack, so it has to run now. Otherwise, like
+     * v8, only the frames are kept here: computing source positions, remapping them through
+     * source maps and formatting the string is left to the first read of "stack", which many
+     * callers (e.g. http-errors and depd on every request) never do. */
+    JSC::JSValue prepareStackTrace = errorConstructor->getIfPropertyExists(lexicalGlobalObject, JSC::Identifier::fromString(vm, "prepareStackTrace"_s));
+    RETURN_IF_EXCEPTION(scope, JSC::JSValue::encode(JSValue {}));
+    if (prepareStackTrace && prepareStackTrace.isCallable()) {
+        JSC::JSValue formattedStackTrace = computeErrorStackTrace(globalObject, errorObject, stackTrace);
+        RETURN_IF_EXCEPTION(scope, JSC::JSValue::encode({}));
 
-    JSC::JSValue formattedStackTrace = globalObject->formatStackTrace(vm, lexicalGlobalObject, errorObject, callSites, remappedFrames);
-    RETURN_IF_EXCEPTION(scope, JSC::JSValue::encode({}));
+        putErrorStackTrace(lexicalGlobalObject, errorObject, formattedStackTrace);
+        RETURN_IF_EXCEPTION(scope, JSC::JSValue::encode(JSValue {}));
 
-    if (errorObject->hasProperty(lexicalGlobalObject, vm.propertyNames->stack)) {
-        errorObject->deleteProperty(lexicalGlobalObject, vm.propertyNames->stack);
-    }
-    if (formattedStackTrace.isUndefinedOrNull()) {
-        errorObject->putDirect(vm, vm.propertyNames->stack, jsUndefined(), JSC::PropertyAttribute::ReadOnly | JSC::PropertyAttribute::DontEnum);
-    } else {
-        errorObject->putDirect(vm, vm.propertyNames->stack, formattedStackTrace.toString(lexicalGlobalObject), JSC::PropertyAttribute::ReadOnly | JSC::PropertyAttribute::DontEnum);
+        return JSC::JSValue::encode(JSC::jsUndefined());
     }
 
-    RETURN_IF_EXCEPTION(scope, JSC::JSValue::encode(JSValue {}));
+    auto* capturedStackTrace = JSCapturedStackTrace::create(vm, globalObject->capturedStackTraceStructure(), stackTrace);
+    errorObject->putDirect(vm, WebCore::builtinNames(vm).capturedStackTracePrivateName(), capturedStackTrace, JSC::PropertyAttribute::DontEnum | 0);
+    errorObject->putDirectCustomAccessor(vm, vm.propertyNames->stack, JSC::CustomGetterSetter::create(vm, errorInstanceLazyStackTraceGetter, nullptr),
+        JSC::PropertyAttribute::CustomValue | JSC::PropertyAttribute::ReadOnly | JSC::PropertyAttribute::DontEnum);
 
     return JSC::JSValue::encode(JSC::jsUndefined());
 }
@@ -2417,6 +2547,11 @@ void GlobalObject::finishCreation(VM& vm)
             init.set(Bun::PendingVirtualModuleResult::createStructure(init.vm, init.owner, init.owner->objectPrototype()));
         });
 
+    this->m_capturedStackTraceStructure.initLater(
+        [](const Initializer<Structure>& init) {
+            init.set(JSCapturedStackTrace::createStructure(init.vm, init.owner, jsNull()));
+        });
+
     this->initGeneratedLazyClasses();
 
     m_subtleCryptoObject.initLater(
@@ -2603,6 +2738,18 @@ void GlobalObject::finishCreation(VM& vm)
             init.setConstructor(constructor);
         });
 
+    m_JSDigestStreamClassStructure.initLater(
+        [](LazyClassStructure::Initializer& init) {
+            auto* prototype = JSDigestStreamPrototype::create(
+                init.vm, init.global, JSDigestStreamPrototype::createStructure(init.vm, init.global, init.global->objectPrototype()));
+            auto* structure = JSDigestStream::createStructure(init.vm, init.global, prototype);
+            auto* constructor = JSDigestStreamConstructor::create(
+                init.vm, init.global, JSDigestStreamConstructor::createStructure(init.vm, init.global, init.global->functionPrototype()), prototype);
+            init.setPrototype(prototype);
+            init.setStructure(structure);
+            init.setConstructor(constructor);
+        });
+
     m_JSReadableStateClassStructure.initLater(
         [](LazyClassStructure::Initializer& init) {
             auto* prototype = JSReadableStatePrototype::create(
@@ -3256,6 +3403,8 @@ void GlobalObject::installAPIGlobals(JSClassRef* globals, int count, JSC::VM& vm
         Crypto__randomUUID__put(this, JSValue::encode(object));
         object->putDirectCustomAccessor(vm, JSC::Identifier::fromString(vm, "subtle"_s), JSC::CustomGetterSetter::create(vm, getterSubtleCrypto, nullptr),
             JSC::PropertyAttribute::ReadOnly | JSC::PropertyAttribute::DontDelete | 0);
+        object->putDirectCustomAccessor(vm, JSC::Identifier::fromString(vm, "DigestStream"_s), JSC::CustomGetterSetter::create(vm, getterDigestStreamConstructor, nullptr),
+            JSC::PropertyAttribute::ReadOnly | JSC::PropertyAttribute::DontDelete | JSC::PropertyAttribute::DontEnum | 0);
         this->putDirect(vm, JSC::Identifier::fromString(vm, "crypto"_s), object, JSC::PropertyAttribute::DontDelete | 0);
     }
 
@@ -3353,10 +3502,12 @@ void GlobalObject::visitChildrenImpl(JSCell* cell, Visitor& visitor)
     thisObject->m_JSHTTPSResponseSinkClassStructure.visit(visitor);
     thisObject->m_JSReadableStateClassStructure.visit(visitor);
     thisObject->m_JSStringDecoderClassStructure.visit(visitor);
+    thisObject->m_JSDigestStreamClassStructure.visit(visitor);
     thisObject->m_NapiClassStructure.visit(visitor);
     thisObject->m_OnigurumaRegExpClassStructure.visit(visitor);
 
     thisObject->m_pendingVirtualModuleResultStructure.visit(visitor);
+    thisObject->m_capturedStackTraceStructure.visit(visitor);
     thisObject->m_performMicrotaskFunction.visit(visitor);
     thisObject->m_performMicrotaskVariadicFunction.visit(visitor);
     thisObject->m_lazyReadableStreamPrototypeMap.visit(visitor);
@@ -220,6 +220,9 @@ public:
     JSC::JSObject* JSStringDecoder() { return m_JSStringDecoderClassStructure.constructorInitializedOnMainThread(this); }
     JSC::JSValue JSStringDecoderPrototype() { return m_JSStringDecoderClassStructure.prototypeInitializedOnMainThread(this); }
 
+    JSC::Structure* JSDigestStreamStructure() { return m_JSDigestStreamClassStructure.getInitializedOnMainThread(this); }
+    JSC::JSObject* JSDigestStream() { return m_JSDigestStreamClassStructure.constructorInitializedOnMainThread(this); }
+
     JSC::Structure* JSReadableStateStructure() { return m_JSReadableStateClassStructure.getInitializedOnMainThread(this); }
     JSC::JSObject* JSReadableState() { return m_JSReadableStateClassStructure.constructorInitializedOnMainThread(this); }
     JSC::JSValue JSReadableStatePrototype() { return m_JSReadableStateClassStructure.prototypeInitializedOnMainThread(this); }
@@ -233,6 +236,7 @@ public:
     JSC::Structure* encodeIntoObjectStructure() { return m_encodeIntoObjectStructure.getInitializedOnMainThread(this); }
 
     JSC::Structure* callSiteStructure() const { return m_callSiteStructure.getInitializedOnMainThread(this); }
+    JSC::Structure* capturedStackTraceStructure() { return m_capturedStackTraceStructure.get(this); }
 
     JSC::JSObject* performanceObject() { return m_performanceObject.getInitializedOnMainThread(this); }
     JSC::JSObject* primordialsObject() { return m_primordialsObject.getInitializedOnMainThread(this); }
@@ -430,6 +434,30 @@ public:
     void* napiInstanceData = nullptr;
     void* napiInstanceDataFinalizer = nullptr;
     void* napiInstanceDataFinalizerHint = nullptr;
+    // The running total of napi_adjust_external_memory().
+    int64_t napiExternalMemorySize = 0;
+
+    // Property names passed to napi_get_named_property() and friends, by the
+    // address of the C string, since addons pass the same literals over and
+    // over. The structure and offset of the own data property last read with
+    // a name let the next read from an object of that shape skip the lookup.
+    struct NapiPropertyName {
+        const char* utf8name = nullptr;
+        JSC::Identifier identifier;
+        JSC::Weak<JSC::Structure> structure;
+        JSC::PropertyOffset offset = JSC::invalidOffset;
+    };
+    static constexpr size_t napiPropertyNameCacheSize = 256;
+    std::array<NapiPropertyName, napiPropertyNameCacheSize> napiPropertyNames;
+
+    // The encoded bytes of the last string searched for with
+    // Buffer.prototype.indexOf() and friends, so that searching for the same
+    // string in a loop does not encode it again on every call.
+    struct {
+        RefPtr<WTF::StringImpl> string;
+        uint8_t encoding = 0;
+        Vector<uint8_t> bytes;
+    } bufferSearchNeedle;
 
 #include "ZigGeneratedClasses+lazyStructureHeader.h"
 
@@ -464,6 +492,7 @@ private:
     LazyClassStructure m_JSHTTPSResponseSinkClassStructure;
     LazyClassStructure m_JSReadableStateClassStructure;
     LazyClassStructure m_JSStringDecoderClassStructure;
+    LazyClassStructure m_JSDigestStreamClassStructure;
     LazyClassStructure m_NapiClassStructure;
     LazyClassStructure m_OnigurumaRegExpClassStructure;
     LazyClassStructure m_callSiteStructure;
@@ -479,6 +508,7 @@ private:
      * those callbacks will eventually never be called anymore. But it'll work the first time!
      */
     LazyProperty<JSGlobalObject, JSC::Structure> m_pendingVirtualModuleResultStructure;
+    LazyProperty<JSGlobalObject, JSC::Structure> m_capturedStackTraceStructure;
     LazyProperty<JSGlobalObject, JSFunction> m_performMicrotaskFunction;
     LazyProperty<JSGlobalObject, JSFunction> m_performMicrotaskVariadicFunction;
     LazyProperty<JSGlobalObject, JSFunction> m_emitReadableNextTickFunction;
@@ -8,7 +8,9 @@
 #include "JavaScriptCore/CodeCache.h"
 
 #include "JavaScriptCore/Completion.h"
+#include "wtf/HashSet.h"
 #include "wtf/Scope.h"
+#include "wtf/Threading.h"
 #include "wtf/text/StringHash.h"
 #include <sys/stat.h>
 
@@ -27,6 +29,13 @@ using SourceOrigin = JSC::SourceOrigin;
 using String = WTF::String;
 using SourceProviderSourceType = JSC::SourceProviderSourceType;
 
+// JSC hands back plain JSC::SourceProviders (e.g. from a CodeBlock), and eval
+// and Function sources use its own provider classes. Every Zig::SourceProvider
+// tags itself with its SourceID on the thread that created it, which is the
+// only thread whose VM runs its code. SourceIDs are never reused, so a tag
+// left behind by a provider destroyed elsewhere can't match another provider.
+static thread_local HashSet<JSC::SourceID> zigSourceProviderIDs;
+
 Ref<SourceProvider> SourceProvider::create(ResolvedSource resolvedSource)
 {
     void* allocator = resolvedSource.allocator;
@@ -42,12 +51,13 @@ Ref<SourceProvider> SourceProvider::create(ResolvedSource resolvedSource)
     //         sourceType));
     // }
 
+    RefPtr<SourceProvider> provider;
     if (allocator) {
         Ref<WTF::ExternalStringImpl> stringImpl_ = WTF::ExternalStringImpl::create(
             resolvedSource.source_code.ptr, resolvedSource.source_code.len,
             allocator,
             RefString__free);
-        return adoptRef(*new SourceProvider(
+        provider = adoptRef(*new SourceProvider(
             resolvedSource, stringImpl_,
             JSC::SourceOrigin(WTF::URL::fileURLWithFileSystemPath(toString(resolvedSource.source_url))),
             toStringNotConst(resolvedSource.source_url), TextPosition(),
@@ -55,12 +65,36 @@ Ref<SourceProvider> SourceProvider::create(ResolvedSource resolvedSource)
     } else {
         Ref<WTF::ExternalStringImpl> stringImpl_ = WTF::ExternalStringImpl::createStatic(
             resolvedSource.source_code.ptr, resolvedSource.source_code.len);
-        return adoptRef(*new SourceProvider(
+        provider = adoptRef(*new SourceProvider(
             resolvedSource, stringImpl_,
             JSC::SourceOrigin(WTF::URL::fileURLWithFileSystemPath(toString(resolvedSource.source_url))),
             toStringNotConst(resolvedSource.source_url), TextPosition(),
             sourceType));
     }
+
+    provider->m_taggedThread = &Thread::current();
+    zigSourceProviderIDs.add(provider->asID());
+    return provider.releaseNonNull();
+}
+
+void SourceProvider::untag()
+{
+    if (m_taggedThread == &Thread::current())
+        zigSourceProviderIDs.remove(asID());
+}
+
+SourceProvider* SourceProvider::fromProvider(JSC::SourceProvider* provider)
+{
+    if (!provider || !zigSourceProviderIDs.contains(provider->asID()))
+        return nullptr;
+    return static_cast<SourceProvider*>(provider);
+}
+
+const SourceLineIndex& SourceProvider::lineIndex()
+{
+    if (!m_lineIndex)
+        m_lineIndex = makeUnique<SourceLineIndex>(source());
+    return *m_lineIndex;
 }
 
 unsigned SourceProvider::getHash()
@@ -79,6 +113,7 @@ void SourceProvider::freeSourceCode()
         return;
     }
     did_free_source_code = true;
+    m_lineIndex = nullptr;
     if (m_resolvedSource.allocator != 0) { // // WTF::ExternalStringImpl::destroy(m_source.ptr());
         this->m_source = WTF::StringImpl::empty()->isolatedCopy();
         this->m_hash = 0;
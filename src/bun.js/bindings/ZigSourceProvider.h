@@ -17,6 +17,7 @@ class SourceProvider;
 // #include "JavaScriptCore/SourceCodeKey.h"
 #include "JavaScriptCore/SourceProvider.h"
 #include "JavaScriptCore/Structure.h"
+#include "SourceLineIndex.h"
 
 namespace Zig {
 
@@ -35,6 +36,7 @@ public:
     static Ref<SourceProvider> create(ResolvedSource resolvedSource);
     ~SourceProvider()
     {
+        untag();
         freeSourceCode();
 
         commitCachedBytecode();
@@ -61,6 +63,13 @@ public:
     int readCache(JSC::VM& vm, const JSC::SourceCode& sourceCode);
     void freeSourceCode();
 
+    // Returns provider as a Zig::SourceProvider if Bun created it.
+    static SourceProvider* fromProvider(JSC::SourceProvider* provider);
+
+    // Line starts of the source, built the first time a stack trace needs
+    // a position in it. Only used from the thread that runs the source.
+    const SourceLineIndex& lineIndex();
+
 private:
     SourceProvider(ResolvedSource resolvedSource, WTF::StringImpl& sourceImpl,
         const SourceOrigin& sourceOrigin, WTF::String&& sourceURL,
@@ -76,11 +85,15 @@ private:
         getHash();
     }
 
+    void untag();
+
     unsigned m_hash;
     unsigned getHash();
     RefPtr<JSC::CachedBytecode> m_cachedBytecode;
     Ref<WTF::StringImpl> m_source;
+    std::unique_ptr<SourceLineIndex> m_lineIndex;
     bool did_free_source_code = false;
+    Thread* m_taggedThread = nullptr;
     // JSC::SourceCodeKey key;
 };
 
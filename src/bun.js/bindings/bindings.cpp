@@ -47,6 +47,7 @@
 #include "wtf/text/StringImpl.h"
 #include "wtf/text/StringView.h"
 #include "wtf/text/WTFString.h"
+#include "wtf/Scope.h"
 #include "JavaScriptCore/FunctionPrototype.h"
 #include "JSFetchHeaders.h"
 #include "FetchHeaders.h"
@@ -83,6 +84,9 @@
 #include "JavaScriptCore/HashMapImpl.h"
 #include "JavaScriptCore/HashMapImplInlines.h"
 #include "OnigurumaRegExp.h"
+#include "JSONUTF8Serializer.h"
+#include "JSONUTF8Parser.h"
+#include "DeepEqualsVisitedPairs.h"
 
 template<typename UWSResponse>
 static void copyToUWS(WebCore::FetchHeaders* headers, UWSResponse* res)
@@ -157,7 +161,7 @@ static bool canPerformFastPropertyEnumerationForIterationBun(Structure* s)
 }
 
 template<bool isStrict>
-bool Bun__deepEquals(JSC__JSGlobalObject* globalObject, JSValue v1, JSValue v2, Vector<std::pair<JSC::JSValue, JSC::JSValue>, 16>& stack, ThrowScope* scope, bool addToStack)
+bool Bun__deepEquals(JSC__JSGlobalObject* globalObject, JSValue v1, JSValue v2, DeepEqualsVisitedPairs& stack, ThrowScope* scope, bool addToStack)
 {
     VM& vm = globalObject->vm();
     if (!v1.isEmpty() && !v2.isEmpty() && JSC::sameValue(globalObject, v1, v2)) {
@@ -173,22 +177,19 @@ bool Bun__deepEquals(JSC__JSGlobalObject* globalObject, JSValue v1, JSValue v2,
     RELEASE_ASSERT(v1.isCell());
     RELEASE_ASSERT(v2.isCell());
 
-    size_t length = stack.size();
-    size_t originalLength = length;
-    for (size_t i = 0; i < length; i++) {
-        auto values = stack.at(i);
-        if (JSC::JSValue::strictEqual(globalObject, values.first, v1)) {
-            return JSC::JSValue::strictEqual(globalObject, values.second, v2);
-        } else if (JSC::JSValue::strictEqual(globalObject, values.second, v2))
-            return false;
-    }
-
-    if (addToStack) {
-        stack.append({ v1, v2 });
-    }
-
     JSCell* c1 = v1.asCell();
     JSCell* c2 = v2.asCell();
+
+    if (auto visited = stack.find(c1, c2))
+        return *visited;
+
+    if (addToStack)
+        stack.add(c1, c2);
+    auto removeFromStack = WTF::makeScopeExit([&] {
+        if (addToStack)
+            stack.remove(c1, c2);
+    });
+
     JSObject* o1 = v1.getObject();
     JSObject* o2 = v2.getObject();
     JSC::JSType c1Type = c1->type();
@@ -207,48 +208,58 @@ bool Bun__deepEquals(JSC__JSGlobalObject* globalObject, JSValue v1, JSValue v2,
             return false;
         }
 
-        IterationRecord iterationRecord1 = iteratorForIterable(globalObject, v1);
-        bool isEqual = true;
-        while (true) {
-            JSValue next1 = iteratorStep(globalObject, iterationRecord1);
-            if (next1.isFalse()) {
-                break;
-            }
+        // A primitive only deep-equals itself, so it is looked up in the other
+        // set's hash table. Objects are matched against the objects of set2.
+        MarkedArgumentBuffer objects2;
+        for (auto* bucket = set2->head()->next(); bucket; bucket = bucket->next()) {
+            if (!bucket->deleted() && bucket->key().isObject())
+                objects2.append(bucket->key());
+        }
+        ASSERT(!objects2.hasOverflowed());
 
-            JSValue nextValue1 = iteratorValue(globalObject, next1);
-            RETURN_IF_EXCEPTION(*scope, false);
+        // Matched members stay paired so that no two members of set1 match
+        // the same member of set2, but only while comparing these two sets.
+        Vector<std::pair<JSCell*, JSCell*>, 16> matched;
+        auto removeMatched = WTF::makeScopeExit([&] {
+            for (auto& [left, right] : matched)
+                stack.remove(left, right);
+        });
 
-            bool found = false;
-            IterationRecord iterationRecord2 = iteratorForIterable(globalObject, v2);
-            while (true) {
-                JSValue next2 = iteratorStep(globalObject, iterationRecord2);
-                if (UNLIKELY(next2.isFalse())) {
-                    break;
-                }
+        for (auto* bucket = set1->head()->next(); bucket; bucket = bucket->next()) {
+            if (bucket->deleted())
+                continue;
 
-                JSValue nextValue2 = iteratorValue(globalObject, next2);
+            JSValue value1 = bucket->key();
+            if (!value1.isObject()) {
+                bool found = set2->has(globalObject, value1);
                 RETURN_IF_EXCEPTION(*scope, false);
+                if (!found)
+                    return false;
+                continue;
+            }
 
+            bool found = false;
+            for (size_t i = 0; i < objects2.size(); i++) {
+                JSValue value2 = objects2.at(i);
                 // set has unique values, no need to count
-                if (Bun__deepEquals<isStrict>(globalObject, nextValue1, nextValue2, stack, scope, false)) {
+                if (Bun__deepEquals<isStrict>(globalObject, value1, value2, stack, scope, false)) {
                     found = true;
-                    if (!nextValue1.isPrimitive()) {
-                        stack.append({ nextValue1, nextValue2 });
+                    // An outer comparison may hold this pair already, and
+                    // removing it here would drop theirs.
+                    if (!stack.find(value1.asCell(), value2.asCell())) {
+                        stack.add(value1.asCell(), value2.asCell());
+                        matched.append({ value1.asCell(), value2.asCell() });
                     }
                     break;
                 }
+                RETURN_IF_EXCEPTION(*scope, false);
             }
 
             if (!found) {
-                isEqual = false;
-                break;
+                return false;
             }
         }
 
-        if (!isEqual) {
-            return false;
-        }
-
         break;
     }
     case JSMapType: {
@@ -264,73 +275,56 @@ bool Bun__deepEquals(JSC__JSGlobalObject* globalObject, JSValue v1, JSValue v2,
             return false;
         }
 
-        IterationRecord iterationRecord1 = iteratorForIterable(globalObject, v1);
-        bool isEqual = true;
-        while (true) {
-            JSValue next1 = iteratorStep(globalObject, iterationRecord1);
-            if (next1.isFalse()) {
-                break;
+        // Same as for sets: entries with primitive keys are looked up by key,
+        // entries with object keys are matched against those of map2, which
+        // are kept as alternating keys and values.
+        MarkedArgumentBuffer objectEntries2;
+        for (auto* bucket = map2->head()->next(); bucket; bucket = bucket->next()) {
+            if (!bucket->deleted() && bucket->key().isObject()) {
+                objectEntries2.append(bucket->key());
+                objectEntries2.append(bucket->value());
             }
+        }
+        ASSERT(!objectEntries2.hasOverflowed());
 
-            JSValue nextValue1 = iteratorValue(globalObject, next1);
-            RETURN_IF_EXCEPTION(*scope, false);
-
-            if (UNLIKELY(!nextValue1.isObject())) {
-                return false;
-            }
-
-            JSObject* nextValueObject1 = asObject(nextValue1);
-
-            JSValue key1 = nextValueObject1->getIndex(globalObject, static_cast<unsigned>(0));
-            RETURN_IF_EXCEPTION(*scope, false);
-
-            JSValue value1 = nextValueObject1->getIndex(globalObject, static_cast<unsigned>(1));
-            RETURN_IF_EXCEPTION(*scope, false);
-
-            bool found = false;
-            IterationRecord iterationRecord2 = iteratorForIterable(globalObject, v2);
-            while (true) {
-                JSValue next2 = iteratorStep(globalObject, iterationRecord2);
-                if (UNLIKELY(next2.isFalse())) {
-                    break;
-                }
+        for (auto* bucket = map1->head()->next(); bucket; bucket = bucket->next()) {
+            if (bucket->deleted())
+                continue;
 
-                JSValue nextValue2 = iteratorValue(globalObject, next2);
+            JSValue key1 = bucket->key();
+            JSValue value1 = bucket->value();
+            if (!key1.isObject()) {
+                bool found = map2->has(globalObject, key1);
                 RETURN_IF_EXCEPTION(*scope, false);
-
-                if (UNLIKELY(!nextValue2.isObject())) {
+                if (!found)
                     return false;
-                }
 
-                JSObject* nextValueObject2 = asObject(nextValue2);
-
-                JSValue key2 = nextValueObject2->getIndex(globalObject, static_cast<unsigned>(0));
+                JSValue value2 = map2->get(globalObject, key1);
                 RETURN_IF_EXCEPTION(*scope, false);
-
-                JSValue value2 = nextValueObject2->getIndex(globalObject, static_cast<unsigned>(1));
+                if (!Bun__deepEquals<isStrict>(globalObject, value1, value2, stack, scope, false))
+                    return false;
                 RETURN_IF_EXCEPTION(*scope, false);
+                continue;
+            }
 
+            bool found = false;
+            for (size_t i = 0; i < objectEntries2.size(); i += 2) {
+                JSValue key2 = objectEntries2.at(i);
+                JSValue value2 = objectEntries2.at(i + 1);
                 if (Bun__deepEquals<isStrict>(globalObject, key1, key2, stack, scope, false)) {
-                    if (Bun__deepEquals<isStrict>(globalObject, nextValue1, nextValue2, stack, scope, false)) {
+                    if (Bun__deepEquals<isStrict>(globalObject, value1, value2, stack, scope, false)) {
                         found = true;
-                        if (!nextValue1.isPrimitive()) {
-                            stack.append({ nextValue1, nextValue2 });
-                        }
                         break;
                     }
                 }
+                RETURN_IF_EXCEPTION(*scope, false);
             }
 
             if (!found) {
-                isEqual = false;
-                break;
+                return false;
             }
         }
 
-        if (!isEqual) {
-            return false;
-        }
-
         break;
     }
     case ArrayBufferType: {
@@ -559,22 +553,22 @@ bool Bun__deepEquals(JSC__JSGlobalObject* globalObject, JSValue v1, JSValue v2,
             RETURN_IF_EXCEPTION(*scope, false);
         }
 
-        if (addToStack) {
-            stack.remove(originalLength);
-        }
-
         RETURN_IF_EXCEPTION(*scope, false);
 
         return true;
     }
 
+    JSC::Structure* o1Structure = o1->structure();
+    // Objects of the same shape have the same prototype, and so the same class
+    // name, and keep each property at the same offset.
+    bool sameStructure = o1Structure->id() == o2->structureID() && !o1Structure->hasPolyProto();
+
     if constexpr (isStrict) {
-        if (!equal(JSObject::calculatedClassName(o1), JSObject::calculatedClassName(o2))) {
+        if (!sameStructure && !equal(JSObject::calculatedClassName(o1), JSObject::calculatedClassName(o2))) {
             return false;
         }
     }
 
-    JSC::Structure* o1Structure = o1->structure();
     if (canPerformFastPropertyEnumerationForIterationBun(o1Structure)) {
         JSC::Structure* o2Structure = o2->structure();
         if (canPerformFastPropertyEnumerationForIterationBun(o2Structure)) {
@@ -595,7 +589,7 @@ bool Bun__deepEquals(JSC__JSGlobalObject* globalObject, JSValue v1, JSValue v2,
                 count1++;
 
                 JSValue left = o1->getDirect(entry.offset());
-                JSValue right = o2->getDirect(vm, JSC::PropertyName(entry.key()));
+                JSValue right = sameStructure ? o2->getDirect(entry.offset()) : o2->getDirect(vm, JSC::PropertyName(entry.key()));
 
                 if constexpr (!isStrict) {
                     if (left.isUndefined() && right.isEmpty()) {
@@ -643,10 +637,6 @@ bool Bun__deepEquals(JSC__JSGlobalObject* globalObject, JSValue v1, JSValue v2,
                 });
             }
 
-            if (addToStack) {
-                stack.remove(originalLength);
-            }
-
             return result;
         }
     }
@@ -695,10 +685,6 @@ bool Bun__deepEquals(JSC__JSGlobalObject* globalObject, JSValue v1, JSValue v2,
         RETURN_IF_EXCEPTION(*scope, false);
     }
 
-    if (addToStack) {
-        stack.remove(originalLength);
-    }
-
     return true;
 }
 
@@ -954,12 +940,16 @@ void WebCore__DOMURL__pathname_(WebCore__DOMURL* domURL, ZigString* arg1)
     *arg1 = Zig::toZigString(pathname);
 }
 
-extern "C" JSC__JSValue ZigString__toJSONObject(const ZigString* strPtr, JSC::JSGlobalObject* globalObject)
+extern "C" JSC__JSValue ZigString__toJSONObject(const ZigString* strPtr, JSC::JSGlobalObject* globalObject, bool* isAllASCII)
 {
-    auto str = Zig::toString(*strPtr);
     auto throwScope = DECLARE_THROW_SCOPE(globalObject->vm());
     auto scope = DECLARE_CATCH_SCOPE(globalObject->vm());
-    JSValue result = JSONParseWithException(globalObject, str);
+    JSValue result;
+    // UTF-8 is parsed from the bytes instead of being decoded into a string.
+    if (Zig::isTaggedUTF8Ptr(strPtr->ptr))
+        result = Bun::parseJSONUTF8(globalObject, Zig::untag(strPtr->ptr), strPtr->len, isAllASCII);
+    else
+        result = JSONParseWithException(globalObject, Zig::toString(*strPtr));
     if (auto* exception = scope.exception()) {
         scope.clearException();
         RELEASE_AND_RETURN(throwScope, JSC::JSValue::encode(exception->value()));
@@ -1176,6 +1166,15 @@ void JSC__JSValue__jsonStringify(JSC__JSValue JSValue0, JSC__JSGlobalObject* arg
     WTF::String str = JSC::JSONStringify(arg1, value, (unsigned)arg2);
     *arg3 = Zig::toZigString(str);
 }
+
+extern "C" bool JSC__JSValue__jsonStringifyUTF8(JSC__JSValue JSValue0, JSC__JSGlobalObject* globalObject, void* ctx,
+    Bun::JSONUTF8Serializer::WriteFunction write, bool* isAllASCII)
+{
+    Bun::JSONUTF8Serializer serializer(globalObject, ctx, write);
+    bool result = serializer.serialize(JSC::JSValue::decode(JSValue0));
+    *isAllASCII = serializer.isAllASCII();
+    return result;
+}
 unsigned char JSC__JSValue__jsType(JSC__JSValue JSValue0)
 {
     JSC::JSValue jsValue = JSC::JSValue::decode(JSValue0);
@@ -1306,7 +1305,7 @@ bool JSC__JSValue__deepEquals(JSC__JSValue JSValue0, JSC__JSValue JSValue1, JSC_
     JSValue v2 = JSValue::decode(JSValue1);
 
     ThrowScope scope = DECLARE_THROW_SCOPE(globalObject->vm());
-    Vector<std::pair<JSValue, JSValue>, 16> stack;
+    DeepEqualsVisitedPairs stack;
     return Bun__deepEquals<false>(globalObject, v1, v2, stack, &scope, true);
 }
 
@@ -1316,7 +1315,7 @@ bool JSC__JSValue__strictDeepEquals(JSC__JSValue JSValue0, JSC__JSValue JSValue1
     JSValue v2 = JSValue::decode(JSValue1);
 
     ThrowScope scope = DECLARE_THROW_SCOPE(globalObject->vm());
-    Vector<std::pair<JSValue, JSValue>, 16> stack;
+    DeepEqualsVisitedPairs stack;
     return Bun__deepEquals<true>(globalObject, v1, v2, stack, &scope, true);
 }
 
@@ -103,10 +103,18 @@ pub const ZigString = extern struct {
         return this;
     }
 
-    extern fn ZigString__toJSONObject(this: *const ZigString, *JSC.JSGlobalObject) callconv(.C) JSC.JSValue;
+    extern fn ZigString__toJSONObject(this: *const ZigString, *JSC.JSGlobalObject, is_all_ascii: ?*bool) callconv(.C) JSC.JSValue;
     pub fn toJSONObject(this: ZigString, globalThis: *JSC.JSGlobalObject) JSValue {
         JSC.markBinding(@src());
-        return ZigString__toJSONObject(&this, globalThis);
+        return ZigString__toJSONObject(&this, globalThis, null);
+    }
+
+    /// Like toJSONObject, for a UTF-8 string. Sets `is_all_ascii` to whether
+    /// its bytes were all ASCII, which the parser checks anyway.
+    pub fn toJSONObjectCheckingASCII(this: ZigString, globalThis: *JSC.JSGlobalObject, is_all_ascii: *bool) JSValue {
+        JSC.markBinding(@src());
+        std.debug.assert(this.isUTF8());
+        return ZigString__toJSONObject(&this, globalThis, is_all_ascii);
     }
 
     pub fn substring(this: ZigString, offset: usize) ZigString {
@@ -2905,6 +2913,31 @@ pub const JSValue = enum(JSValueReprInt) {
         return cppFn("jsonStringify", .{ this, globalThis, indent, out });
     }
 
+    extern fn JSC__JSValue__jsonStringifyUTF8(JSValue, *JSGlobalObject, ?*anyopaque, fn (?*anyopaque, [*]const u8, usize) callconv(.C) bool, *bool) bool;
+
+    /// Like `JSON.stringify(this)`, but the UTF-8 bytes are passed to `write`
+    /// in chunks instead of building a string. Returns false if an exception
+    /// was thrown, which is an out of memory error when `write` fails.
+    /// Nothing is written when `JSON.stringify` returns undefined.
+    pub fn jsonStringifyUTF8(
+        this: JSValue,
+        globalThis: *JSGlobalObject,
+        comptime Ctx: type,
+        ctx: *Ctx,
+        comptime write: fn (*Ctx, []const u8) error{OutOfMemory}!void,
+        is_all_ascii: *bool,
+    ) bool {
+        if (comptime is_bindgen) unreachable;
+
+        const Wrapper = struct {
+            pub fn call(ctx_: ?*anyopaque, ptr: [*]const u8, len: usize) callconv(.C) bool {
+                @call(.{ .modifier = .always_inline }, write, .{ @ptrCast(*Ctx, @alignCast(@alignOf(Ctx), ctx_.?)), ptr[0..len] }) catch return false;
+                return true;
+            }
+        };
+        return JSC__JSValue__jsonStringifyUTF8(this, globalThis, ctx, Wrapper.call, is_all_ascii);
+    }
+
     // On exception, this returns null, to make exception checks faster.
     pub fn toStringOrNull(this: JSValue, globalThis: *JSGlobalObject) ?*JSString {
         return cppFn("toStringOrNull", .{ this, globalThis });
@@ -3726,6 +3759,9 @@ pub fn untrackFunction(
 pub const WTF = struct {
     extern fn WTF__copyLCharsFromUCharSource(dest: [*]u8, source: *const anyopaque, len: usize) void;
     extern fn WTF__toBase64URLStringValue(bytes: [*]const u8, length: usize, globalObject: *JSGlobalObject) JSValue;
+    extern fn WTF__toBase64StringValue(bytes: [*]const u8, length: usize, globalObject: *JSGlobalObject) JSValue;
+    extern fn WTF__base64DecodedLength(source: *const anyopaque, length: usize, is16Bit: bool) usize;
+    extern fn WTF__base64Decode(destination: [*]u8, destination_length: usize, source: *const anyopaque, length: usize, is16Bit: bool, isURL: bool) usize;
 
     /// This uses SSE2 instructions and/or ARM NEON to copy 16-bit characters efficiently
     /// See wtf/Text/ASCIIFastPath.h for details
@@ -3738,11 +3774,38 @@ pub const WTF = struct {
 
     /// Encode a byte array to a URL-safe base64 string for use with JS
     /// Memory is managed by JavaScriptCore instead of us
+    /// Throws and returns `.zero` when the string cannot be allocated
     pub fn toBase64URLStringValue(bytes: []const u8, globalObject: *JSGlobalObject) JSValue {
         JSC.markBinding(@src());
 
         return WTF__toBase64URLStringValue(bytes.ptr, bytes.len, globalObject);
     }
+
+    /// Encode a byte array to a padded base64 string for use with JS
+    /// Memory is managed by JavaScriptCore instead of us
+    /// Throws and returns `.zero` when the string cannot be allocated
+    pub fn toBase64StringValue(bytes: []const u8, globalObject: *JSGlobalObject) JSValue {
+        JSC.markBinding(@src());
+
+        return WTF__toBase64StringValue(bytes.ptr, bytes.len, globalObject);
+    }
+
+    /// The decoded size Node.js reports for a base64 or base64url string.
+    /// Always large enough for `base64Decode`.
+    pub fn base64DecodedLength(comptime Char: type, source: []const Char) usize {
+        JSC.markBinding(@src());
+
+        return WTF__base64DecodedLength(source.ptr, source.len, Char == u16);
+    }
+
+    /// Decode base64 or base64url the way Node.js Buffer does: either
+    /// alphabet is accepted, other characters are skipped and '=' stops decoding.
+    /// Uses SIMD when available. Returns the number of bytes written.
+    pub fn base64Decode(comptime Char: type, destination: []u8, source: []const Char, is_url: bool) usize {
+        JSC.markBinding(@src());
+
+        return WTF__base64Decode(destination.ptr, destination.len, source.ptr, source.len, Char == u16, is_url);
+    }
 };
 
 pub const Callback = struct {
@@ -39,6 +39,7 @@
 #include "JavaScriptCore/ObjectConstructor.h"
 #include "JavaScriptCore/ArrayBuffer.h"
 #include "JavaScriptCore/JSArrayBuffer.h"
+#include "JSBuffer.h"
 #include "JSFFIFunction.h"
 #include "JavaScriptCore/JavaScript.h"
 #include "JavaScriptCore/JSWeakValue.h"
@@ -251,12 +252,8 @@ static void defineNapiProperty(Zig::GlobalObject* globalObject, JSC::JSObject* t
         auto setterProperty = reinterpret_cast<FFIFunction>(property.setter);
 
         if (getterProperty) {
-            JSC::JSNativeStdFunction* getterFunction = JSC::JSNativeStdFunction::create(
-                globalObject->vm(), globalObject, 0, String(), [getterProperty](JSC::JSGlobalObject* globalObject, JSC::CallFrame* callFrame) -> JSC::EncodedJSValue {
-                    JSC::MarkedArgumentBufferWithSize values;
-                    values.append(callFrame->thisValue());
-                    return getterProperty(globalObject, callFrame);
-                });
+            auto* getterFunction = Zig::JSFFIFunction::create(vm, globalObject, 0, nameStr, getterProperty);
+            getterFunction->dataPtr = dataPtr;
             getter = getterFunction;
         } else {
             JSC::JSNativeStdFunction* getterFunction = JSC::JSNativeStdFunction::create(
@@ -267,13 +264,8 @@ static void defineNapiProperty(Zig::GlobalObject* globalObject, JSC::JSObject* t
         }
 
         if (setterProperty) {
-            JSC::JSNativeStdFunction* setterFunction = JSC::JSNativeStdFunction::create(
-                globalObject->vm(), globalObject, 1, String(), [setterProperty](JSC::JSGlobalObject* globalObject, JSC::CallFrame* callFrame) -> JSC::EncodedJSValue {
-                    JSC::MarkedArgumentBufferWithSize values;
-                    values.append(callFrame->thisValue());
-                    values.append(callFrame->uncheckedArgument(0));
-                    return setterProperty(globalObject, callFrame);
-                });
+            auto* setterFunction = Zig::JSFFIFunction::create(vm, globalObject, 1, nameStr, setterProperty);
+            setterFunction->dataPtr = dataPtr;
             setter = setterFunction;
         } else {
             JSC::JSNativeStdFunction* setterFunction = JSC::JSNativeStdFunction::create(
@@ -395,6 +387,40 @@ extern "C" napi_status napi_has_own_property(napi_env env, napi_value object,
     return napi_ok;
 }
 
+// Returns the cache entry for the name, or nullptr if the name is not ASCII,
+// which is rare enough that it is not cached.
+static Zig::GlobalObject::NapiPropertyName* napiPropertyName(Zig::GlobalObject* globalObject, const char* utf8name)
+{
+    auto& entry = globalObject->napiPropertyNames[WTF::PtrHash<const char*>::hash(utf8name) % Zig::GlobalObject::napiPropertyNameCacheSize];
+    if (entry.utf8name == utf8name) {
+        // The same address may hold another name by now, like a buffer on
+        // the addon's stack, so the characters are compared too.
+        auto* impl = entry.identifier.impl();
+        unsigned length = impl->length();
+        if (LIKELY(impl->is8Bit() && !strncmp(utf8name, reinterpret_cast<const char*>(impl->characters8()), length) && !utf8name[length]))
+            return &entry;
+    }
+
+    size_t length = strlen(utf8name);
+    if (UNLIKELY(!charactersAreAllASCII(reinterpret_cast<const LChar*>(utf8name), length)))
+        return nullptr;
+
+    // Copied, since the atom table may keep the string after the addon's
+    // buffer is gone.
+    entry.utf8name = utf8name;
+    entry.identifier = JSC::Identifier::fromString(globalObject->vm(), WTF::String(reinterpret_cast<const LChar*>(utf8name), length));
+    entry.structure.clear();
+    entry.offset = invalidOffset;
+    return &entry;
+}
+
+static JSC::Identifier napiIdentifier(JSC::VM& vm, Zig::GlobalObject::NapiPropertyName* entry, const char* utf8name)
+{
+    if (LIKELY(entry))
+        return entry->identifier;
+    return JSC::Identifier::fromString(vm, WTF::String::fromUTF8(utf8name));
+}
+
 extern "C" napi_status napi_set_named_property(napi_env env, napi_value object,
     const char* utf8name,
     napi_value value)
@@ -414,8 +440,7 @@ extern "C" napi_status napi_set_named_property(napi_env env, napi_value object,
     JSC::EnsureStillAliveScope ensureAlive(jsValue);
     JSC::EnsureStillAliveScope ensureAlive2(target);
 
-    auto nameStr = WTF::String::fromUTF8(utf8name, strlen(utf8name));
-    auto name = JSC::PropertyName(JSC::Identifier::fromString(vm, WTFMove(nameStr)));
+    auto name = napiIdentifier(vm, napiPropertyName(globalObject, utf8name), utf8name);
 
     auto scope = DECLARE_CATCH_SCOPE(vm);
     target->putDirect(globalObject->vm(), name, jsValue, 0);
@@ -424,14 +449,6 @@ extern "C" napi_status napi_set_named_property(napi_env env, napi_value object,
     return napi_ok;
 }
 
-// This is more efficient than using WTF::String::FromUTF8
-// it doesn't copy the string
-// but it's only safe to use if we are not setting a property
-// because we can't guarantee the lifetime of it
-#define PROPERTY_NAME_FROM_UTF8(identifierName) \
-    size_t utf8Len = strlen(utf8name);          \
-    JSC::PropertyName identifierName = LIKELY(charactersAreAllASCII(reinterpret_cast<const LChar*>(utf8name), utf8Len)) ? JSC::PropertyName(JSC::Identifier::fromString(vm, WTF::String(WTF::StringImpl::createWithoutCopying(utf8name, utf8Len)))) : JSC::PropertyName(JSC::Identifier::fromString(vm, WTF::String::fromUTF8(utf8name)));
-
 extern "C" napi_status napi_has_named_property(napi_env env, napi_value object,
     const char* utf8name,
     bool* result)
@@ -441,11 +458,21 @@ extern "C" napi_status napi_has_named_property(napi_env env, napi_value object,
     auto& vm = globalObject->vm();
 
     auto* target = toJS(object).getObject();
-    if (UNLIKELY(!target)) {
+    if (!target) {
         return napi_object_expected;
     }
 
-    PROPERTY_NAME_FROM_UTF8(name);
+    if (UNLIKELY(!utf8name)) {
+        return napi_invalid_arg;
+    }
+
+    auto* entry = napiPropertyName(globalObject, utf8name);
+    if (entry && entry->structure && entry->structure.get() == target->structure()) {
+        *result = true;
+        return napi_ok;
+    }
+
+    auto name = napiIdentifier(vm, entry, utf8name);
 
     auto scope = DECLARE_CATCH_SCOPE(vm);
     *result = !!target->getIfPropertyExists(globalObject, name);
@@ -463,14 +490,48 @@ extern "C" napi_status napi_get_named_property(napi_env env, napi_value object,
     auto& vm = globalObject->vm();
 
     auto* target = toJS(object).getObject();
-    if (UNLIKELY(!target)) {
+    if (!target) {
         return napi_object_expected;
     }
 
-    PROPERTY_NAME_FROM_UTF8(name);
+    if (UNLIKELY(!utf8name)) {
+        return napi_invalid_arg;
+    }
+
+    auto* entry = napiPropertyName(globalObject, utf8name);
+    Structure* structure = target->structure();
+    if (entry && entry->structure && entry->structure.get() == structure) {
+        *result = toNapi(target->getDirect(entry->offset));
+        return napi_ok;
+    }
+
+    auto name = napiIdentifier(vm, entry, utf8name);
 
     auto scope = DECLARE_CATCH_SCOPE(vm);
-    *result = toNapi(target->getIfPropertyExists(globalObject, name));
+    if (UNLIKELY(target->type() == ProxyObjectType)) {
+        *result = toNapi(target->getIfPropertyExists(globalObject, name));
+        RETURN_IF_EXCEPTION(scope, napi_generic_failure);
+        return napi_ok;
+    }
+
+    // What getIfPropertyExists() does, keeping the slot to cache from.
+    PropertySlot slot(target, PropertySlot::InternalMethodType::Get);
+    bool hasProperty = target->getPropertySlot(globalObject, name, slot);
+    RETURN_IF_EXCEPTION(scope, napi_generic_failure);
+    if (!hasProperty) {
+        *result = toNapi(JSC::JSValue());
+        return napi_ok;
+    }
+
+    // Only an own data property of an object whose shape changes whenever
+    // its properties do can be read again by offset.
+    if (entry && slot.isCacheableValue() && slot.slotBase() == target && target->structure() == structure
+        && !structure->isDictionary() && !structure->typeInfo().overridesGetOwnPropertySlot()) {
+        entry->structure = JSC::Weak<JSC::Structure>(structure);
+        entry->offset = slot.cachedOffset();
+    }
+
+    *result = toNapi(slot.getValue(globalObject, name));
     RETURN_IF_EXCEPTION(scope, napi_generic_failure);
 
     scope.clearException();
@@ -686,7 +747,6 @@ extern "C" napi_status napi_get_cb_info(
 
         // If the user didn't provide expected number of args, we need to fill the rest with undefined.
         // TODO: can we use memset() here?
-        auto argv_ptr = argv[outputArgsCount];
         for (size_t i = outputArgsCount; i < inputArgsCount; i++) {
             argv[i] = reinterpret_cast<napi_value>(JSC::JSValue::encode(JSC::jsUndefined()));
         }
@@ -699,17 +759,15 @@ extern "C" napi_status napi_get_cb_info(
     }
 
     if (data != nullptr) {
-        JSC::JSValue callee = JSC::JSValue(callFrame->jsCallee());
-        if (Zig::JSFFIFunction* ffiFunction = JSC::jsDynamicCast<Zig::JSFFIFunction*>(callee)) {
-            *data = reinterpret_cast<void*>(ffiFunction->dataPtr);
-        } else if (auto* proto = JSC::jsDynamicCast<NapiPrototype*>(callee)) {
-            *data = proto->napiRef ? proto->napiRef->data : nullptr;
-        } else if (auto* proto = JSC::jsDynamicCast<NapiClass*>(callee)) {
-            *data = proto->dataPtr;
-        } else if (auto* proto = JSC::jsDynamicCast<NapiPrototype*>(thisValue)) {
-            *data = proto->napiRef ? proto->napiRef->data : nullptr;
-        } else if (auto* proto = JSC::jsDynamicCast<NapiClass*>(thisValue)) {
-            *data = proto->dataPtr;
+        // Every napi callback is either a JSFFIFunction (functions, methods,
+        // getters and setters) or the NapiClass being constructed. Both
+        // classes are final, so each check is a single ClassInfo comparison.
+        JSC::JSObject* callee = callFrame->jsCallee();
+        const JSC::ClassInfo* classInfo = callee->classInfo();
+        if (classInfo == Zig::JSFFIFunction::info()) {
+            *data = static_cast<Zig::JSFFIFunction*>(callee)->dataPtr;
+        } else if (classInfo == NapiClass::info()) {
+            *data = static_cast<NapiClass*>(callee)->dataPtr;
         } else {
             *data = nullptr;
         }
@@ -938,10 +996,144 @@ extern "C" napi_status napi_adjust_external_memory(napi_env env,
     int64_t change_in_bytes,
     int64_t* adjusted_value)
 {
+    auto* globalObject = toJS(env);
+    if (UNLIKELY(!adjusted_value)) {
+        return napi_invalid_arg;
+    }
+
+    // The GC is only told about memory being allocated. It finds out about
+    // memory being freed on the next collection.
     if (change_in_bytes > 0) {
-        toJS(env)->vm().heap.deprecatedReportExtraMemory(change_in_bytes);
+        globalObject->vm().heap.deprecatedReportExtraMemory(change_in_bytes);
+    }
+    globalObject->napiExternalMemorySize = std::max<int64_t>(globalObject->napiExternalMemorySize + change_in_bytes, 0);
+    *adjusted_value = globalObject->napiExternalMemorySize;
+    return napi_ok;
+}
+
+// The backing stores of array buffers and buffers made here are counted by
+// the GC like those made in JS, so they are not reported as external memory
+// on top of that.
+
+extern "C" napi_status napi_create_arraybuffer(napi_env env,
+    size_t byte_length, void** data,
+    napi_value* result)
+{
+    auto* globalObject = toJS(env);
+    auto& vm = globalObject->vm();
+    if (UNLIKELY(!result)) {
+        return napi_invalid_arg;
+    }
+
+    // Zero-filled, since the addon may read it before writing all of it.
+    auto arrayBuffer = JSC::ArrayBuffer::tryCreate(byte_length, 1);
+    if (UNLIKELY(!arrayBuffer)) {
+        return napi_generic_failure;
+    }
+
+    if (data) {
+        *data = arrayBuffer->data();
     }
-    *adjusted_value = toJS(env)->vm().heap.extraMemorySize();
+
+    auto scope = DECLARE_CATCH_SCOPE(vm);
+    auto* jsArrayBuffer = JSC::JSArrayBuffer::create(vm, globalObject->arrayBufferStructure(JSC::ArrayBufferSharingMode::Default), WTFMove(arrayBuffer));
+    RETURN_IF_EXCEPTION(scope, napi_generic_failure);
+    *result = toNapi(jsArrayBuffer);
+    return napi_ok;
+}
+
+static JSC::JSUint8Array* createNapiBuffer(Zig::GlobalObject* globalObject, RefPtr<JSC::ArrayBuffer>&& arrayBuffer, size_t length)
+{
+    auto* structure = globalObject->typedArrayStructure(JSC::TypeUint8, false);
+    auto* uint8Array = JSC::JSUint8Array::create(globalObject, structure, WTFMove(arrayBuffer), 0, length);
+    if (LIKELY(uint8Array)) {
+        toBuffer(globalObject, uint8Array);
+    }
+    return uint8Array;
+}
+
+extern "C" napi_status napi_create_buffer(napi_env env, size_t length,
+    void** data, napi_value* result)
+{
+    auto* globalObject = toJS(env);
+    auto& vm = globalObject->vm();
+    if (UNLIKELY(!result)) {
+        return napi_invalid_arg;
+    }
+
+    // Left uninitialized like Buffer.allocUnsafe(), which is what Node does
+    // here too; the addon is about to write its data into it.
+    auto arrayBuffer = JSC::ArrayBuffer::tryCreateUninitialized(length, 1);
+    if (UNLIKELY(!arrayBuffer)) {
+        return napi_generic_failure;
+    }
+
+    if (data) {
+        *data = arrayBuffer->data();
+    }
+
+    auto scope = DECLARE_CATCH_SCOPE(vm);
+    auto* buffer = createNapiBuffer(globalObject, WTFMove(arrayBuffer), length);
+    RETURN_IF_EXCEPTION(scope, napi_generic_failure);
+    *result = toNapi(buffer);
+    return napi_ok;
+}
+
+extern "C" napi_status napi_create_buffer_copy(napi_env env, size_t length,
+    const void* data, void** result_data,
+    napi_value* result)
+{
+    auto* globalObject = toJS(env);
+    auto& vm = globalObject->vm();
+    if (UNLIKELY(!result || (!data && length))) {
+        return napi_invalid_arg;
+    }
+
+    // Every byte is copied over, so there is nothing to zero first.
+    auto arrayBuffer = JSC::ArrayBuffer::tryCreateUninitialized(length, 1);
+    if (UNLIKELY(!arrayBuffer)) {
+        return napi_generic_failure;
+    }
+
+    if (length) {
+        memcpy(arrayBuffer->data(), data, length);
+    }
+
+    if (result_data) {
+        *result_data = arrayBuffer->data();
+    }
+
+    auto scope = DECLARE_CATCH_SCOPE(vm);
+    auto* buffer = createNapiBuffer(globalObject, WTFMove(arrayBuffer), length);
+    RETURN_IF_EXCEPTION(scope, napi_generic_failure);
+    *result = toNapi(buffer);
+    return napi_ok;
+}
+
+extern "C" napi_status napi_create_external_buffer(napi_env env, size_t length,
+    void* data,
+    napi_finalize finalize_cb,
+    void* finalize_hint,
+    napi_value* result)
+{
+    auto* globalObject = toJS(env);
+    auto& vm = globalObject->vm();
+    if (UNLIKELY(!result || (!data && length))) {
+        return napi_invalid_arg;
+    }
+
+    // The addon's memory is used as is, and handed back to it when the
+    // buffer is collected.
+    auto arrayBuffer = JSC::ArrayBuffer::createFromBytes(data, length, createSharedTask<void(void*)>([env, finalize_cb, finalize_hint](void* bytes) {
+        if (finalize_cb) {
+            finalize_cb(env, bytes, finalize_hint);
+        }
+    }));
+
+    auto scope = DECLARE_CATCH_SCOPE(vm);
+    auto* buffer = createNapiBuffer(globalObject, WTFMove(arrayBuffer), length);
+    RETURN_IF_EXCEPTION(scope, napi_generic_failure);
+    *result = toNapi(buffer);
     return napi_ok;
 }
 
@@ -1139,6 +1331,7 @@ void NapiClass::visitChildrenImpl(JSCell* cell, Visitor& visitor)
     NapiClass* thisObject = jsCast<NapiClass*>(cell);
     ASSERT_GC_OBJECT_INHERITS(thisObject, info());
     Base::visitChildren(thisObject, visitor);
+    visitor.append(thisObject->m_instanceStructure);
 }
 
 DEFINE_VISIT_CHILDREN(NapiClass);
@@ -1151,19 +1344,22 @@ static JSC_DEFINE_HOST_FUNCTION(NapiClass_ConstructorFunction,
     JSC::VM& vm = globalObject->vm();
     auto scope = DECLARE_THROW_SCOPE(vm);
 
-    JSObject* newTarget = asObject(callFrame->newTarget());
-
-    NapiClass* napi = jsDynamicCast<NapiClass*>(newTarget);
-    if (UNLIKELY(!napi)) {
+    NapiClass* napi = jsDynamicCast<NapiClass*>(callFrame->jsCallee());
+    if (UNLIKELY(!napi || !callFrame->newTarget().isObject())) {
         JSC::throwVMError(globalObject, scope, JSC::createTypeError(globalObject, "NapiClass constructor called on an object that is not a NapiClass"_s));
         return JSC::JSValue::encode(JSC::jsUndefined());
     }
 
-    NapiPrototype* prototype = JSC::jsDynamicCast<NapiPrototype*>(napi->getDirect(vm, vm.propertyNames->prototype));
-
-    RETURN_IF_EXCEPTION(scope, {});
+    JSObject* newTarget = asObject(callFrame->newTarget());
+    Structure* structure = napi->instanceStructure();
+    if (UNLIKELY(newTarget != napi)) {
+        // A JavaScript subclass calling super(); the structure is cached on
+        // the subclass.
+        structure = InternalFunction::createSubclassStructure(globalObject, newTarget, structure);
+        RETURN_IF_EXCEPTION(scope, {});
+    }
 
-    callFrame->setThisValue(prototype->subclass(newTarget));
+    callFrame->setThisValue(NapiPrototype::create(vm, globalObject, structure));
     napi->constructor()(globalObject, callFrame);
     size_t count = callFrame->argumentCount();
 
@@ -1287,6 +1483,8 @@ void NapiClass::finishCreation(VM& vm, NativeExecutable* executable, unsigned le
 
     this->putDirect(vm, vm.propertyNames->prototype, prototype, JSC::PropertyAttribute::DontEnum | 0);
     prototype->putDirect(vm, vm.propertyNames->constructor, this, JSC::PropertyAttribute::DontEnum | 0);
+
+    m_instanceStructure.set(vm, this, NapiPrototype::createStructure(vm, globalObject, prototype));
 }
 }
 
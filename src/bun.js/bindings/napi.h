@@ -162,8 +162,14 @@ public:
         return m_constructor;
     }
 
+    // Shared by every instance constructed with this class as new.target.
+    // Created once the prototype has all of its properties, so instances
+    // never transition before the constructor callback adds to them.
+    JSC::Structure* instanceStructure() const { return m_instanceStructure.get(); }
+
     void* dataPtr = nullptr;
     FFIFunction m_constructor = nullptr;
+    JSC::WriteBarrier<JSC::Structure> m_instanceStructure;
 
 private:
     NapiClass(VM& vm, NativeExecutable* executable, JSC::JSGlobalObject* global, Structure* structure)
@@ -178,17 +184,26 @@ private:
     DECLARE_VISIT_CHILDREN;
 };
 
-class NapiPrototype : public JSC::JSDestructibleObject {
+// Instances of classes made by napi_define_class. They are allocated in their
+// own IsoSubspace, and since the class is final, telling one apart in
+// napi_wrap/napi_unwrap is a single ClassInfo comparison.
+class NapiPrototype final : public JSC::JSDestructibleObject {
 public:
     using Base = JSC::JSDestructibleObject;
 
     static constexpr unsigned StructureFlags = Base::StructureFlags;
     static constexpr bool needsDestruction = true;
 
-    template<typename CellType, SubspaceAccess>
-    static CompleteSubspace* subspaceFor(VM& vm)
+    template<typename, SubspaceAccess mode> static JSC::GCClient::IsoSubspace* subspaceFor(JSC::VM& vm)
     {
-        return &vm.destructibleObjectSpace();
+        if constexpr (mode == JSC::SubspaceAccess::Concurrently)
+            return nullptr;
+        return WebCore::subspaceForImpl<NapiPrototype, WebCore::UseCustomHeapCellType::No>(
+            vm,
+            [](auto& spaces) { return spaces.m_clientSubspaceForNapiPrototype.get(); },
+            [](auto& spaces, auto&& space) { spaces.m_clientSubspaceForNapiPrototype = WTFMove(space); },
+            [](auto& spaces) { return spaces.m_subspaceForNapiPrototype.get(); },
+            [](auto& spaces, auto&& space) { spaces.m_subspaceForNapiPrototype = WTFMove(space); });
     }
 
     DECLARE_INFO;
@@ -212,17 +227,6 @@ public:
         return Structure::create(vm, globalObject, prototype, TypeInfo(ObjectType, StructureFlags), info());
     }
 
-    NapiPrototype* subclass(JSC::JSObject* newTarget)
-    {
-        auto& vm = this->vm();
-        auto* structure = InternalFunction::createSubclassStructure(globalObject(),
-            newTarget,
-            this->structure());
-        NapiPrototype* footprint = new (NotNull, allocateCell<NapiPrototype>(vm)) NapiPrototype(vm, structure);
-        footprint->finishCreation(vm);
-        return footprint;
-    }
-
     NapiRef* napiRef = nullptr;
 
 private:
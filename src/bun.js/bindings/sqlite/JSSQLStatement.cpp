@@ -110,6 +110,10 @@ static JSC_DECLARE_HOST_FUNCTION(jsSQLStatementDeserialize);
 namespace WebCore {
 using namespace JSC;
 
+// Reads one cell of the current row as the storage class its column was
+// profiled with, or returns the empty JSValue when the cell holds another.
+using ColumnReader = JSC::JSValue (*)(JSC::JSGlobalObject*, sqlite3_stmt*, int);
+
 class JSSQLStatement : public JSC::JSNonFinalObject {
 public:
     using Base = JSC::JSNonFinalObject;
@@ -146,10 +150,17 @@ public:
     ~JSSQLStatement();
 
     sqlite3_stmt* stmt;
-    VersionSqlite3* version_db;
+    RefPtr<VersionSqlite3> version_db;
     uint64_t version;
     bool hasExecuted = false;
     std::unique_ptr<PropertyNameArray> columnNames;
+    // The storage class each column has held so far, seeded from its declared
+    // type: 0 until one is known, genericColumnType once a column has held
+    // two different ones besides NULL. Once every column has one, the rows
+    // are read through columnReaders instead.
+    Vector<int8_t> columnTypes;
+    Vector<ColumnReader> columnReaders;
+    bool isColumnTypeProfileGeneric = false;
     mutable WriteBarrier<JSC::JSObject> _prototype;
     mutable WriteBarrier<JSC::Structure> _structure;
 
@@ -167,6 +178,27 @@ protected:
     void finishCreation(JSC::VM&);
 };
 
+static constexpr int8_t genericColumnType = -1;
+
+// The storage class a column with this declared type is expected to hold,
+// following SQLite's rules for column affinity:
+// https://www.sqlite.org/datatype3.html#determination_of_column_affinity
+// NUMERIC affinity can hold either kind of number, so it is left unknown.
+static int8_t expectedColumnType(const char* declaredType)
+{
+    if (declaredType == nullptr)
+        return 0;
+    if (strcasestr(declaredType, "INT"))
+        return SQLITE_INTEGER;
+    if (strcasestr(declaredType, "CHAR") || strcasestr(declaredType, "CLOB") || strcasestr(declaredType, "TEXT"))
+        return SQLITE3_TEXT;
+    if (strcasestr(declaredType, "BLOB"))
+        return SQLITE_BLOB;
+    if (strcasestr(declaredType, "REAL") || strcasestr(declaredType, "FLOA") || strcasestr(declaredType, "DOUB"))
+        return SQLITE_FLOAT;
+    return 0;
+}
+
 static void initializeColumnNames(JSC::JSGlobalObject* lexicalGlobalObject, JSSQLStatement* castedThis)
 {
     if (!castedThis->hasExecuted) {
@@ -188,6 +220,12 @@ static void initializeColumnNames(JSC::JSGlobalObject* lexicalGlobalObject, JSSQ
     castedThis->_prototype.clear();
 
     int count = sqlite3_column_count(stmt);
+    castedThis->columnReaders.clear();
+    castedThis->isColumnTypeProfileGeneric = false;
+    castedThis->columnTypes.resize(count);
+    for (int i = 0; i < count; i++)
+        castedThis->columnTypes[i] = expectedColumnType(sqlite3_column_decltype(stmt, i));
+
     if (count == 0)
         return;
 
@@ -262,19 +300,33 @@ static void initializeColumnNames(JSC::JSGlobalObject* lexicalGlobalObject, JSSQ
     }
 }
 
+// After close(), SQLite keeps the connection around until its last statement
+// is finalized, and only then stops reading a deserialized buffer.
+static void finalizeStatement(sqlite3_stmt* stmt, VersionSqlite3* version_db)
+{
+    bool closesConnection = false;
+    if (stmt && version_db && !version_db->db && version_db->buffer) {
+        sqlite3* db = sqlite3_db_handle(stmt);
+        closesConnection = sqlite3_next_stmt(db, nullptr) == stmt && !sqlite3_next_stmt(db, stmt);
+    }
+
+    sqlite3_finalize(stmt);
+    if (closesConnection)
+        version_db->releaseBuffer();
+}
+
 void JSSQLStatement::destroy(JSC::JSCell* cell)
 {
     JSSQLStatement* thisObject = static_cast<JSSQLStatement*>(cell);
-    sqlite3_finalize(thisObject->stmt);
+    finalizeStatement(thisObject->stmt, thisObject->version_db.get());
     thisObject->stmt = nullptr;
+    thisObject->version_db = nullptr;
 }
 
 void JSSQLStatementConstructor::destroy(JSC::JSCell* cell)
 {
     JSSQLStatementConstructor* thisObject = static_cast<JSSQLStatementConstructor*>(cell);
-    for (auto version_db : thisObject->databases) {
-        delete version_db;
-    }
+    thisObject->databases.clear();
 }
 
 static inline bool rebindValue(JSC::JSGlobalObject* lexicalGlobalObject, sqlite3_stmt* stmt, int i, JSC::JSValue value, JSC::ThrowScope& scope, bool clone)
@@ -472,12 +524,8 @@ JSC_DEFINE_HOST_FUNCTION(jsSQLStatementDeserialize, (JSC::JSGlobalObject * lexic
     JSValue thisValue = callFrame->thisValue();
     JSSQLStatementConstructor* thisObject = jsDynamicCast<JSSQLStatementConstructor*>(thisValue.getObject());
     JSC::JSArrayBufferView* array = jsDynamicCast<JSC::JSArrayBufferView*>(callFrame->argument(0));
-    unsigned int flags = SQLITE_DESERIALIZE_FREEONCLOSE | SQLITE_DESERIALIZE_RESIZEABLE;
     JSC::EnsureStillAliveScope ensureAliveArray(array);
-
-    if (callFrame->argumentCount() > 1 and callFrame->argument(1).toBoolean(lexicalGlobalObject)) {
-        flags |= SQLITE_DESERIALIZE_READONLY;
-    }
+    bool isReadOnly = callFrame->argumentCount() > 1 && callFrame->argument(1).toBoolean(lexicalGlobalObject);
 
     if (UNLIKELY(!thisObject)) {
         throwException(lexicalGlobalObject, scope, createError(lexicalGlobalObject, "Expected SQL"_s));
@@ -507,19 +555,29 @@ JSC_DEFINE_HOST_FUNCTION(jsSQLStatementDeserialize, (JSC::JSGlobalObject * lexic
     }
 #endif
 
+    // A read-only database is read straight out of the caller's memory, which
+    // stays alive and attached until the connection closes. This has to come
+    // before vector(), since it can move the contents of a small typed array
+    // out of the GC heap.
+    RefPtr<JSC::ArrayBuffer> buffer = isReadOnly ? array->possiblySharedBuffer() : nullptr;
+
     size_t byteLength = array->byteLength();
     void* ptr = array->vector();
     if (UNLIKELY(ptr == nullptr || byteLength == 0)) {
         throwException(lexicalGlobalObject, scope, createError(lexicalGlobalObject, "ArrayBuffer must not be empty"_s));
         return JSValue::encode(JSC::jsUndefined());
     }
-    void* data = sqlite3_malloc64(byteLength);
-    if (UNLIKELY(data == nullptr)) {
-        throwException(lexicalGlobalObject, scope, createError(lexicalGlobalObject, "Failed to allocate memory"_s));
-        return JSValue::encode(JSC::jsUndefined());
-    }
-    if (byteLength) {
+
+    void* data = ptr;
+    unsigned int flags = SQLITE_DESERIALIZE_READONLY;
+    if (!isReadOnly) {
+        data = sqlite3_malloc64(byteLength);
+        if (UNLIKELY(data == nullptr)) {
+            throwException(lexicalGlobalObject, scope, createError(lexicalGlobalObject, "Failed to allocate memory"_s));
+            return JSValue::encode(JSC::jsUndefined());
+        }
         memcpy(data, ptr, byteLength);
+        flags = SQLITE_DESERIALIZE_FREEONCLOSE | SQLITE_DESERIALIZE_RESIZEABLE;
     }
 
     sqlite3* db = nullptr;
@@ -535,19 +593,21 @@ JSC_DEFINE_HOST_FUNCTION(jsSQLStatementDeserialize, (JSC::JSGlobalObject * lexic
 
     status = sqlite3_deserialize(db, "main", reinterpret_cast<unsigned char*>(data), byteLength, byteLength, flags);
     if (status == SQLITE_BUSY) {
-        sqlite3_free(data);
+        if (!isReadOnly)
+            sqlite3_free(data);
         throwException(lexicalGlobalObject, scope, createError(lexicalGlobalObject, "SQLITE_BUSY"_s));
         return JSValue::encode(JSC::jsUndefined());
     }
 
     if (status != SQLITE_OK) {
-        sqlite3_free(data);
+        if (!isReadOnly)
+            sqlite3_free(data);
         throwException(lexicalGlobalObject, scope, createError(lexicalGlobalObject, status == SQLITE_ERROR ? "unable to deserialize database"_s : sqliteString(sqlite3_errstr(status))));
         return JSValue::encode(JSC::jsUndefined());
     }
 
     auto count = thisObject->databases.size();
-    thisObject->databases.append(new VersionSqlite3(db));
+    thisObject->databases.append(buffer ? VersionSqlite3::create(db, WTFMove(buffer)) : VersionSqlite3::create(db));
     RELEASE_AND_RETURN(scope, JSValue::encode(jsNumber(count)));
 }
 
@@ -845,7 +905,7 @@ JSC_DEFINE_HOST_FUNCTION(jsSQLStatementPrepareStatementFunction, (JSC::JSGlobalO
     auto* structure = JSSQLStatement::createStructure(vm, lexicalGlobalObject, lexicalGlobalObject->objectPrototype());
     // auto* structure = JSSQLStatement::createStructure(vm, globalObject(), thisObject->getDirect(vm, vm.propertyNames->prototype));
     JSSQLStatement* sqlStatement = JSSQLStatement::create(
-        structure, reinterpret_cast<Zig::GlobalObject*>(lexicalGlobalObject), statement, thisObject->databases[handle]);
+        structure, reinterpret_cast<Zig::GlobalObject*>(lexicalGlobalObject), statement, thisObject->databases[handle].get());
     if (bindings.isObject()) {
         auto* castedThis = sqlStatement;
         DO_REBIND(bindings)
@@ -921,8 +981,24 @@ JSC_DEFINE_HOST_FUNCTION(jsSQLStatementOpenStatementFunction, (JSC::JSGlobalObje
     status = sqlite3_db_config(db, SQLITE_DBCONFIG_DEFENSIVE, 1, NULL);
     assert(status == SQLITE_OK);
 
+    if (callFrame->argument(2).toBoolean(lexicalGlobalObject)) {
+        // Let SQLite read pages out of a memory map of the whole file rather
+        // than copying them into its page cache. A database that can be
+        // written gets room to double in size before it falls back to read().
+        // SQLite clamps this to its compile-time maximum.
+        sqlite3_file* file = nullptr;
+        sqlite3_int64 fileSize = 0;
+        if (sqlite3_file_control(db, "main", SQLITE_FCNTL_FILE_POINTER, &file) == SQLITE_OK && file && file->pMethods
+            && file->pMethods->xFileSize(file, &fileSize) == SQLITE_OK && fileSize > 0) {
+            sqlite3_int64 mmapSize = openFlags & SQLITE_OPEN_READONLY ? fileSize : fileSize * 2;
+            char pragma[64];
+            snprintf(pragma, sizeof(pragma), "PRAGMA mmap_size = %lld", static_cast<long long>(mmapSize));
+            sqlite3_exec(db, pragma, nullptr, nullptr, nullptr);
+        }
+    }
+
     auto count = constructor->databases.size();
-    constructor->databases.append(new VersionSqlite3(db));
+    constructor->databases.append(VersionSqlite3::create(db));
     RELEASE_AND_RETURN(scope, JSValue::encode(jsNumber(count)));
 }
 
@@ -964,6 +1040,9 @@ JSC_DEFINE_HOST_FUNCTION(jsSQLStatementCloseStatementFunction, (JSC::JSGlobalObj
         return JSValue::encode(jsUndefined());
     }
 
+    // With statements left to finalize, sqlite3_close_v2() only closes the
+    // connection once they are, so a deserialized buffer has to outlive it.
+    bool closesNow = !sqlite3_next_stmt(db, nullptr);
     int statusCode = sqlite3_close_v2(db);
     if (statusCode != SQLITE_OK) {
         throwException(lexicalGlobalObject, scope, createError(lexicalGlobalObject, WTF::String::fromUTF8(sqlite3_errmsg(db))));
@@ -971,12 +1050,14 @@ JSC_DEFINE_HOST_FUNCTION(jsSQLStatementCloseStatementFunction, (JSC::JSGlobalObj
     }
 
     constructor->databases[dbIndex]->db = nullptr;
+    if (closesNow)
+        constructor->databases[dbIndex]->releaseBuffer();
     return JSValue::encode(jsUndefined());
 }
 
 /* Hash table for constructor */
 static const HashTableValue JSSQLStatementConstructorTableValues[] = {
-    { "open"_s, static_cast<unsigned>(JSC::PropertyAttribute::Function), NoIntrinsic, { HashTableValue::NativeFunctionType, jsSQLStatementOpenStatementFunction, 2 } },
+    { "open"_s, static_cast<unsigned>(JSC::PropertyAttribute::Function), NoIntrinsic, { HashTableValue::NativeFunctionType, jsSQLStatementOpenStatementFunction, 3 } },
     { "close"_s, static_cast<unsigned>(JSC::PropertyAttribute::Function), NoIntrinsic, { HashTableValue::NativeFunctionType, jsSQLStatementCloseStatementFunction, 1 } },
     { "prepare"_s, static_cast<unsigned>(JSC::PropertyAttribute::Function), NoIntrinsic, { HashTableValue::NativeFunctionType, jsSQLStatementPrepareStatementFunction, 2 } },
     { "run"_s, static_cast<unsigned>(JSC::PropertyAttribute::Function), NoIntrinsic, { HashTableValue::NativeFunctionType, jsSQLStatementExecuteFunction, 3 } },
@@ -1000,6 +1081,138 @@ void JSSQLStatementConstructor::finishCreation(VM& vm)
     JSC_TO_STRING_TAG_WITHOUT_TRANSITION();
 }
 
+// Reads one cell of the current row, whose storage class is type.
+// sqlite3_column_text() comes before sqlite3_column_bytes(), as SQLite
+// recommends, so the length is that of the converted text.
+static ALWAYS_INLINE JSC::JSValue materializeColumn(JSC::JSGlobalObject* lexicalGlobalObject, sqlite3_stmt* stmt, int i, int type)
+{
+    auto& vm = lexicalGlobalObject->vm();
+
+    switch (type) {
+    case SQLITE_INTEGER: {
+        // https://github.com/oven-sh/bun/issues/1536
+        return jsNumber(sqlite3_column_int64(stmt, i));
+    }
+    case SQLITE_FLOAT: {
+        return jsNumber(sqlite3_column_double(stmt, i));
+    }
+    // > Note that the SQLITE_TEXT constant was also used in SQLite version
+    // > 2 for a completely different meaning. Software that links against
+    // > both SQLite version 2 and SQLite version 3 should use SQLITE3_TEXT,
+    // > not SQLITE_TEXT.
+    case SQLITE3_TEXT: {
+        const unsigned char* text = sqlite3_column_text(stmt, i);
+        size_t len = sqlite3_column_bytes(stmt, i);
+        if (UNLIKELY(text == nullptr || len == 0)) {
+            return jsEmptyString(vm);
+        }
+
+        if (len > 64) {
+            return JSC::JSValue::decode(Bun__encoding__toStringUTF8(text, len, lexicalGlobalObject));
+        }
+
+        return jsString(vm, WTF::String::fromUTF8(text, len));
+    }
+    case SQLITE_BLOB: {
+        const void* blob = sqlite3_column_blob(stmt, i);
+        size_t len = sqlite3_column_bytes(stmt, i);
+        JSC::JSUint8Array* array = JSC::JSUint8Array::createUninitialized(lexicalGlobalObject, lexicalGlobalObject->m_typedArrayUint8.get(lexicalGlobalObject), len);
+        if (len > 0)
+            memcpy(array->vector(), blob, len);
+        return array;
+    }
+    default: {
+        return jsNull();
+    }
+    }
+}
+
+template<int type>
+static JSC::JSValue readProfiledColumn(JSC::JSGlobalObject* lexicalGlobalObject, sqlite3_stmt* stmt, int i)
+{
+    int actualType = sqlite3_column_type(stmt, i);
+    // type is a constant here, so the switch in materializeColumn folds away.
+    if (LIKELY(actualType == type))
+        return materializeColumn(lexicalGlobalObject, stmt, i, type);
+    if (actualType == SQLITE_NULL)
+        return jsNull();
+    return JSC::JSValue();
+}
+
+static ColumnReader columnReaderFor(int8_t type)
+{
+    switch (type) {
+    case SQLITE_INTEGER:
+        return readProfiledColumn<SQLITE_INTEGER>;
+    case SQLITE_FLOAT:
+        return readProfiledColumn<SQLITE_FLOAT>;
+    case SQLITE3_TEXT:
+        return readProfiledColumn<SQLITE3_TEXT>;
+    case SQLITE_BLOB:
+        return readProfiledColumn<SQLITE_BLOB>;
+    default:
+        return nullptr;
+    }
+}
+
+// Reads the cells of the current row and passes each to store(i, value).
+//
+// SQLite values are dynamically typed, but a statement's columns almost
+// always hold the same storage class row after row. Until every column has
+// one, the generic loop switches on the storage class of each cell and
+// records it in columnTypes. Then the rows go through one reader per column
+// specialized for its storage class, which only checks that the cell still
+// holds it. A cell holding another one marks its column generic, and the
+// statement goes back to the generic loop for good.
+template<typename StoreFunction>
+static ALWAYS_INLINE void materializeRow(JSC::JSGlobalObject* lexicalGlobalObject, JSSQLStatement* castedThis, int count, const StoreFunction& store)
+{
+    auto* stmt = castedThis->stmt;
+    int i = 0;
+
+    if (castedThis->columnReaders.size() == static_cast<size_t>(count)) {
+        const ColumnReader* readers = castedThis->columnReaders.data();
+        for (; i < count; i++) {
+            JSC::JSValue value = readers[i](lexicalGlobalObject, stmt, i);
+            if (UNLIKELY(value.isEmpty()))
+                break;
+            store(i, value);
+        }
+        if (LIKELY(i == count))
+            return;
+
+        castedThis->columnTypes[i] = genericColumnType;
+        castedThis->columnReaders.clear();
+        castedThis->isColumnTypeProfileGeneric = true;
+    }
+
+    if (castedThis->isColumnTypeProfileGeneric) {
+        for (; i < count; i++)
+            store(i, materializeColumn(lexicalGlobalObject, stmt, i, sqlite3_column_type(stmt, i)));
+        return;
+    }
+
+    int8_t* columnTypes = castedThis->columnTypes.data();
+    bool isComplete = true;
+    for (; i < count; i++) {
+        int type = sqlite3_column_type(stmt, i);
+        store(i, materializeColumn(lexicalGlobalObject, stmt, i, type));
+
+        int8_t& profile = columnTypes[i];
+        if (type != SQLITE_NULL && type != profile)
+            profile = profile ? genericColumnType : type;
+        if (profile == genericColumnType)
+            castedThis->isColumnTypeProfileGeneric = true;
+        isComplete &= profile > 0;
+    }
+
+    if (isComplete && !castedThis->isColumnTypeProfileGeneric) {
+        castedThis->columnReaders.reserveInitialCapacity(count);
+        for (int column = 0; column < count; column++)
+            castedThis->columnReaders.uncheckedAppend(columnReaderFor(columnTypes[column]));
+    }
+}
+
 static inline JSC::JSValue constructResultObject(JSC::JSGlobalObject* lexicalGlobalObject, JSSQLStatement* castedThis);
 static inline JSC::JSValue constructResultObject(JSC::JSGlobalObject* lexicalGlobalObject, JSSQLStatement* castedThis)
 {
@@ -1011,54 +1224,13 @@ static inline JSC::JSValue constructResultObject(JSC::JSGlobalObject* lexicalGlo
     // see https://github.com/oven-sh/bun/issues/987
     JSC::JSObject* result;
 
-    auto* stmt = castedThis->stmt;
-
     if (auto* structure = castedThis->_structure.get()) {
         RELEASE_ASSERT(count <= 64);
         result = JSC::constructEmptyObject(vm, structure);
 
-        for (int i = 0; i < count; i++) {
-
-            switch (sqlite3_column_type(stmt, i)) {
-            case SQLITE_INTEGER: {
-                // https://github.com/oven-sh/bun/issues/1536
-                result->putDirectOffset(vm, i, jsNumber(sqlite3_column_int64(stmt, i)));
-                break;
-            }
-            case SQLITE_FLOAT: {
-                result->putDirectOffset(vm, i, jsNumber(sqlite3_column_double(stmt, i)));
-                break;
-            }
-            // > Note that the SQLITE_TEXT constant was also used in SQLite version
-            // > 2 for a completely different meaning. Software that links against
-            // > both SQLite version 2 and SQLite version 3 should use SQLITE3_TEXT,
-            // > not SQLITE_TEXT.
-            case SQLITE3_TEXT: {
-                size_t len = sqlite3_column_bytes(stmt, i);
-                const unsigned char* text = len > 0 ? sqlite3_column_text(stmt, i) : nullptr;
-
-                if (len > 64) {
-                    result->putDirectOffset(vm, i, JSC::JSValue::decode(Bun__encoding__toStringUTF8(text, len, lexicalGlobalObject)));
-                    continue;
-                }
-
-                result->putDirectOffset(vm, i, jsString(vm, WTF::String::fromUTF8(text, len)));
-                break;
-            }
-            case SQLITE_BLOB: {
-                size_t len = sqlite3_column_bytes(stmt, i);
-                const void* blob = len > 0 ? sqlite3_column_blob(stmt, i) : nullptr;
-                JSC::JSUint8Array* array = JSC::JSUint8Array::createUninitialized(lexicalGlobalObject, lexicalGlobalObject->m_typedArrayUint8.get(lexicalGlobalObject), len);
-                memcpy(array->vector(), blob, len);
-                result->putDirectOffset(vm, i, array);
-                break;
-            }
-            default: {
-                result->putDirectOffset(vm, i, jsNull());
-                break;
-            }
-            }
-        }
+        materializeRow(lexicalGlobalObject, castedThis, count, [&](int i, JSC::JSValue value) {
+            result->putDirectOffset(vm, i, value);
+        });
     } else {
         if (count <= 64) {
             result = JSC::JSFinalObject::create(vm, castedThis->_prototype.get()->structure());
@@ -1066,49 +1238,9 @@ static inline JSC::JSValue constructResultObject(JSC::JSGlobalObject* lexicalGlo
             result = JSC::JSFinalObject::create(vm, JSC::JSFinalObject::createStructure(vm, lexicalGlobalObject, lexicalGlobalObject->objectPrototype(), std::min(count, 64)));
         }
 
-        for (int i = 0; i < count; i++) {
-            auto name = columnNames[i];
-
-            switch (sqlite3_column_type(stmt, i)) {
-            case SQLITE_INTEGER: {
-                // https://github.com/oven-sh/bun/issues/1536
-                result->putDirect(vm, name, jsNumber(sqlite3_column_int64(stmt, i)), 0);
-                break;
-            }
-            case SQLITE_FLOAT: {
-                result->putDirect(vm, name, jsNumber(sqlite3_column_double(stmt, i)), 0);
-                break;
-            }
-            // > Note that the SQLITE_TEXT constant was also used in SQLite version
-            // > 2 for a completely different meaning. Software that links against
-            // > both SQLite version 2 and SQLite version 3 should use SQLITE3_TEXT,
-            // > not SQLITE_TEXT.
-            case SQLITE3_TEXT: {
-                size_t len = sqlite3_column_bytes(stmt, i);
-                const unsigned char* text = len > 0 ? sqlite3_column_text(stmt, i) : nullptr;
-
-                if (len > 64) {
-                    result->putDirect(vm, name, JSC::JSValue::decode(Bun__encoding__toStringUTF8(text, len, lexicalGlobalObject)), 0);
-                    continue;
-                }
-
-                result->putDirect(vm, name, jsString(vm, WTF::String::fromUTF8(text, len)), 0);
-                break;
-            }
-            case SQLITE_BLOB: {
-                size_t len = sqlite3_column_bytes(stmt, i);
-                const void* blob = len > 0 ? sqlite3_column_blob(stmt, i) : nullptr;
-                JSC::JSUint8Array* array = JSC::JSUint8Array::createUninitialized(lexicalGlobalObject, lexicalGlobalObject->m_typedArrayUint8.get(lexicalGlobalObject), len);
-                memcpy(array->vector(), blob, len);
-                result->putDirect(vm, name, array, 0);
-                break;
-            }
-            default: {
-                result->putDirect(vm, name, jsNull(), 0);
-                break;
-            }
-            }
-        }
+        materializeRow(lexicalGlobalObject, castedThis, count, [&](int i, JSC::JSValue value) {
+            result->putDirect(vm, columnNames[i], value, 0);
+        });
     }
 
     return JSValue(result);
@@ -1121,48 +1253,10 @@ static inline JSC::JSArray* constructResultRow(JSC::JSGlobalObject* lexicalGloba
     auto& vm = lexicalGlobalObject->vm();
 
     JSC::JSArray* result = JSArray::create(vm, lexicalGlobalObject->arrayStructureForIndexingTypeDuringAllocation(ArrayWithContiguous), count);
-    auto* stmt = castedThis->stmt;
-
-    for (int i = 0; i < count; i++) {
 
-        switch (sqlite3_column_type(stmt, i)) {
-        case SQLITE_INTEGER: {
-            // https://github.com/oven-sh/bun/issues/1536
-            result->initializeIndex(scope, i, jsNumber(sqlite3_column_int64(stmt, i)));
-            break;
-        }
-        case SQLITE_FLOAT: {
-            result->initializeIndex(scope, i, jsNumber(sqlite3_column_double(stmt, i)));
-            break;
-        }
-        // > Note that the SQLITE_TEXT constant was also used in SQLite version
-        // > 2 for a completely different meaning. Software that links against
-        // > both SQLite version 2 and SQLite version 3 should use SQLITE3_TEXT,
-        // > not SQLITE_TEXT.
-        case SQLITE_TEXT: {
-            size_t len = sqlite3_column_bytes(stmt, i);
-            const unsigned char* text = len > 0 ? sqlite3_column_text(stmt, i) : nullptr;
-            if (UNLIKELY(text == nullptr || len == 0)) {
-                result->initializeIndex(scope, i, jsEmptyString(vm));
-                continue;
-            }
-            result->initializeIndex(scope, i, len < 64 ? jsString(vm, WTF::String::fromUTF8(text, len)) : JSC::JSValue::decode(Bun__encoding__toStringUTF8(text, len, lexicalGlobalObject)));
-            break;
-        }
-        case SQLITE_BLOB: {
-            size_t len = sqlite3_column_bytes(stmt, i);
-            const void* blob = len > 0 ? sqlite3_column_blob(stmt, i) : nullptr;
-            JSC::JSUint8Array* array = JSC::JSUint8Array::createUninitialized(lexicalGlobalObject, lexicalGlobalObject->m_typedArrayUint8.get(lexicalGlobalObject), len);
-            memcpy(array->vector(), blob, len);
-            result->initializeIndex(scope, i, array);
-            break;
-        }
-        default: {
-            result->initializeIndex(scope, i, jsNull());
-            break;
-        }
-        }
-    }
+    materializeRow(lexicalGlobalObject, castedThis, count, [&](int i, JSC::JSValue value) {
+        result->initializeIndex(scope, i, value);
+    });
 
     return result;
 }
@@ -1529,7 +1623,7 @@ JSC_DEFINE_HOST_FUNCTION(jsSQLStatementFunctionFinalize, (JSC::JSGlobalObject *
     CHECK_THIS
 
     if (castedThis->stmt) {
-        sqlite3_finalize(castedThis->stmt);
+        finalizeStatement(castedThis->stmt, castedThis->version_db.get());
         castedThis->stmt = nullptr;
     }
 
@@ -1560,7 +1654,7 @@ void JSSQLStatement::finishCreation(VM& vm)
 JSSQLStatement::~JSSQLStatement()
 {
     if (this->stmt) {
-        sqlite3_finalize(this->stmt);
+        finalizeStatement(this->stmt, this->version_db.get());
     }
 }
 
@@ -34,6 +34,7 @@
 #include "headers-handwritten.h"
 #include "BunClientData.h"
 #include "JavaScriptCore/CallFrame.h"
+#include "JavaScriptCore/ArrayBuffer.h"
 
 #if defined(__APPLE__)
 #define LAZY_LOAD_SQLITE 1
@@ -47,11 +48,30 @@
 
 namespace WebCore {
 
-class VersionSqlite3 {
+// Shared by a database's constructor entry and its statements, so that a
+// statement finalized after the constructor is gone can still see it.
+class VersionSqlite3 : public RefCounted<VersionSqlite3> {
 public:
-  explicit VersionSqlite3(sqlite3* db) : db(db), version(0) {}
+  static Ref<VersionSqlite3> create(sqlite3* db) { return adoptRef(*new VersionSqlite3(db)); }
+  static Ref<VersionSqlite3> create(sqlite3* db, RefPtr<JSC::ArrayBuffer>&& buffer) { return adoptRef(*new VersionSqlite3(db, WTFMove(buffer))); }
+  ~VersionSqlite3() { releaseBuffer(); }
+
+  // Called once SQLite is done with the buffer.
+  void releaseBuffer()
+  {
+    if (auto released = std::exchange(buffer, nullptr))
+      released->unpin();
+  }
+
   sqlite3* db;
   std::atomic<uint64_t> version;
+  // The memory of a read-only deserialized database, which SQLite reads in
+  // place. Pinned so that it can't be detached while the connection is open.
+  RefPtr<JSC::ArrayBuffer> buffer;
+
+private:
+  explicit VersionSqlite3(sqlite3* db) : db(db), version(0) {}
+  VersionSqlite3(sqlite3* db, RefPtr<JSC::ArrayBuffer>&& buffer) : db(db), version(0), buffer(WTFMove(buffer)) { this->buffer->pin(); }
 };
 
 class JSSQLStatementConstructor final : public JSC::JSFunction {
@@ -78,7 +98,7 @@ public:
         return JSC::Structure::create(vm, globalObject, prototype, JSC::TypeInfo(JSC::ObjectType, StructureFlags), info());
     }
 
-    Vector<VersionSqlite3*> databases;
+    Vector<RefPtr<VersionSqlite3>> databases;
     Vector<std::atomic<uint64_t>> schema_versions;
 
 private:
@@ -71,6 +71,16 @@ typedef int (*lazy_sqlite3_deserialize_type)(
 );
 
 typedef int (*lazy_sqlite3_stmt_readonly_type)(sqlite3_stmt* pStmt);
+typedef sqlite3_stmt* (*lazy_sqlite3_next_stmt_type)(sqlite3* pDb, sqlite3_stmt* pStmt);
+typedef sqlite3* (*lazy_sqlite3_db_handle_type)(sqlite3_stmt*);
+typedef int (*lazy_sqlite3_file_control_type)(sqlite3*, const char* zDbName, int op, void*);
+typedef int (*lazy_sqlite3_exec_type)(
+    sqlite3*, /* An open database */
+    const char* sql, /* SQL to be evaluated */
+    int (*callback)(void*, int, char**, char**), /* Callback function */
+    void*, /* 1st argument to callback */
+    char** errmsg /* Error msg written here */
+);
 
 static lazy_sqlite3_bind_blob_type lazy_sqlite3_bind_blob;
 static lazy_sqlite3_bind_double_type lazy_sqlite3_bind_double;
@@ -112,6 +122,10 @@ static lazy_sqlite3_malloc64_type lazy_sqlite3_malloc64;
 static lazy_sqlite3_serialize_type lazy_sqlite3_serialize;
 static lazy_sqlite3_deserialize_type lazy_sqlite3_deserialize;
 static lazy_sqlite3_stmt_readonly_type lazy_sqlite3_stmt_readonly;
+static lazy_sqlite3_next_stmt_type lazy_sqlite3_next_stmt;
+static lazy_sqlite3_db_handle_type lazy_sqlite3_db_handle;
+static lazy_sqlite3_file_control_type lazy_sqlite3_file_control;
+static lazy_sqlite3_exec_type lazy_sqlite3_exec;
 
 #define sqlite3_bind_blob lazy_sqlite3_bind_blob
 #define sqlite3_bind_double lazy_sqlite3_bind_double
@@ -152,6 +166,10 @@ static lazy_sqlite3_stmt_readonly_type lazy_sqlite3_stmt_readonly;
 #define sqlite3_deserialize lazy_sqlite3_deserialize
 #define sqlite3_stmt_readonly lazy_sqlite3_stmt_readonly
 #define sqlite3_column_int64 lazy_sqlite3_column_int64
+#define sqlite3_next_stmt lazy_sqlite3_next_stmt
+#define sqlite3_db_handle lazy_sqlite3_db_handle
+#define sqlite3_file_control lazy_sqlite3_file_control
+#define sqlite3_exec lazy_sqlite3_exec
 
 static void* sqlite3_handle = nullptr;
 static const char* sqlite3_lib_path = "libsqlite3.dylib";
@@ -204,6 +222,10 @@ static int lazyLoadSQLite()
     lazy_sqlite3_deserialize = (lazy_sqlite3_deserialize_type)dlsym(sqlite3_handle, "sqlite3_deserialize");
     lazy_sqlite3_malloc64 = (lazy_sqlite3_malloc64_type)dlsym(sqlite3_handle, "sqlite3_malloc64");
     lazy_sqlite3_stmt_readonly = (lazy_sqlite3_stmt_readonly_type)dlsym(sqlite3_handle, "sqlite3_stmt_readonly");
+    lazy_sqlite3_next_stmt = (lazy_sqlite3_next_stmt_type)dlsym(sqlite3_handle, "sqlite3_next_stmt");
+    lazy_sqlite3_db_handle = (lazy_sqlite3_db_handle_type)dlsym(sqlite3_handle, "sqlite3_db_handle");
+    lazy_sqlite3_file_control = (lazy_sqlite3_file_control_type)dlsym(sqlite3_handle, "sqlite3_file_control");
+    lazy_sqlite3_exec = (lazy_sqlite3_exec_type)dlsym(sqlite3_handle, "sqlite3_exec");
 
     return 0;
 }
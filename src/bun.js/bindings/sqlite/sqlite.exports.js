@@ -199,8 +199,10 @@ export class Database {
     var filename =
       typeof filenameGiven === "string" ? filenameGiven.trim() : ":memory:";
     var flags = constants.SQLITE_OPEN_READWRITE | constants.SQLITE_OPEN_CREATE;
+    var mmap = false;
     if (typeof options === "object" && options) {
       flags = 0;
+      mmap = !!options.mmap;
 
       if (options.readonly) {
         flags = constants.SQLITE_OPEN_READONLY;
@@ -231,7 +233,7 @@ export class Database {
       _SQL = SQL = lazy("sqlite");
     }
 
-    this.#handle = SQL.open(anonymous ? ":memory:" : filename, flags);
+    this.#handle = SQL.open(anonymous ? ":memory:" : filename, flags, mmap);
     this.filename = filename;
   }
 
@@ -27,11 +27,14 @@ public:
     std::unique_ptr<GCClient::IsoSubspace> m_clientSubspaceForJSSinkController;
     std::unique_ptr<GCClient::IsoSubspace> m_clientSubspaceForJSSink;
     std::unique_ptr<GCClient::IsoSubspace> m_clientSubspaceForStringDecoder;
+    std::unique_ptr<GCClient::IsoSubspace> m_clientSubspaceForDigestStream;
     std::unique_ptr<GCClient::IsoSubspace> m_clientSubspaceForReadableState;
     std::unique_ptr<GCClient::IsoSubspace> m_clientSubspaceForPendingVirtualModuleResult;
     std::unique_ptr<GCClient::IsoSubspace> m_clientSubspaceForOnigurumaRegExp;
     std::unique_ptr<GCClient::IsoSubspace> m_clientSubspaceForCallSite;
+    std::unique_ptr<GCClient::IsoSubspace> m_clientSubspaceForCapturedStackTrace;
     std::unique_ptr<GCClient::IsoSubspace> m_clientSubspaceForNapiExternal;
+    std::unique_ptr<GCClient::IsoSubspace> m_clientSubspaceForEnvironmentVariableMap;
 #include "ZigGeneratedClasses+DOMClientIsoSubspaces.h"
     /* --- bun --- */
 
@@ -27,11 +27,14 @@ public:
     std::unique_ptr<IsoSubspace> m_subspaceForJSSinkController;
     std::unique_ptr<IsoSubspace> m_subspaceForJSSink;
     std::unique_ptr<IsoSubspace> m_subspaceForStringDecoder;
+    std::unique_ptr<IsoSubspace> m_subspaceForDigestStream;
     std::unique_ptr<IsoSubspace> m_subspaceForReadableState;
     std::unique_ptr<IsoSubspace> m_subspaceForPendingVirtualModuleResult;
     std::unique_ptr<IsoSubspace> m_subspaceForOnigurumaRegExp;
     std::unique_ptr<IsoSubspace> m_subspaceForCallSite;
+    std::unique_ptr<IsoSubspace> m_subspaceForCapturedStackTrace;
     std::unique_ptr<IsoSubspace> m_subspaceForNapiExternal;
+    std::unique_ptr<IsoSubspace> m_subspaceForEnvironmentVariableMap;
 #include "ZigGeneratedClasses+DOMIsoSubspaces.h"
     /*-- BUN --*/
 
@@ -186,6 +186,24 @@ void Event::resetAfterDispatch()
     // InspectorInstrumentation::eventDidResetAfterDispatch(*this);
 }
 
+void Event::resetForReuse()
+{
+    ASSERT(hasOneRef());
+    ASSERT(!wrapper());
+    ASSERT(!isBeingDispatched());
+
+    m_propagationStopped = false;
+    m_immediatePropagationStopped = false;
+    m_wasCanceled = false;
+    m_defaultHandled = false;
+    m_isExecutingPassiveEventListener = false;
+    m_eventPhase = NONE;
+    m_target = nullptr;
+    m_currentTarget = nullptr;
+    m_underlyingEvent = nullptr;
+    m_createTime = MonotonicTime::now();
+}
+
 String Event::debugDescription() const
 {
     return makeString(type(), " phase ", eventPhase(), bubbles() ? " bubbles " : " ", cancelable() ? "cancelable " : " ", "0x"_s, hex(reinterpret_cast<uintptr_t>(this), Lowercase));
@@ -161,6 +161,10 @@ protected:
 
     virtual void receivedTarget() {}
 
+    // Puts an event that nothing else refers to back into its freshly created,
+    // undispatched state, for subclasses that dispatch the same object again.
+    void resetForReuse();
+
 private:
     explicit Event(MonotonicTime createTime, const AtomString& type, IsTrusted, CanBubble, IsCancelable, IsComposed);
 
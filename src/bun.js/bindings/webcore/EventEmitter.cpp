@@ -6,6 +6,7 @@
 #include "EventNames.h"
 #include "JSErrorHandler.h"
 #include "JSEventListener.h"
+#include "WebCoreJSClientData.h"
 #include <wtf/MainThread.h>
 #include <wtf/NeverDestroyed.h>
 #include <wtf/Ref.h>
@@ -164,64 +165,78 @@ void EventEmitter::fireEventListeners(const Identifier& eventType, const MarkedA
     if (!data)
         return;
 
+    auto* listenersVector = data->eventListenerMap.find(eventType);
+    if (!listenersVector)
+        return;
+
     SetForScope firingEventListenersScope(data->isFiringEventListeners, true);
 
-    if (auto* listenersVector = data->eventListenerMap.find(eventType)) {
-        innerInvokeEventListeners(eventType, *listenersVector, arguments);
+    // The common case of a single listener only needs that listener kept alive.
+    if (listenersVector->size() == 1) {
+        Ref<EventEmitter> protectedThis(*this);
+        Ref<SimpleRegisteredEventListener> registeredListener = *listenersVector->first();
+        invokeEventListener(eventType, registeredListener, arguments);
         return;
     }
+
+    innerInvokeEventListeners(eventType, data->eventListenerMap.snapshot(eventType).releaseNonNull(), arguments);
 }
 
-// Intentionally creates a copy of the listeners vector to avoid event listeners added after this point from being run.
+// Holds a reference to the listener list rather than a copy; the map copies the list
+// before changing it, so event listeners added after this point are not run.
 // Note that removal still has an effect due to the removed field in RegisteredEventListener.
 // https://dom.spec.whatwg.org/#concept-event-listener-inner-invoke
-void EventEmitter::innerInvokeEventListeners(const Identifier& eventType, SimpleEventListenerVector listeners, const MarkedArgumentBuffer& arguments)
+void EventEmitter::innerInvokeEventListeners(const Identifier& eventType, Ref<SimpleEventListenerList>&& listeners, const MarkedArgumentBuffer& arguments)
 {
     Ref<EventEmitter> protectedThis(*this);
-    ASSERT(!listeners.isEmpty());
+    ASSERT(!listeners->listeners().isEmpty());
+
+    for (auto& registeredListener : listeners->listeners())
+        invokeEventListener(eventType, *registeredListener, arguments);
+}
+
+void EventEmitter::invokeEventListener(const Identifier& eventType, SimpleRegisteredEventListener& registeredListener, const MarkedArgumentBuffer& arguments)
+{
     ASSERT(scriptExecutionContext());
 
-    auto& context = *scriptExecutionContext();
-    VM& vm = context.vm();
+    if (UNLIKELY(registeredListener.wasRemoved()))
+        return;
 
-    for (auto& registeredListener : listeners) {
-        if (UNLIKELY(registeredListener->wasRemoved()))
-            continue;
+    // Make sure the JS wrapper and function stay alive until the end of this scope. Otherwise,
+    // event listeners with 'once' flag may get collected as soon as they get unregistered below,
+    // before we call the js function.
+    JSC::EnsureStillAliveScope wrapperProtector(registeredListener.callback().wrapper());
+    JSC::EnsureStillAliveScope jsFunctionProtector(registeredListener.callback().jsFunction());
 
-        // Make sure the JS wrapper and function stay alive until the end of this scope. Otherwise,
-        // event listeners with 'once' flag may get collected as soon as they get unregistered below,
-        // before we call the js function.
-        JSC::EnsureStillAliveScope wrapperProtector(registeredListener->callback().wrapper());
-        JSC::EnsureStillAliveScope jsFunctionProtector(registeredListener->callback().jsFunction());
+    // Do this before invocation to avoid reentrancy issues.
+    if (registeredListener.isOnce())
+        removeListener(eventType, registeredListener.callback());
 
-        // Do this before invocation to avoid reentrancy issues.
-        if (registeredListener->isOnce())
-            removeListener(eventType, registeredListener->callback());
+    JSC::JSObject* jsFunction = registeredListener.callback().jsFunction();
+    if (!jsFunction)
+        return;
 
-        if (JSC::JSObject* jsFunction = registeredListener->callback().jsFunction()) {
-            JSC::JSGlobalObject* lexicalGlobalObject = jsFunction->globalObject();
-            auto callData = JSC::getCallData(jsFunction);
-            if (callData.type == JSC::CallData::Type::None)
-                continue;
+    JSC::JSGlobalObject* lexicalGlobalObject = jsFunction->globalObject();
+    auto& callData = registeredListener.callData(jsFunction);
+    if (callData.type == JSC::CallData::Type::None)
+        return;
 
-            WTF::NakedPtr<JSC::Exception> exceptionPtr;
-            JSC::call(jsFunction->globalObject(), jsFunction, callData, JSC::jsUndefined(), arguments, exceptionPtr);
-            if (auto* exception = exceptionPtr.get()) {
-                auto errorIdentifier = JSC::Identifier::fromString(vm, eventNames().errorEvent);
-                auto hasErrorListener = this->hasActiveEventListeners(errorIdentifier);
-                if (!hasErrorListener || eventType == errorIdentifier) {
-                    // If the event type is error, report the exception to the console.
-                    Bun__reportError(lexicalGlobalObject, JSValue::encode(JSValue(exception)));
-                } else if (hasErrorListener) {
-                    MarkedArgumentBuffer expcep;
-                    JSValue errorValue = exception->value();
-                    if (!errorValue) {
-                        errorValue = JSC::jsUndefined();
-                    }
-                    expcep.append(errorValue);
-                    fireEventListeners(errorIdentifier, WTFMove(expcep));
-                }
+    WTF::NakedPtr<JSC::Exception> exceptionPtr;
+    JSC::call(lexicalGlobalObject, jsFunction, callData, JSC::jsUndefined(), arguments, exceptionPtr);
+    if (auto* exception = exceptionPtr.get()) {
+        auto& errorIdentifier = builtinNames(lexicalGlobalObject->vm()).errorPublicName();
+        auto hasErrorListener = this->hasActiveEventListeners(errorIdentifier);
+        if (!hasErrorListener || eventType == errorIdentifier) {
+            // If the event type is error, report the exception to the console.
+            Bun__reportError(lexicalGlobalObject, JSValue::encode(JSValue(exception)));
+        } else if (hasErrorListener) {
+            MarkedArgumentBuffer expcep;
+            JSValue errorValue = exception->value();
+            if (!errorValue) {
+                errorValue = JSC::jsUndefined();
             }
+            expcep.append(errorValue);
+            fireEventListeners(errorIdentifier, WTFMove(expcep));
         }
     }
 }
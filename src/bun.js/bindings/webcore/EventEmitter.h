@@ -94,7 +94,8 @@ private:
     EventEmitterData& ensureEventEmitterData() { return m_eventTargetData; }
     void eventListenersDidChange() {}
 
-    void innerInvokeEventListeners(const Identifier&, SimpleEventListenerVector, const MarkedArgumentBuffer& arguments);
+    void innerInvokeEventListeners(const Identifier&, Ref<SimpleEventListenerList>&&, const MarkedArgumentBuffer& arguments);
+    void invokeEventListener(const Identifier&, SimpleRegisteredEventListener&, const MarkedArgumentBuffer& arguments);
     void invalidateEventListenerRegions();
 
     EventEmitterData m_eventTargetData;
@@ -44,17 +44,23 @@
 
 namespace WebCore {
 
+bool EventListenerList::hasCapturingListeners() const
+{
+    if (!m_hasCapturingListeners) {
+        m_hasCapturingListeners = m_listeners.containsIf([](auto& listener) {
+            return listener->useCapture();
+        });
+    }
+    return *m_hasCapturingListeners;
+}
+
 EventListenerMap::EventListenerMap() = default;
 
 bool EventListenerMap::containsCapturing(const AtomString& eventType) const
 {
-    auto* listeners = find(eventType);
-    if (!listeners)
-        return false;
-
-    for (auto& eventListener : *listeners) {
-        if (eventListener->useCapture())
-            return true;
+    for (auto& entry : m_entries) {
+        if (entry.first == eventType)
+            return entry.second->hasCapturingListeners();
     }
     return false;
 }
@@ -77,7 +83,7 @@ void EventListenerMap::clear()
     Locker locker { m_lock };
 
     for (auto& entry : m_entries) {
-        for (auto& listener : entry.second)
+        for (auto& listener : entry.second->listeners())
             listener->markAsRemoved();
     }
 
@@ -105,7 +111,7 @@ void EventListenerMap::replace(const AtomString& eventType, EventListener& oldLi
 {
     Locker locker { m_lock };
 
-    auto* listeners = find(eventType);
+    auto* listeners = findForWriting(eventType);
     ASSERT(listeners);
     size_t index = findListener(*listeners, oldListener, options.capture);
     ASSERT(index != notFound);
@@ -121,11 +127,11 @@ bool EventListenerMap::add(const AtomString& eventType, Ref<EventListener>&& lis
     if (auto* listeners = find(eventType)) {
         if (findListener(*listeners, listener, options.capture) != notFound)
             return false; // Duplicate listener.
-        listeners->append(RegisteredEventListener::create(WTFMove(listener), options));
+        findForWriting(eventType)->append(RegisteredEventListener::create(WTFMove(listener), options));
         return true;
     }
 
-    m_entries.append({ eventType, EventListenerVector { RegisteredEventListener::create(WTFMove(listener), options) } });
+    m_entries.append({ eventType, EventListenerList::create(EventListenerVector { RegisteredEventListener::create(WTFMove(listener), options) }) });
     return true;
 }
 
@@ -146,21 +152,51 @@ bool EventListenerMap::remove(const AtomString& eventType, EventListener& listen
 
     for (unsigned i = 0; i < m_entries.size(); ++i) {
         if (m_entries[i].first == eventType) {
-            bool wasRemoved = removeListenerFromVector(m_entries[i].second, listener, useCapture);
-            if (m_entries[i].second.isEmpty())
+            auto& listeners = m_entries[i].second->listeners();
+            size_t index = findListener(listeners, listener, useCapture);
+            if (UNLIKELY(index == notFound))
+                return false;
+            if (listeners.size() == 1) {
+                listeners[0]->markAsRemoved();
                 m_entries.remove(i);
-            return wasRemoved;
+                return true;
+            }
+            return removeListenerFromVector(*findForWriting(eventType), listener, useCapture);
         }
     }
 
     return false;
 }
 
-EventListenerVector* EventListenerMap::find(const AtomString& eventType)
+const EventListenerVector* EventListenerMap::find(const AtomString& eventType) const
+{
+    for (auto& entry : m_entries) {
+        if (entry.first == eventType)
+            return &entry.second->listeners();
+    }
+
+    return nullptr;
+}
+
+EventListenerVector* EventListenerMap::findForWriting(const AtomString& eventType)
+{
+    for (auto& entry : m_entries) {
+        if (entry.first != eventType)
+            continue;
+        // A dispatch in progress holds the list; change a copy instead.
+        if (!entry.second->hasOneRef())
+            entry.second = EventListenerList::create(EventListenerVector(entry.second->listeners()));
+        return &entry.second->listenersForWriting();
+    }
+
+    return nullptr;
+}
+
+RefPtr<EventListenerList> EventListenerMap::snapshot(const AtomString& eventType) const
 {
     for (auto& entry : m_entries) {
         if (entry.first == eventType)
-            return &entry.second;
+            return entry.second.copyRef();
     }
 
     return nullptr;
@@ -184,15 +220,16 @@ void EventListenerMap::removeFirstEventListenerCreatedFromMarkup(const AtomStrin
 
     for (unsigned i = 0; i < m_entries.size(); ++i) {
         if (m_entries[i].first == eventType) {
-            removeFirstListenerCreatedFromMarkup(m_entries[i].second);
-            if (m_entries[i].second.isEmpty())
+            auto& listeners = *findForWriting(eventType);
+            removeFirstListenerCreatedFromMarkup(listeners);
+            if (listeners.isEmpty())
                 m_entries.remove(i);
             return;
         }
     }
 }
 
-static void copyListenersNotCreatedFromMarkupToTarget(const AtomString& eventType, EventListenerVector& listenerVector, EventTarget* target)
+static void copyListenersNotCreatedFromMarkupToTarget(const AtomString& eventType, const EventListenerVector& listenerVector, EventTarget* target)
 {
     for (auto& registeredListener : listenerVector) {
         // Event listeners created from markup have already been transfered to the shadow tree during cloning.
@@ -205,7 +242,7 @@ static void copyListenersNotCreatedFromMarkupToTarget(const AtomString& eventTyp
 void EventListenerMap::copyEventListenersNotCreatedFromMarkupToTarget(EventTarget* target)
 {
     for (auto& entry : m_entries)
-        copyListenersNotCreatedFromMarkupToTarget(entry.first, entry.second, target);
+        copyListenersNotCreatedFromMarkupToTarget(entry.first, entry.second->listeners(), target);
 }
 
 } // namespace WebCore
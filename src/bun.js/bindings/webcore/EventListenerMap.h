@@ -45,6 +45,35 @@ class EventTarget;
 
 using EventListenerVector = Vector<RefPtr<RegisteredEventListener>, 1, CrashOnOverflow, 2>;
 
+// The listeners for one event type. Dispatch holds a reference to the list
+// instead of copying it, and the map copies a list before changing it while
+// such a reference exists, so listeners added during dispatch don't run.
+class EventListenerList : public RefCounted<EventListenerList> {
+public:
+    static Ref<EventListenerList> create(EventListenerVector&& listeners)
+    {
+        return adoptRef(*new EventListenerList(WTFMove(listeners)));
+    }
+
+    const EventListenerVector& listeners() const { return m_listeners; }
+    EventListenerVector& listenersForWriting()
+    {
+        m_hasCapturingListeners = std::nullopt;
+        return m_listeners;
+    }
+
+    bool hasCapturingListeners() const;
+
+private:
+    explicit EventListenerList(EventListenerVector&& listeners)
+        : m_listeners(WTFMove(listeners))
+    {
+    }
+
+    EventListenerVector m_listeners;
+    mutable std::optional<bool> m_hasCapturingListeners;
+};
+
 class EventListenerMap {
 public:
     EventListenerMap();
@@ -59,8 +88,9 @@ public:
     void replace(const AtomString& eventType, EventListener& oldListener, Ref<EventListener>&& newListener, const RegisteredEventListener::Options&);
     bool add(const AtomString& eventType, Ref<EventListener>&&, const RegisteredEventListener::Options&);
     bool remove(const AtomString& eventType, EventListener&, bool useCapture);
-    WEBCORE_EXPORT EventListenerVector* find(const AtomString& eventType);
-    const EventListenerVector* find(const AtomString& eventType) const { return const_cast<EventListenerMap*>(this)->find(eventType); }
+    WEBCORE_EXPORT const EventListenerVector* find(const AtomString& eventType) const;
+    // The current listeners for eventType, unaffected by later changes.
+    RefPtr<EventListenerList> snapshot(const AtomString& eventType) const;
     Vector<AtomString> eventTypes() const;
 
     void removeFirstEventListenerCreatedFromMarkup(const AtomString& eventType);
@@ -70,7 +100,9 @@ public:
     Lock& lock() { return m_lock; }
 
 private:
-    Vector<std::pair<AtomString, EventListenerVector>> m_entries;
+    EventListenerVector* findForWriting(const AtomString& eventType);
+
+    Vector<std::pair<AtomString, Ref<EventListenerList>>> m_entries;
     Lock m_lock;
 };
 
@@ -79,7 +111,7 @@ void EventListenerMap::visitJSEventListeners(Visitor& visitor)
 {
     Locker locker { m_lock };
     for (auto& entry : m_entries) {
-        for (auto& eventListener : entry.second)
+        for (auto& eventListener : entry.second->listeners())
             eventListener->callback().visitJSFunction(visitor);
     }
 }
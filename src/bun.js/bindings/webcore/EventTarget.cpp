@@ -243,8 +243,19 @@ void EventTarget::dispatchEvent(Event& event)
     event.setCurrentTarget(this);
     event.setEventPhase(Event::AT_TARGET);
     event.resetBeforeDispatch();
-    fireEventListeners(event, EventInvokePhase::Capturing);
-    fireEventListeners(event, EventInvokePhase::Bubbling);
+
+    // The two passes only exist to run capturing listeners first. Without
+    // any, a single pass over the listeners does the same.
+    auto* data = eventTargetData();
+    auto listeners = data ? data->eventListenerMap.snapshot(event.type()) : nullptr;
+    if (listeners && !listeners->hasCapturingListeners()) {
+        SetForScope firingEventListenersScope(data->isFiringEventListeners, true);
+        innerInvokeEventListeners(event, listeners.releaseNonNull(), EventInvokePhase::Bubbling);
+    } else {
+        fireEventListeners(event, EventInvokePhase::Capturing);
+        fireEventListeners(event, EventInvokePhase::Bubbling);
+    }
+
     event.resetAfterDispatch();
 }
 
@@ -270,8 +281,8 @@ void EventTarget::fireEventListeners(Event& event, EventInvokePhase phase)
 
     SetForScope firingEventListenersScope(data->isFiringEventListeners, true);
 
-    if (auto* listenersVector = data->eventListenerMap.find(event.type())) {
-        innerInvokeEventListeners(event, *listenersVector, phase);
+    if (auto listeners = data->eventListenerMap.snapshot(event.type())) {
+        innerInvokeEventListeners(event, listeners.releaseNonNull(), phase);
         return;
     }
 
@@ -281,21 +292,23 @@ void EventTarget::fireEventListeners(Event& event, EventInvokePhase phase)
 
     const AtomString& legacyTypeName = legacyType(event);
     if (!legacyTypeName.isNull()) {
-        if (auto* legacyListenersVector = data->eventListenerMap.find(legacyTypeName)) {
+        if (auto legacyListeners = data->eventListenerMap.snapshot(legacyTypeName)) {
             AtomString typeName = event.type();
             event.setType(legacyTypeName);
-            innerInvokeEventListeners(event, *legacyListenersVector, phase);
+            innerInvokeEventListeners(event, legacyListeners.releaseNonNull(), phase);
             event.setType(typeName);
         }
     }
 }
 
-// Intentionally creates a copy of the listeners vector to avoid event listeners added after this point from being run.
+// Holds a reference to the listener list rather than a copy; the map copies the list
+// before changing it, so event listeners added after this point are not run.
 // Note that removal still has an effect due to the removed field in RegisteredEventListener.
 // https://dom.spec.whatwg.org/#concept-event-listener-inner-invoke
-void EventTarget::innerInvokeEventListeners(Event& event, EventListenerVector listeners, EventInvokePhase phase)
+void EventTarget::innerInvokeEventListeners(Event& event, Ref<EventListenerList>&& listenerList, EventInvokePhase phase)
 {
     Ref<EventTarget> protectedThis(*this);
+    auto& listeners = listenerList->listeners();
     ASSERT(!listeners.isEmpty());
     ASSERT(scriptExecutionContext());
 
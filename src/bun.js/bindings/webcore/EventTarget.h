@@ -130,7 +130,7 @@ private:
     virtual void refEventTarget() = 0;
     virtual void derefEventTarget() = 0;
 
-    void innerInvokeEventListeners(Event&, EventListenerVector, EventInvokePhase);
+    void innerInvokeEventListeners(Event&, Ref<EventListenerList>&&, EventInvokePhase);
     void invalidateEventListenerRegions();
 };
 
@@ -7,10 +7,19 @@
 #include <wtf/MainThread.h>
 #include <wtf/StdLibExtras.h>
 #include <wtf/Vector.h>
-
+#include <JavaScriptCore/JSCInlines.h>
 
 namespace WebCore {
 
+const JSC::CallData& SimpleRegisteredEventListener::callData(JSC::JSObject* function)
+{
+    if (m_callDataFunction != function) {
+        m_callData = JSC::getCallData(function);
+        m_callDataFunction = function;
+    }
+    return m_callData;
+}
+
 IdentifierEventListenerMap::IdentifierEventListenerMap() = default;
 
 bool IdentifierEventListenerMap::containsActive(const JSC::Identifier& eventType) const
@@ -23,7 +32,7 @@ void IdentifierEventListenerMap::clear()
     Locker locker { m_lock };
 
     for (auto& entry : m_entries) {
-        for (auto& listener : entry.second)
+        for (auto& listener : entry.second->listeners())
             listener->markAsRemoved();
     }
 
@@ -51,7 +60,7 @@ void IdentifierEventListenerMap::replace(const JSC::Identifier& eventType, Event
 {
     Locker locker { m_lock };
 
-    auto* listeners = find(eventType);
+    auto* listeners = findForWriting(eventType);
     ASSERT(listeners);
     size_t index = findListener(*listeners, oldListener);
     ASSERT(index != notFound);
@@ -67,11 +76,12 @@ bool IdentifierEventListenerMap::add(const JSC::Identifier& eventType, Ref<Event
     if (auto* listeners = find(eventType)) {
         if (findListener(*listeners, listener) != notFound)
             return false; // Duplicate listener.
+        listeners = findForWriting(eventType);
         listeners->append(SimpleRegisteredEventListener::create(WTFMove(listener), once));
         return true;
     }
 
-    m_entries.append({ eventType, SimpleEventListenerVector { SimpleRegisteredEventListener::create(WTFMove(listener), once) } });
+    m_entries.append({ eventType, SimpleEventListenerList::create(SimpleEventListenerVector { SimpleRegisteredEventListener::create(WTFMove(listener), once) }) });
     return true;
 }
 
@@ -82,11 +92,12 @@ bool IdentifierEventListenerMap::prepend(const JSC::Identifier& eventType, Ref<E
     if (auto* listeners = find(eventType)) {
         if (findListener(*listeners, listener) != notFound)
             return false; // Duplicate listener.
+        listeners = findForWriting(eventType);
         listeners->insert(0, SimpleRegisteredEventListener::create(WTFMove(listener), once));
         return true;
     }
 
-    m_entries.append({ eventType, SimpleEventListenerVector { SimpleRegisteredEventListener::create(WTFMove(listener), once) } });
+    m_entries.append({ eventType, SimpleEventListenerList::create(SimpleEventListenerVector { SimpleRegisteredEventListener::create(WTFMove(listener), once) }) });
     return true;
 }
 
@@ -107,10 +118,16 @@ bool IdentifierEventListenerMap::remove(const JSC::Identifier& eventType, EventL
 
     for (unsigned i = 0; i < m_entries.size(); ++i) {
         if (m_entries[i].first == eventType) {
-            bool wasRemoved = removeListenerFromVector(m_entries[i].second, listener);
-            if (m_entries[i].second.isEmpty())
+            auto& listeners = m_entries[i].second->listeners();
+            size_t index = findListener(listeners, listener);
+            if (UNLIKELY(index == notFound))
+                return false;
+            if (listeners.size() == 1) {
+                listeners[0]->markAsRemoved();
                 m_entries.remove(i);
-            return wasRemoved;
+                return true;
+            }
+            return removeListenerFromVector(*findForWriting(eventType), listener);
         }
     }
 
@@ -123,6 +140,8 @@ bool IdentifierEventListenerMap::removeAll(const JSC::Identifier& eventType)
 
     for (unsigned i = 0; i < m_entries.size(); ++i) {
         if (m_entries[i].first == eventType) {
+            // An emit in progress keeps its own reference to the list and
+            // still runs every listener it started with, as Node does.
             m_entries.remove(i);
             return true;
         }
@@ -135,7 +154,31 @@ SimpleEventListenerVector* IdentifierEventListenerMap::find(const JSC::Identifie
 {
     for (auto& entry : m_entries) {
         if (entry.first == eventType)
-            return &entry.second;
+            return &entry.second->listeners();
+    }
+
+    return nullptr;
+}
+
+SimpleEventListenerVector* IdentifierEventListenerMap::findForWriting(const JSC::Identifier& eventType)
+{
+    for (auto& entry : m_entries) {
+        if (entry.first != eventType)
+            continue;
+        // An emit in progress holds the list; change a copy instead.
+        if (!entry.second->hasOneRef())
+            entry.second = SimpleEventListenerList::create(SimpleEventListenerVector(entry.second->listeners()));
+        return &entry.second->listeners();
+    }
+
+    return nullptr;
+}
+
+RefPtr<SimpleEventListenerList> IdentifierEventListenerMap::snapshot(const JSC::Identifier& eventType)
+{
+    for (auto& entry : m_entries) {
+        if (entry.first == eventType)
+            return entry.second.copyRef();
     }
 
     return nullptr;
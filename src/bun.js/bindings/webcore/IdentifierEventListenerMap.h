@@ -5,6 +5,7 @@
 #include <wtf/Forward.h>
 #include <wtf/Lock.h>
 #include <wtf/Ref.h>
+#include <JavaScriptCore/CallData.h>
 #include <JavaScriptCore/Identifier.h>
 #include "EventListener.h"
 
@@ -23,6 +24,10 @@ public:
 
     void markAsRemoved() { m_wasRemoved = true; }
 
+    // getCallData() for the listener's function, computed on first call and
+    // reused for as long as the function stays the same.
+    const JSC::CallData& callData(JSC::JSObject* function);
+
 private:
     SimpleRegisteredEventListener(Ref<EventListener>&& listener, bool once)
         : m_isOnce(once)
@@ -34,10 +39,34 @@ private:
     bool m_isOnce : 1;
     bool m_wasRemoved : 1;
     Ref<EventListener> m_callback;
+    JSC::JSObject* m_callDataFunction { nullptr };
+    JSC::CallData m_callData;
 };
 
 using SimpleEventListenerVector = Vector<RefPtr<SimpleRegisteredEventListener>, 1, CrashOnOverflow, 2>;
 
+// The listeners for one event type. Emitting holds a reference to the list
+// instead of copying it, and the map copies a list before changing it while
+// such a reference exists, so listeners added during an emit don't run.
+class SimpleEventListenerList : public RefCounted<SimpleEventListenerList> {
+public:
+    static Ref<SimpleEventListenerList> create(SimpleEventListenerVector&& listeners)
+    {
+        return adoptRef(*new SimpleEventListenerList(WTFMove(listeners)));
+    }
+
+    const SimpleEventListenerVector& listeners() const { return m_listeners; }
+    SimpleEventListenerVector& listeners() { return m_listeners; }
+
+private:
+    explicit SimpleEventListenerList(SimpleEventListenerVector&& listeners)
+        : m_listeners(WTFMove(listeners))
+    {
+    }
+
+    SimpleEventListenerVector m_listeners;
+};
+
 class IdentifierEventListenerMap {
 public:
     IdentifierEventListenerMap();
@@ -46,7 +75,7 @@ public:
     bool contains(const JSC::Identifier& eventType) const { return find(eventType); }
     bool containsActive(const JSC::Identifier& eventType) const;
 
-    const Vector<std::pair<JSC::Identifier, SimpleEventListenerVector>>& entries() const { return m_entries; }
+    const Vector<std::pair<JSC::Identifier, Ref<SimpleEventListenerList>>>& entries() const { return m_entries; }
 
     void clear();
 
@@ -57,13 +86,17 @@ public:
     bool removeAll(const JSC::Identifier& eventType);
     WEBCORE_EXPORT SimpleEventListenerVector* find(const JSC::Identifier& eventType);
     const SimpleEventListenerVector* find(const JSC::Identifier& eventType) const { return const_cast<IdentifierEventListenerMap*>(this)->find(eventType); }
+    // The current listeners for eventType, unaffected by later changes.
+    RefPtr<SimpleEventListenerList> snapshot(const JSC::Identifier& eventType);
     Vector<JSC::Identifier> eventTypes() const;
     template<typename Visitor> void visitJSEventListeners(Visitor&);
 
     Lock& lock() { return m_lock; }
 
 private:
-    Vector<std::pair<JSC::Identifier, SimpleEventListenerVector>> m_entries;
+    SimpleEventListenerVector* findForWriting(const JSC::Identifier& eventType);
+
+    Vector<std::pair<JSC::Identifier, Ref<SimpleEventListenerList>>> m_entries;
     Lock m_lock;
 };
 
@@ -72,7 +105,7 @@ void IdentifierEventListenerMap::visitJSEventListeners(Visitor& visitor)
 {
     Locker locker { m_lock };
     for (auto& entry : m_entries) {
-        for (auto& eventListener : entry.second)
+        for (auto& eventListener : entry.second->listeners())
             eventListener->callback().visitJSFunction(visitor);
     }
 }
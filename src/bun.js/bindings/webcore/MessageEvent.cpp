@@ -106,6 +106,22 @@ void MessageEvent::initMessageEvent(const AtomString& type, bool canBubble, bool
     m_cachedPorts.clear();
 }
 
+void MessageEvent::reuse(DataType&& data, const String& origin)
+{
+    resetForReuse();
+
+    {
+        Locker locker { m_concurrentDataAccessLock };
+        m_data = WTFMove(data);
+    }
+    m_jsData.clear();
+    m_cachedData.clear();
+    m_origin = origin;
+    m_lastEventId = String();
+    m_source = std::nullopt;
+    m_cachedPorts.clear();
+}
+
 EventInterface MessageEvent::eventInterface() const
 {
     return MessageEventInterfaceType;
@@ -67,6 +67,9 @@ public:
     virtual ~MessageEvent();
 
     void initMessageEvent(const AtomString& type, bool canBubble, bool cancelable, JSC::JSValue data, const String& origin, const String& lastEventId, std::optional<MessageEventSource>&& /*, Vector<RefPtr<MessagePort>>&&*/);
+    // Lets a target dispatch this event again with new data. Only valid when
+    // nothing else refers to it, so no wrapper or listener can observe it.
+    void reuse(DataType&&, const String& origin = {});
 
     const String& origin() const { return m_origin; }
     const String& lastEventId() const { return m_lastEventId; }
@@ -89,13 +89,20 @@ JSC_DEFINE_HOST_FUNCTION(structuredCloneForStream, (JSGlobalObject* globalObject
             throwDataCloneError(*globalObject, scope);
             return { };
         }
-        auto bufferClone = ArrayBuffer::tryCreate(buffer->data(), buffer->byteLength());
+        // Stream chunks are frequently small views into a much larger buffer
+        // (e.g. a socket read buffer), so only copy the bytes the view covers.
+        auto byteOffset = bufferView->byteOffset();
+        auto bufferClone = ArrayBuffer::tryCreate(static_cast<const uint8_t*>(buffer->data()) + byteOffset, bufferView->byteLength());
+        if (!bufferClone) {
+            throwOutOfMemoryError(globalObject, scope);
+            return { };
+        }
         Structure* structure = bufferView->structure();
 
 #define CLONE_TYPED_ARRAY(name) \
         do { \
             if (bufferView->inherits<JS##name##Array>()) \
-                RELEASE_AND_RETURN(scope, JSValue::encode(JS##name##Array::create(globalObject, structure, WTFMove(bufferClone), bufferView->byteOffset(), bufferView->length()))); \
+                RELEASE_AND_RETURN(scope, JSValue::encode(JS##name##Array::create(globalObject, structure, WTFMove(bufferClone), 0, bufferView->length()))); \
         } while (0);
 
         FOR_EACH_TYPED_ARRAY_TYPE_EXCLUDING_DATA_VIEW(CLONE_TYPED_ARRAY)
@@ -103,7 +110,7 @@ JSC_DEFINE_HOST_FUNCTION(structuredCloneForStream, (JSGlobalObject* globalObject
 #undef CLONE_TYPED_ARRAY
 
         if (value.inherits<JSDataView>())
-            RELEASE_AND_RETURN(scope, JSValue::encode(JSDataView::create(globalObject, structure, WTFMove(bufferClone), bufferView->byteOffset(), bufferView->length())));
+            RELEASE_AND_RETURN(scope, JSValue::encode(JSDataView::create(globalObject, structure, WTFMove(bufferClone), 0, bufferView->length())));
     }
 
     throwTypeError(globalObject, scope, "structuredClone not implemented for non-ArrayBuffer / non-ArrayBufferView"_s);
@@ -771,7 +771,7 @@ void WebSocket::didReceiveMessage(String&& message)
 
     if (this->hasEventListeners("message"_s)) {
         // the main reason for dispatching on a separate tick is to handle when you haven't yet attached an event listener
-        dispatchEvent(MessageEvent::create(WTFMove(message), m_url.string()));
+        dispatchMessageEvent(WTFMove(message));
         return;
     }
 
@@ -779,7 +779,7 @@ void WebSocket::didReceiveMessage(String&& message)
         this->incPendingActivityCount();
         context->postTask([this, message_ = WTFMove(message), protectedThis = Ref { *this }](ScriptExecutionContext& context) {
             ASSERT(scriptExecutionContext());
-            protectedThis->dispatchEvent(MessageEvent::create(message_, protectedThis->m_url.string()));
+            protectedThis->dispatchMessageEvent(String { message_ });
             protectedThis->decPendingActivityCount();
         });
     }
@@ -787,6 +787,28 @@ void WebSocket::didReceiveMessage(String&& message)
     // });
 }
 
+// Reuses the last message event once nothing can observe it anymore: it never
+// got a JS wrapper and no listener kept a reference to it. That holds for
+// messages dispatched while only native listeners, or none, are attached, such
+// as those queued before the first JS listener. An event a JS listener saw has
+// a wrapper and is left to the GC.
+void WebSocket::dispatchMessageEvent(MessageEvent::DataType&& data)
+{
+    RefPtr<MessageEvent> event = WTFMove(m_unusedMessageEvent);
+    if (event)
+        event->reuse(WTFMove(data), m_url.string());
+    else
+        event = MessageEvent::create(WTFMove(data), m_url.string());
+
+    dispatchEvent(*event);
+
+    if (event->hasOneRef() && !event->wrapper()) {
+        // Drops the message and the event's reference to this socket.
+        event->reuse(MessageEvent::JSValueTag {});
+        m_unusedMessageEvent = WTFMove(event);
+    }
+}
+
 void WebSocket::didReceiveBinaryData(Vector<uint8_t>&& binaryData)
 {
     LOG(Network, "WebSocket %p didReceiveBinaryData() %u byte binary message", this, static_cast<unsigned>(binaryData.size()));
@@ -807,7 +829,7 @@ void WebSocket::didReceiveBinaryData(Vector<uint8_t>&& binaryData)
     case BinaryType::ArrayBuffer: {
         if (this->hasEventListeners("message"_s)) {
             // the main reason for dispatching on a separate tick is to handle when you haven't yet attached an event listener
-            dispatchEvent(MessageEvent::create(ArrayBuffer::create(binaryData.data(), binaryData.size()), m_url.string()));
+            dispatchMessageEvent(ArrayBuffer::create(binaryData.data(), binaryData.size()));
             return;
         }
 
@@ -816,7 +838,7 @@ void WebSocket::didReceiveBinaryData(Vector<uint8_t>&& binaryData)
             this->incPendingActivityCount();
             context->postTask([this, buffer = WTFMove(arrayBuffer), protectedThis = Ref { *this }](ScriptExecutionContext& context) {
                 ASSERT(scriptExecutionContext());
-                protectedThis->dispatchEvent(MessageEvent::create(buffer, m_url.string()));
+                protectedThis->dispatchMessageEvent(buffer.copyRef());
                 protectedThis->decPendingActivityCount();
             });
         }
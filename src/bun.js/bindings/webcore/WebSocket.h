@@ -33,6 +33,7 @@
 #include "ContextDestructionObserver.h"
 #include "EventTarget.h"
 #include "ExceptionOr.h"
+#include "MessageEvent.h"
 #include <wtf/URL.h>
 #include <wtf/HashSet.h>
 #include <wtf/Lock.h>
@@ -137,6 +138,7 @@ private:
     void refEventTarget() final { ref(); }
     void derefEventTarget() final { deref(); }
 
+    void dispatchMessageEvent(MessageEvent::DataType&&);
     void didReceiveMessageError(unsigned short code, WTF::StringImpl::StaticStringImpl* reason);
     void didUpdateBufferedAmount(unsigned bufferedAmount);
     void didStartClosingHandshake();
@@ -177,6 +179,8 @@ private:
     size_t m_pendingActivityCount { 0 };
 
     bool m_dispatchedErrorEvent { false };
+    // A message event that no listener saw, kept for the next message.
+    RefPtr<MessageEvent> m_unusedMessageEvent;
     // RefPtr<PendingActivity<WebSocket>> m_pendingActivity;
 };
 
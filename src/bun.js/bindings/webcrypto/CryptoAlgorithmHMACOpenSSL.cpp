@@ -59,29 +59,29 @@ static std::optional<Vector<uint8_t>> calculateSignature(const EVP_MD* algorithm
     return cipherText;
 }
 
-ExceptionOr<Vector<uint8_t>> CryptoAlgorithmHMAC::platformSign(const CryptoKeyHMAC& key, const Vector<uint8_t>& data)
+ExceptionOr<Vector<uint8_t>> CryptoAlgorithmHMAC::platformSign(const CryptoKeyHMAC& key, const uint8_t* data, size_t length)
 {
     auto algorithm = digestAlgorithm(key.hashAlgorithmIdentifier());
     if (!algorithm)
         return Exception { OperationError };
 
-    auto result = calculateSignature(algorithm, key.key(), data.data(), data.size());
+    auto result = calculateSignature(algorithm, key.key(), data, length);
     if (!result)
         return Exception { OperationError };
     return WTFMove(*result);
 }
 
-ExceptionOr<bool> CryptoAlgorithmHMAC::platformVerify(const CryptoKeyHMAC& key, const Vector<uint8_t>& signature, const Vector<uint8_t>& data)
+ExceptionOr<bool> CryptoAlgorithmHMAC::platformVerify(const CryptoKeyHMAC& key, const uint8_t* signature, size_t signatureLength, const uint8_t* data, size_t length)
 {
     auto algorithm = digestAlgorithm(key.hashAlgorithmIdentifier());
     if (!algorithm)
         return Exception { OperationError };
 
-    auto expectedSignature = calculateSignature(algorithm, key.key(), data.data(), data.size());
+    auto expectedSignature = calculateSignature(algorithm, key.key(), data, length);
     if (!expectedSignature)
         return Exception { OperationError };
     // Using a constant time comparison to prevent timing attacks.
-    return signature.size() == expectedSignature->size() && !constantTimeMemcmp(expectedSignature->data(), signature.data(), expectedSignature->size());
+    return signatureLength == expectedSignature->size() && !constantTimeMemcmp(expectedSignature->data(), signature, expectedSignature->size());
 }
 
 } // namespace WebCore
@@ -40,7 +40,8 @@ public:
 private:
     CryptoAlgorithmSHA384() = default;
     CryptoAlgorithmIdentifier identifier() const final;
-    void digest(Vector<uint8_t>&&, VectorCallback&&, ExceptionCallback&&, ScriptExecutionContext&, WorkQueue&) final;
+    void digest(Vector<uint8_t>&&, VectorCallback&&, ExceptionCallback&&, ScriptExecutionContext&, CryptoWorkQueue&) final;
+    std::optional<ExceptionOr<Vector<uint8_t>>> digestInline(const uint8_t*, size_t) final;
 };
 
 } // namespace WebCore
@@ -0,0 +1,282 @@
+#include "config.h"
+#include "CryptoWorkQueue.h"
+
+#if ENABLE(WEB_CRYPTO)
+
+#include <wtf/Condition.h>
+#include <wtf/Deque.h>
+#include <wtf/Lock.h>
+#include <wtf/MonotonicTime.h>
+#include <wtf/NeverDestroyed.h>
+#include <wtf/NumberOfCores.h>
+#include <wtf/Threading.h>
+#include <wtf/text/StringToIntegerConversion.h>
+
+namespace WebCore {
+
+static constexpr unsigned maxThreadCount = 256;
+static constexpr size_t defaultInlineThreshold = 4096;
+static constexpr size_t maxCompletionBatchSize = 64;
+static constexpr Seconds maxBatchedRunTime = 100_us;
+
+// Completions a worker has produced for one context but not posted yet. A
+// worker going through a burst of small operations posts their results
+// together, which wakes the context up once and takes one CAS on its queue
+// instead of one per result.
+struct CryptoCompletionBatch {
+    ScriptExecutionContextIdentifier identifier { 0 };
+    EventLoopTaskBatch tasks;
+
+    bool isEmpty() const { return tasks.isEmpty(); }
+
+    void flush()
+    {
+        if (!tasks.isEmpty())
+            ScriptExecutionContext::postTasksTo(identifier, WTFMove(tasks));
+    }
+};
+
+static thread_local CryptoCompletionBatch* currentCompletionBatch = nullptr;
+
+class CryptoWorkerPool {
+    WTF_MAKE_NONCOPYABLE(CryptoWorkerPool);
+
+public:
+    static CryptoWorkerPool& singleton()
+    {
+        static NeverDestroyed<CryptoWorkerPool> pool;
+        return pool;
+    }
+
+    CryptoWorkerPool()
+        : m_threadCount(threadCountFromEnvironment())
+    {
+    }
+
+    unsigned threadCount() const { return m_threadCount; }
+
+    void dispatch(unsigned operation, Function<void()>&& function)
+    {
+        bool shouldSpawn = false;
+        {
+            Locker locker { m_lock };
+            m_pending[operation].append(Task { WTFMove(function), MonotonicTime::now() });
+            m_statistics[operation].pending++;
+            m_pendingTasks++;
+
+            // A woken worker only stops counting itself as idle once it runs,
+            // so back to back dispatches can all see the same sleeper. Spawn
+            // as long as there are more tasks waiting than workers to take
+            // them.
+            if (m_pendingTasks > m_idleThreads && m_spawnedThreads < m_threadCount) {
+                m_spawnedThreads++;
+                shouldSpawn = true;
+            }
+        }
+
+        if (shouldSpawn) {
+            Thread::create("Bun Crypto Worker", [this] {
+                workerLoop();
+            })->detach();
+            return;
+        }
+
+        m_condition.notifyOne();
+    }
+
+    CryptoWorkQueue::Statistics statistics(unsigned operation)
+    {
+        Locker locker { m_lock };
+        return m_statistics[operation];
+    }
+
+private:
+    struct Task {
+        Function<void()> function;
+        MonotonicTime queuedAt;
+    };
+
+    static unsigned threadCountFromEnvironment()
+    {
+        if (const char* value = getenv("BUN_CRYPTO_THREADS")) {
+            auto count = parseInteger<unsigned>(StringView::fromLatin1(value));
+            if (count && *count > 0)
+                return std::min(*count, maxThreadCount);
+        }
+
+        return std::clamp(WTF::numberOfProcessorCores(), 1, static_cast<int>(maxThreadCount));
+    }
+
+    // How many workers one operation type may occupy at once. The rest are
+    // left for the other types.
+    unsigned maxRunningPerOperation() const
+    {
+        return m_threadCount > 1 ? m_threadCount - 1 : 1;
+    }
+
+    std::optional<unsigned> takeTask(Task& task) WTF_REQUIRES_LOCK(m_lock)
+    {
+        for (unsigned i = 0; i < CryptoWorkQueue::operationCount; i++) {
+            unsigned operation = (m_nextOperation + i) % CryptoWorkQueue::operationCount;
+            if (m_pending[operation].isEmpty() || m_statistics[operation].running >= maxRunningPerOperation())
+                continue;
+
+            task = m_pending[operation].takeFirst();
+            m_nextOperation = (operation + 1) % CryptoWorkQueue::operationCount;
+            return operation;
+        }
+
+        return std::nullopt;
+    }
+
+    void workerLoop()
+    {
+        CryptoCompletionBatch completions;
+        currentCompletionBatch = &completions;
+
+        std::optional<unsigned> previousOperation;
+        Seconds previousRunTime;
+        while (true) {
+            Task task;
+            std::optional<unsigned> taken;
+            MonotonicTime startTime;
+            {
+                Locker locker { m_lock };
+                taken = takeTask(task);
+                // Completions are never held while the worker sleeps.
+                if (!taken && completions.isEmpty()) {
+                    while (!(taken = takeTask(task))) {
+                        m_idleThreads++;
+                        m_condition.wait(m_lock);
+                        m_idleThreads--;
+                    }
+                }
+
+                if (taken) {
+                    m_pendingTasks--;
+                    startTime = MonotonicTime::now();
+                    auto& statistics = m_statistics[*taken];
+                    auto waitTime = startTime - task.queuedAt;
+                    statistics.pending--;
+                    statistics.running++;
+                    statistics.peakRunning = std::max(statistics.peakRunning, statistics.running);
+                    statistics.totalWaitTime += waitTime;
+                    statistics.maxWaitTime = std::max(statistics.maxWaitTime, waitTime);
+                }
+            }
+
+            if (!taken) {
+                completions.flush();
+                continue;
+            }
+
+            // Only keep batching into a run of quick tasks of one kind, so a
+            // finished result never waits behind a slow operation.
+            if (taken != previousOperation || previousRunTime > maxBatchedRunTime)
+                completions.flush();
+
+            task.function();
+            task.function = nullptr;
+
+            previousOperation = taken;
+            previousRunTime = MonotonicTime::now() - startTime;
+
+            Locker locker { m_lock };
+            auto& statistics = m_statistics[*taken];
+            statistics.running--;
+            statistics.completed++;
+            statistics.totalRunTime += previousRunTime;
+        }
+    }
+
+    Lock m_lock;
+    Condition m_condition;
+    Deque<Task> m_pending[CryptoWorkQueue::operationCount] WTF_GUARDED_BY_LOCK(m_lock);
+    CryptoWorkQueue::Statistics m_statistics[CryptoWorkQueue::operationCount] WTF_GUARDED_BY_LOCK(m_lock);
+    unsigned m_nextOperation WTF_GUARDED_BY_LOCK(m_lock) { 0 };
+    unsigned m_spawnedThreads WTF_GUARDED_BY_LOCK(m_lock) { 0 };
+    unsigned m_idleThreads WTF_GUARDED_BY_LOCK(m_lock) { 0 };
+    size_t m_pendingTasks WTF_GUARDED_BY_LOCK(m_lock) { 0 };
+    const unsigned m_threadCount;
+};
+
+CryptoWorkQueue& CryptoWorkQueue::forOperation(Operation operation)
+{
+    static CryptoWorkQueue queues[operationCount] = {
+        CryptoWorkQueue(Operation::Encrypt),
+        CryptoWorkQueue(Operation::Decrypt),
+        CryptoWorkQueue(Operation::Sign),
+        CryptoWorkQueue(Operation::Verify),
+        CryptoWorkQueue(Operation::Digest),
+        CryptoWorkQueue(Operation::DeriveBits),
+    };
+    return queues[static_cast<unsigned>(operation)];
+}
+
+void CryptoWorkQueue::dispatch(Function<void()>&& function)
+{
+    CryptoWorkerPool::singleton().dispatch(static_cast<unsigned>(m_operation), WTFMove(function));
+}
+
+void CryptoWorkQueue::postCompletion(ScriptExecutionContextIdentifier identifier, EventLoopTask* task)
+{
+    auto* batch = currentCompletionBatch;
+    if (!batch) {
+        ScriptExecutionContext::postTaskTo(identifier, task);
+        return;
+    }
+
+    if (batch->identifier != identifier) {
+        batch->flush();
+        batch->identifier = identifier;
+    }
+    batch->tasks.append(task);
+    if (batch->tasks.size() >= maxCompletionBatchSize)
+        batch->flush();
+}
+
+size_t CryptoWorkQueue::inlineThreshold()
+{
+    static size_t threshold = [] {
+        if (const char* value = getenv("BUN_CRYPTO_INLINE_THRESHOLD")) {
+            if (auto parsed = parseInteger<size_t>(StringView::fromLatin1(value)))
+                return *parsed;
+        }
+        return defaultInlineThreshold;
+    }();
+    return threshold;
+}
+
+unsigned CryptoWorkQueue::threadCount()
+{
+    return CryptoWorkerPool::singleton().threadCount();
+}
+
+CryptoWorkQueue::Statistics CryptoWorkQueue::statistics(Operation operation)
+{
+    return CryptoWorkerPool::singleton().statistics(static_cast<unsigned>(operation));
+}
+
+ASCIILiteral CryptoWorkQueue::name(Operation operation)
+{
+    switch (operation) {
+    case Operation::Encrypt:
+        return "encrypt"_s;
+    case Operation::Decrypt:
+        return "decrypt"_s;
+    case Operation::Sign:
+        return "sign"_s;
+    case Operation::Verify:
+        return "verify"_s;
+    case Operation::Digest:
+        return "digest"_s;
+    case Operation::DeriveBits:
+        return "deriveBits"_s;
+    }
+
+    RELEASE_ASSERT_NOT_REACHED();
+}
+
+}
+
+#endif // ENABLE(WEB_CRYPTO)
@@ -0,0 +1,83 @@
+#pragma once
+
+#include "root.h"
+
+#include "ScriptExecutionContext.h"
+#include <wtf/Function.h>
+#include <wtf/Seconds.h>
+
+#if ENABLE(WEB_CRYPTO)
+
+namespace WebCore {
+
+// SubtleCrypto operations run on a pool of threads shared by every
+// ScriptExecutionContext in the process, one thread per core unless
+// BUN_CRYPTO_THREADS says otherwise.
+//
+// Each operation type has its own queue. Idle workers take from the queues in
+// turn, and one type can occupy at most all but one of the workers, so a burst
+// of slow PBKDF2 or RSA operations cannot hold up digests and HMACs queued
+// behind it.
+class CryptoWorkQueue {
+    WTF_MAKE_NONCOPYABLE(CryptoWorkQueue);
+
+public:
+    enum class Operation : uint8_t {
+        Encrypt,
+        Decrypt,
+        Sign,
+        Verify,
+        Digest,
+        DeriveBits,
+    };
+    static constexpr unsigned operationCount = 6;
+
+    static CryptoWorkQueue& forOperation(Operation);
+
+    void dispatch(Function<void()>&&);
+
+    // Posts the result of an operation back to the context that dispatched
+    // it. On a worker, results for the same context are held while the
+    // worker keeps running quick operations of the same type and posted
+    // together, at the latest before it picks up other work or goes idle.
+    template<typename Lambda, typename = typename std::enable_if<!std::is_convertible<Lambda, EventLoopTask*>::value>::type>
+    static void postCompletion(ScriptExecutionContextIdentifier identifier, Lambda&& lambda)
+    {
+        postCompletion(identifier, createEventLoopTask(std::forward<Lambda>(lambda)));
+    }
+    static void postCompletion(ScriptExecutionContextIdentifier, EventLoopTask*);
+
+    struct Statistics {
+        // Queued but not started yet
+        size_t pending { 0 };
+        size_t running { 0 };
+        // Most tasks of this operation that were running at the same time
+        size_t peakRunning { 0 };
+        uint64_t completed { 0 };
+        // Time between dispatch() and the start of the task
+        Seconds totalWaitTime;
+        Seconds maxWaitTime;
+        Seconds totalRunTime;
+    };
+
+    // Digests and HMACs over at most this many bytes are computed on the
+    // calling thread instead. Set with BUN_CRYPTO_INLINE_THRESHOLD, 0 turns
+    // it off.
+    static size_t inlineThreshold();
+
+    static unsigned threadCount();
+    static Statistics statistics(Operation);
+    static ASCIILiteral name(Operation);
+
+private:
+    explicit CryptoWorkQueue(Operation operation)
+        : m_operation(operation)
+    {
+    }
+
+    Operation m_operation;
+};
+
+}
+
+#endif // ENABLE(WEB_CRYPTO)
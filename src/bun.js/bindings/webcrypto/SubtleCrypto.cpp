@@ -58,7 +58,6 @@ using namespace JSC;
 
 SubtleCrypto::SubtleCrypto(ScriptExecutionContext* context)
     : ContextDestructionObserver(context)
-    , m_workQueue(WorkQueue::create("com.apple.WebKit.CryptoQueue"))
 {
 }
 
@@ -482,6 +481,32 @@ static Vector<uint8_t> copyToVector(BufferSource&& data)
     return { data.data(), data.length() };
 }
 
+static bool shouldRunInline(const BufferSource& data)
+{
+    return data.length() <= CryptoWorkQueue::inlineThreshold();
+}
+
+static void settlePromise(Ref<DeferredPromise>&& promise, ExceptionOr<Vector<uint8_t>>&& result)
+{
+    if (result.hasException()) {
+        rejectWithException(WTFMove(promise), result.releaseException().code());
+        return;
+    }
+
+    auto bytes = result.releaseReturnValue();
+    fulfillPromiseWithArrayBuffer(WTFMove(promise), bytes.data(), bytes.size());
+}
+
+static void settlePromise(Ref<DeferredPromise>&& promise, ExceptionOr<bool>&& result)
+{
+    if (result.hasException()) {
+        rejectWithException(WTFMove(promise), result.releaseException().code());
+        return;
+    }
+
+    promise->resolve<IDLBoolean>(result.releaseReturnValue());
+}
+
 static bool isSupportedExportKey(CryptoAlgorithmIdentifier identifier)
 {
     switch (identifier) {
@@ -579,7 +604,7 @@ void SubtleCrypto::encrypt(JSC::JSGlobalObject& state, AlgorithmIdentifier&& alg
             rejectWithException(promise.releaseNonNull(), ec);
     };
 
-    algorithm->encrypt(*params, key, WTFMove(data), WTFMove(callback), WTFMove(exceptionCallback), *scriptExecutionContext(), m_workQueue);
+    algorithm->encrypt(*params, key, WTFMove(data), WTFMove(callback), WTFMove(exceptionCallback), *scriptExecutionContext(), CryptoWorkQueue::forOperation(CryptoWorkQueue::Operation::Encrypt));
 }
 
 void SubtleCrypto::decrypt(JSC::JSGlobalObject& state, AlgorithmIdentifier&& algorithmIdentifier, CryptoKey& key, BufferSource&& dataBufferSource, Ref<DeferredPromise>&& promise)
@@ -619,7 +644,7 @@ void SubtleCrypto::decrypt(JSC::JSGlobalObject& state, AlgorithmIdentifier&& alg
             rejectWithException(promise.releaseNonNull(), ec);
     };
 
-    algorithm->decrypt(*params, key, WTFMove(data), WTFMove(callback), WTFMove(exceptionCallback), *scriptExecutionContext(), m_workQueue);
+    algorithm->decrypt(*params, key, WTFMove(data), WTFMove(callback), WTFMove(exceptionCallback), *scriptExecutionContext(), CryptoWorkQueue::forOperation(CryptoWorkQueue::Operation::Decrypt));
 }
 
 void SubtleCrypto::sign(JSC::JSGlobalObject& state, AlgorithmIdentifier&& algorithmIdentifier, CryptoKey& key, BufferSource&& dataBufferSource, Ref<DeferredPromise>&& promise)
@@ -631,8 +656,6 @@ void SubtleCrypto::sign(JSC::JSGlobalObject& state, AlgorithmIdentifier&& algori
     }
     auto params = paramsOrException.releaseReturnValue();
 
-    auto data = copyToVector(WTFMove(dataBufferSource));
-
     if (params->identifier != key.algorithmIdentifier()) {
         promise->reject(InvalidAccessError, "CryptoKey doesn't match AlgorithmIdentifier"_s);
         return;
@@ -645,6 +668,15 @@ void SubtleCrypto::sign(JSC::JSGlobalObject& state, AlgorithmIdentifier&& algori
 
     auto algorithm = CryptoAlgorithmRegistry::singleton().create(key.algorithmIdentifier());
 
+    if (shouldRunInline(dataBufferSource)) {
+        if (auto result = algorithm->signInline(*params, key, dataBufferSource.data(), dataBufferSource.length())) {
+            settlePromise(WTFMove(promise), WTFMove(*result));
+            return;
+        }
+    }
+
+    auto data = copyToVector(WTFMove(dataBufferSource));
+
     auto index = promise.ptr();
     m_pendingPromises.add(index, WTFMove(promise));
     WeakPtr weakThis { *this };
@@ -657,7 +689,7 @@ void SubtleCrypto::sign(JSC::JSGlobalObject& state, AlgorithmIdentifier&& algori
             rejectWithException(promise.releaseNonNull(), ec);
     };
 
-    algorithm->sign(*params, key, WTFMove(data), WTFMove(callback), WTFMove(exceptionCallback), *scriptExecutionContext(), m_workQueue);
+    algorithm->sign(*params, key, WTFMove(data), WTFMove(callback), WTFMove(exceptionCallback), *scriptExecutionContext(), CryptoWorkQueue::forOperation(CryptoWorkQueue::Operation::Sign));
 }
 
 void SubtleCrypto::verify(JSC::JSGlobalObject& state, AlgorithmIdentifier&& algorithmIdentifier, CryptoKey& key, BufferSource&& signatureBufferSource, BufferSource&& dataBufferSource, Ref<DeferredPromise>&& promise)
@@ -669,9 +701,6 @@ void SubtleCrypto::verify(JSC::JSGlobalObject& state, AlgorithmIdentifier&& algo
     }
     auto params = paramsOrException.releaseReturnValue();
 
-    auto signature = copyToVector(WTFMove(signatureBufferSource));
-    auto data = copyToVector(WTFMove(dataBufferSource));
-
     if (params->identifier != key.algorithmIdentifier()) {
         promise->reject(InvalidAccessError, "CryptoKey doesn't match AlgorithmIdentifier"_s);
         return;
@@ -684,6 +713,16 @@ void SubtleCrypto::verify(JSC::JSGlobalObject& state, AlgorithmIdentifier&& algo
 
     auto algorithm = CryptoAlgorithmRegistry::singleton().create(key.algorithmIdentifier());
 
+    if (shouldRunInline(dataBufferSource)) {
+        if (auto result = algorithm->verifyInline(*params, key, signatureBufferSource.data(), signatureBufferSource.length(), dataBufferSource.data(), dataBufferSource.length())) {
+            settlePromise(WTFMove(promise), WTFMove(*result));
+            return;
+        }
+    }
+
+    auto signature = copyToVector(WTFMove(signatureBufferSource));
+    auto data = copyToVector(WTFMove(dataBufferSource));
+
     auto index = promise.ptr();
     m_pendingPromises.add(index, WTFMove(promise));
     WeakPtr weakThis { *this };
@@ -696,7 +735,7 @@ void SubtleCrypto::verify(JSC::JSGlobalObject& state, AlgorithmIdentifier&& algo
             rejectWithException(promise.releaseNonNull(), ec);
     };
 
-    algorithm->verify(*params, key, WTFMove(signature), WTFMove(data), WTFMove(callback), WTFMove(exceptionCallback), *scriptExecutionContext(), m_workQueue);
+    algorithm->verify(*params, key, WTFMove(signature), WTFMove(data), WTFMove(callback), WTFMove(exceptionCallback), *scriptExecutionContext(), CryptoWorkQueue::forOperation(CryptoWorkQueue::Operation::Verify));
 }
 
 void SubtleCrypto::digest(JSC::JSGlobalObject& state, AlgorithmIdentifier&& algorithmIdentifier, BufferSource&& dataBufferSource, Ref<DeferredPromise>&& promise)
@@ -708,10 +747,17 @@ void SubtleCrypto::digest(JSC::JSGlobalObject& state, AlgorithmIdentifier&& algo
     }
     auto params = paramsOrException.releaseReturnValue();
 
-    auto data = copyToVector(WTFMove(dataBufferSource));
-
     auto algorithm = CryptoAlgorithmRegistry::singleton().create(params->identifier);
 
+    if (shouldRunInline(dataBufferSource)) {
+        if (auto result = algorithm->digestInline(dataBufferSource.data(), dataBufferSource.length())) {
+            settlePromise(WTFMove(promise), WTFMove(*result));
+            return;
+        }
+    }
+
+    auto data = copyToVector(WTFMove(dataBufferSource));
+
     auto index = promise.ptr();
     m_pendingPromises.add(index, WTFMove(promise));
     WeakPtr weakThis { *this };
@@ -724,7 +770,7 @@ void SubtleCrypto::digest(JSC::JSGlobalObject& state, AlgorithmIdentifier&& algo
             rejectWithException(promise.releaseNonNull(), ec);
     };
 
-    algorithm->digest(WTFMove(data), WTFMove(callback), WTFMove(exceptionCallback), *scriptExecutionContext(), m_workQueue);
+    algorithm->digest(WTFMove(data), WTFMove(callback), WTFMove(exceptionCallback), *scriptExecutionContext(), CryptoWorkQueue::forOperation(CryptoWorkQueue::Operation::Digest));
 }
 
 void SubtleCrypto::generateKey(JSC::JSGlobalObject& state, AlgorithmIdentifier&& algorithmIdentifier, bool extractable, Vector<CryptoKeyUsage>&& keyUsages, Ref<DeferredPromise>&& promise)
@@ -848,7 +894,7 @@ void SubtleCrypto::deriveKey(JSC::JSGlobalObject& state, AlgorithmIdentifier&& a
             rejectWithException(promise.releaseNonNull(), ec);
     };
 
-    algorithm->deriveBits(*params, baseKey, length, WTFMove(callback), WTFMove(exceptionCallback), *scriptExecutionContext(), m_workQueue);
+    algorithm->deriveBits(*params, baseKey, length, WTFMove(callback), WTFMove(exceptionCallback), *scriptExecutionContext(), CryptoWorkQueue::forOperation(CryptoWorkQueue::Operation::DeriveBits));
 }
 
 void SubtleCrypto::deriveBits(JSC::JSGlobalObject& state, AlgorithmIdentifier&& algorithmIdentifier, CryptoKey& baseKey, unsigned length, Ref<DeferredPromise>&& promise)
@@ -884,7 +930,7 @@ void SubtleCrypto::deriveBits(JSC::JSGlobalObject& state, AlgorithmIdentifier&&
             rejectWithException(promise.releaseNonNull(), ec);
     };
 
-    algorithm->deriveBits(*params, baseKey, length, WTFMove(callback), WTFMove(exceptionCallback), *scriptExecutionContext(), m_workQueue);
+    algorithm->deriveBits(*params, baseKey, length, WTFMove(callback), WTFMove(exceptionCallback), *scriptExecutionContext(), CryptoWorkQueue::forOperation(CryptoWorkQueue::Operation::DeriveBits));
 }
 
 void SubtleCrypto::importKey(JSC::JSGlobalObject& state, KeyFormat format, KeyDataVariant&& keyDataVariant, AlgorithmIdentifier&& algorithmIdentifier, bool extractable, Vector<CryptoKeyUsage>&& keyUsages, Ref<DeferredPromise>&& promise)
@@ -1021,7 +1067,7 @@ void SubtleCrypto::wrapKey(JSC::JSGlobalObject& state, KeyFormat format, CryptoK
     auto index = promise.ptr();
     m_pendingPromises.add(index, WTFMove(promise));
     WeakPtr weakThis { *this };
-    auto callback = [index, weakThis, wrapAlgorithm, wrappingKey = Ref { wrappingKey }, wrapParams = WTFMove(wrapParams), isEncryption, context, workQueue = m_workQueue](SubtleCrypto::KeyFormat format, KeyData&& key) mutable {
+    auto callback = [index, weakThis, wrapAlgorithm, wrappingKey = Ref { wrappingKey }, wrapParams = WTFMove(wrapParams), isEncryption, context](SubtleCrypto::KeyFormat format, KeyData&& key) mutable {
         if (weakThis) {
             if (auto promise = weakThis->m_pendingPromises.get(index)) {
                 Vector<uint8_t> bytes;
@@ -1057,7 +1103,7 @@ void SubtleCrypto::wrapKey(JSC::JSGlobalObject& state, KeyFormat format, CryptoK
                     return;
                 }
                 // The following operation should be performed asynchronously.
-                wrapAlgorithm->encrypt(*wrapParams, WTFMove(wrappingKey), WTFMove(bytes), WTFMove(callback), WTFMove(exceptionCallback), *context, workQueue);
+                wrapAlgorithm->encrypt(*wrapParams, WTFMove(wrappingKey), WTFMove(bytes), WTFMove(callback), WTFMove(exceptionCallback), *context, CryptoWorkQueue::forOperation(CryptoWorkQueue::Operation::Encrypt));
             }
         }
     };
@@ -1185,7 +1231,7 @@ void SubtleCrypto::unwrapKey(JSC::JSGlobalObject& state, KeyFormat format, Buffe
         return;
     }
 
-    unwrapAlgorithm->decrypt(*unwrapParams, unwrappingKey, WTFMove(wrappedKey), WTFMove(callback), WTFMove(exceptionCallback), *scriptExecutionContext(), m_workQueue);
+    unwrapAlgorithm->decrypt(*unwrapParams, unwrappingKey, WTFMove(wrappedKey), WTFMove(callback), WTFMove(exceptionCallback), *scriptExecutionContext(), CryptoWorkQueue::forOperation(CryptoWorkQueue::Operation::Decrypt));
 }
 
 }
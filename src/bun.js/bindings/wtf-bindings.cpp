@@ -1,6 +1,7 @@
 #include "wtf-bindings.h"
-#include "wtf/text/Base64.h"
+#include "BunBase64.h"
 
+#include "JavaScriptCore/ExceptionHelpers.h"
 #include "wtf/StackTrace.h"
 
 extern "C" void WTF__copyLCharsFromUCharSource(LChar* destination, const UChar* source, size_t length)
@@ -8,11 +9,49 @@ extern "C" void WTF__copyLCharsFromUCharSource(LChar* destination, const UChar*
     WTF::StringImpl::copyCharacters(destination, source, length);
 }
 
+static JSC::EncodedJSValue toBase64StringValue(const uint8_t* bytes, size_t length, JSC::JSGlobalObject* globalObject, Bun::Base64::Alphabet alphabet)
+{
+    auto& vm = globalObject->vm();
+    auto scope = DECLARE_THROW_SCOPE(vm);
+    size_t encodedLength = Bun::Base64::encodedLength(length, alphabet);
+    if (encodedLength == 0)
+        return JSC::JSValue::encode(JSC::jsEmptyString(vm));
+
+    // Encode straight into the string's buffer instead of copying a Vector
+    LChar* data = nullptr;
+    auto impl = encodedLength <= WTF::StringImpl::MaxLength ? WTF::StringImpl::tryCreateUninitialized(encodedLength, data) : nullptr;
+    if (UNLIKELY(!impl)) {
+        JSC::throwOutOfMemoryError(globalObject, scope);
+        return JSC::JSValue::encode({});
+    }
+
+    Bun::Base64::encode(data, bytes, length, alphabet);
+    return JSC::JSValue::encode(JSC::jsString(vm, WTF::String(WTFMove(impl))));
+}
+
+extern "C" JSC::EncodedJSValue WTF__toBase64StringValue(const uint8_t* bytes, size_t length, JSC::JSGlobalObject* globalObject)
+{
+    return toBase64StringValue(bytes, length, globalObject, Bun::Base64::Alphabet::Standard);
+}
+
 extern "C" JSC::EncodedJSValue WTF__toBase64URLStringValue(const uint8_t* bytes, size_t length, JSC::JSGlobalObject* globalObject)
 {
-    WTF::String string = WTF::base64URLEncodeToString(reinterpret_cast<const LChar*>(bytes), static_cast<unsigned int>(length));
-    string.impl()->ref();
-    return JSC::JSValue::encode(JSC::jsString(globalObject->vm(), string));
+    return toBase64StringValue(bytes, length, globalObject, Bun::Base64::Alphabet::URL);
+}
+
+extern "C" size_t WTF__base64DecodedLength(const void* source, size_t length, bool is16Bit)
+{
+    if (is16Bit)
+        return Bun::Base64::decodedLength(reinterpret_cast<const UChar*>(source), length);
+    return Bun::Base64::decodedLength(reinterpret_cast<const LChar*>(source), length);
+}
+
+extern "C" size_t WTF__base64Decode(uint8_t* destination, size_t destinationLength, const void* source, size_t length, bool is16Bit, bool isURL)
+{
+    auto alphabet = isURL ? Bun::Base64::Alphabet::URL : Bun::Base64::Alphabet::Standard;
+    if (is16Bit)
+        return Bun::Base64::decode(destination, destinationLength, reinterpret_cast<const UChar*>(source), length, alphabet);
+    return Bun::Base64::decode(destination, destinationLength, reinterpret_cast<const LChar*>(source), length, alphabet);
 }
 
 extern "C" void Bun__crashReportWrite(void* ctx, const char* message, size_t length);
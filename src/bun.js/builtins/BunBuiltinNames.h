@@ -54,6 +54,7 @@ using namespace JSC;
     macro(byobRequest) \
     macro(cancel) \
     macro(cancelAlgorithm) \
+    macro(capturedStackTrace) \
     macro(chdir) \
     macro(cloneArrayBuffer) \
     macro(close) \
@@ -91,6 +92,7 @@ using namespace JSC;
     macro(encoding) \
     macro(end) \
     macro(errno) \
+    macro(error) \
     macro(errorSteps) \
     macro(execArgv) \
     macro(extname) \
@@ -129,7 +131,6 @@ using namespace JSC;
     macro(isDisturbed) \
     macro(isPaused) \
     macro(isSecureContext) \
-    macro(isWindows) \
     macro(join) \
     macro(kind) \
     macro(lazy) \
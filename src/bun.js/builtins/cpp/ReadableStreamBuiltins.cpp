@@ -535,7 +535,7 @@ const char* const s_readableStreamPipeToCode =
 const JSC::ConstructAbility s_readableStreamTeeCodeConstructAbility = JSC::ConstructAbility::CannotConstruct;
 const JSC::ConstructorKind s_readableStreamTeeCodeConstructorKind = JSC::ConstructorKind::None;
 const JSC::ImplementationVisibility s_readableStreamTeeCodeImplementationVisibility = JSC::ImplementationVisibility::Public;
-const int s_readableStreamTeeCodeLength = 175;
+const int s_readableStreamTeeCodeLength = 411;
 static const JSC::Intrinsic s_readableStreamTeeCodeIntrinsic = JSC::NoIntrinsic;
 const char* const s_readableStreamTeeCode =
     "(function ()\n" \
@@ -545,7 +545,14 @@ const char* const s_readableStreamTeeCode =
     "    if (!@isReadableStream(this))\n" \
     "        throw @makeThisTypeError(\"ReadableStream\", \"tee\");\n" \
     "\n" \
-    "    return @readableStreamTee(this, false);\n" \
+    "    //\n" \
+    "    //\n" \
+    "    const options = arguments[0];\n" \
+    "    var highWaterMark = @undefined;\n" \
+    "    if (@isObject(options) && options.highWaterMark !== @undefined)\n" \
+    "        highWaterMark = @extractHighWaterMark(options, @undefined);\n" \
+    "\n" \
+    "    return @readableStreamTee(this, false, highWaterMark);\n" \
     "})\n" \
 ;
 
@@ -746,14 +746,15 @@ const char* const s_readableStreamInternalsPipeToFinalizeCode =
 const JSC::ConstructAbility s_readableStreamInternalsReadableStreamTeeCodeConstructAbility = JSC::ConstructAbility::CannotConstruct;
 const JSC::ConstructorKind s_readableStreamInternalsReadableStreamTeeCodeConstructorKind = JSC::ConstructorKind::None;
 const JSC::ImplementationVisibility s_readableStreamInternalsReadableStreamTeeCodeImplementationVisibility = JSC::ImplementationVisibility::Public;
-const int s_readableStreamInternalsReadableStreamTeeCodeLength = 1839;
+const int s_readableStreamInternalsReadableStreamTeeCodeLength = 2454;
 static const JSC::Intrinsic s_readableStreamInternalsReadableStreamTeeCodeIntrinsic = JSC::NoIntrinsic;
 const char* const s_readableStreamInternalsReadableStreamTeeCode =
-    "(function (stream, shouldClone) {\n" \
+    "(function (stream, shouldClone, highWaterMark) {\n" \
     "  \"use strict\";\n" \
     "\n" \
     "  @assert(@isReadableStream(stream));\n" \
     "  @assert(typeof shouldClone === \"boolean\");\n" \
+    "  @assert(highWaterMark === @undefined || typeof highWaterMark === \"number\");\n" \
     "\n" \
     "  var start_ = @getByIdDirectPrivate(stream, \"start\");\n" \
     "  if (start_) {\n" \
@@ -769,6 +770,7 @@ const char* const s_readableStreamInternalsReadableStreamTeeCode =
     "    canceled2: false,\n" \
     "    reason1: @undefined,\n" \
     "    reason2: @undefined,\n" \
+    "    highWaterMark,\n" \
     "  };\n" \
     "\n" \
     "  teeState.cancelPromiseCapability = @newPromiseCapability(@Promise);\n" \
@@ -795,8 +797,22 @@ const char* const s_readableStreamInternalsReadableStreamTeeCode =
     "    @readableStreamTeeBranch2CancelFunction(teeState, stream)\n" \
     "  );\n" \
     "\n" \
-    "  const branch1 = new @ReadableStream(branch1Source);\n" \
-    "  const branch2 = new @ReadableStream(branch2Source);\n" \
+    "  //\n" \
+    "  //\n" \
+    "  //\n" \
+    "  //\n" \
+    "  var branch1Strategy, branch2Strategy;\n" \
+    "  if (highWaterMark !== @undefined) {\n" \
+    "    branch1Strategy = {};\n" \
+    "    @putByIdDirectPrivate(branch1Strategy, \"size\", @readableStreamTeeChunkSize);\n" \
+    "    @putByIdDirectPrivate(branch1Strategy, \"highWaterMark\", highWaterMark);\n" \
+    "    branch2Strategy = {};\n" \
+    "    @putByIdDirectPrivate(branch2Strategy, \"size\", @readableStreamTeeChunkSize);\n" \
+    "    @putByIdDirectPrivate(branch2Strategy, \"highWaterMark\", highWaterMark);\n" \
+    "  }\n" \
+    "\n" \
+    "  const branch1 = new @ReadableStream(branch1Source, branch1Strategy);\n" \
+    "  const branch2 = new @ReadableStream(branch2Source, branch2Strategy);\n" \
     "\n" \
     "  @getByIdDirectPrivate(reader, \"closedPromiseCapability\").@promise.@then(\n" \
     "    @undefined,\n" \
@@ -824,16 +840,73 @@ const char* const s_readableStreamInternalsReadableStreamTeeCode =
     "})\n" \
 ;
 
+const JSC::ConstructAbility s_readableStreamInternalsReadableStreamTeeChunkSizeCodeConstructAbility = JSC::ConstructAbility::CannotConstruct;
+const JSC::ConstructorKind s_readableStreamInternalsReadableStreamTeeChunkSizeCodeConstructorKind = JSC::ConstructorKind::None;
+const JSC::ImplementationVisibility s_readableStreamInternalsReadableStreamTeeChunkSizeCodeImplementationVisibility = JSC::ImplementationVisibility::Public;
+const int s_readableStreamInternalsReadableStreamTeeChunkSizeCodeLength = 193;
+static const JSC::Intrinsic s_readableStreamInternalsReadableStreamTeeChunkSizeCodeIntrinsic = JSC::NoIntrinsic;
+const char* const s_readableStreamInternalsReadableStreamTeeChunkSizeCode =
+    "(function (chunk) {\n" \
+    "  \"use strict\";\n" \
+    "\n" \
+    "  //\n" \
+    "  //\n" \
+    "  if (@isObject(chunk)) {\n" \
+    "    const byteLength = chunk.byteLength;\n" \
+    "    if (typeof byteLength === \"number\") return byteLength;\n" \
+    "  }\n" \
+    "\n" \
+    "  return 1;\n" \
+    "})\n" \
+;
+
+const JSC::ConstructAbility s_readableStreamInternalsReadableStreamTeeBranchHasRoomCodeConstructAbility = JSC::ConstructAbility::CannotConstruct;
+const JSC::ConstructorKind s_readableStreamInternalsReadableStreamTeeBranchHasRoomCodeConstructorKind = JSC::ConstructorKind::None;
+const JSC::ImplementationVisibility s_readableStreamInternalsReadableStreamTeeBranchHasRoomCodeImplementationVisibility = JSC::ImplementationVisibility::Public;
+const int s_readableStreamInternalsReadableStreamTeeBranchHasRoomCodeLength = 431;
+static const JSC::Intrinsic s_readableStreamInternalsReadableStreamTeeBranchHasRoomCodeIntrinsic = JSC::NoIntrinsic;
+const char* const s_readableStreamInternalsReadableStreamTeeBranchHasRoomCode =
+    "(function (branch, canceled) {\n" \
+    "  \"use strict\";\n" \
+    "\n" \
+    "  if (canceled) return true;\n" \
+    "\n" \
+    "  const desiredSize = @readableStreamDefaultControllerGetDesiredSize(\n" \
+    "    branch.@readableStreamController\n" \
+    "  );\n" \
+    "  if (desiredSize === null || desiredSize > 0) return true;\n" \
+    "\n" \
+    "  //\n" \
+    "  return (\n" \
+    "    @isReadableStreamLocked(branch) &&\n" \
+    "    !!@getByIdDirectPrivate(\n" \
+    "      @getByIdDirectPrivate(branch, \"reader\"),\n" \
+    "      \"readRequests\"\n" \
+    "    )?.isNotEmpty()\n" \
+    "  );\n" \
+    "})\n" \
+;
+
 const JSC::ConstructAbility s_readableStreamInternalsReadableStreamTeePullFunctionCodeConstructAbility = JSC::ConstructAbility::CannotConstruct;
 const JSC::ConstructorKind s_readableStreamInternalsReadableStreamTeePullFunctionCodeConstructorKind = JSC::ConstructorKind::None;
 const JSC::ImplementationVisibility s_readableStreamInternalsReadableStreamTeePullFunctionCodeImplementationVisibility = JSC::ImplementationVisibility::Public;
-const int s_readableStreamInternalsReadableStreamTeePullFunctionCodeLength = 1336;
+const int s_readableStreamInternalsReadableStreamTeePullFunctionCodeLength = 1623;
 static const JSC::Intrinsic s_readableStreamInternalsReadableStreamTeePullFunctionCodeIntrinsic = JSC::NoIntrinsic;
 const char* const s_readableStreamInternalsReadableStreamTeePullFunctionCode =
     "(function (teeState, reader, shouldClone) {\n" \
     "  \"use strict\";\n" \
     "\n" \
     "  return function () {\n" \
+    "    //\n" \
+    "    //\n" \
+    "    if (\n" \
+    "      teeState.highWaterMark !== @undefined &&\n" \
+    "      !teeState.closedOrErrored &&\n" \
+    "      (!@readableStreamTeeBranchHasRoom(teeState.branch1, teeState.canceled1) ||\n" \
+    "        !@readableStreamTeeBranchHasRoom(teeState.branch2, teeState.canceled2))\n" \
+    "    )\n" \
+    "      return;\n" \
+    "\n" \
     "    @Promise.prototype.@then.@call(\n" \
     "      @readableStreamDefaultReaderRead(reader),\n" \
     "      function (result) {\n" \
@@ -143,6 +143,16 @@ extern const int s_readableStreamInternalsReadableStreamTeeCodeLength;
 extern const JSC::ConstructAbility s_readableStreamInternalsReadableStreamTeeCodeConstructAbility;
 extern const JSC::ConstructorKind s_readableStreamInternalsReadableStreamTeeCodeConstructorKind;
 extern const JSC::ImplementationVisibility s_readableStreamInternalsReadableStreamTeeCodeImplementationVisibility;
+extern const char* const s_readableStreamInternalsReadableStreamTeeChunkSizeCode;
+extern const int s_readableStreamInternalsReadableStreamTeeChunkSizeCodeLength;
+extern const JSC::ConstructAbility s_readableStreamInternalsReadableStreamTeeChunkSizeCodeConstructAbility;
+extern const JSC::ConstructorKind s_readableStreamInternalsReadableStreamTeeChunkSizeCodeConstructorKind;
+extern const JSC::ImplementationVisibility s_readableStreamInternalsReadableStreamTeeChunkSizeCodeImplementationVisibility;
+extern const char* const s_readableStreamInternalsReadableStreamTeeBranchHasRoomCode;
+extern const int s_readableStreamInternalsReadableStreamTeeBranchHasRoomCodeLength;
+extern const JSC::ConstructAbility s_readableStreamInternalsReadableStreamTeeBranchHasRoomCodeConstructAbility;
+extern const JSC::ConstructorKind s_readableStreamInternalsReadableStreamTeeBranchHasRoomCodeConstructorKind;
+extern const JSC::ImplementationVisibility s_readableStreamInternalsReadableStreamTeeBranchHasRoomCodeImplementationVisibility;
 extern const char* const s_readableStreamInternalsReadableStreamTeePullFunctionCode;
 extern const int s_readableStreamInternalsReadableStreamTeePullFunctionCodeLength;
 extern const JSC::ConstructAbility s_readableStreamInternalsReadableStreamTeePullFunctionCodeConstructAbility;
@@ -388,7 +398,9 @@ extern const JSC::ImplementationVisibility s_readableStreamInternalsReadableStre
     macro(pipeToShutdownWithAction, readableStreamInternalsPipeToShutdownWithAction, 2) \
     macro(pipeToShutdown, readableStreamInternalsPipeToShutdown, 1) \
     macro(pipeToFinalize, readableStreamInternalsPipeToFinalize, 1) \
-    macro(readableStreamTee, readableStreamInternalsReadableStreamTee, 2) \
+    macro(readableStreamTee, readableStreamInternalsReadableStreamTee, 3) \
+    macro(readableStreamTeeChunkSize, readableStreamInternalsReadableStreamTeeChunkSize, 1) \
+    macro(readableStreamTeeBranchHasRoom, readableStreamInternalsReadableStreamTeeBranchHasRoom, 2) \
     macro(readableStreamTeePullFunction, readableStreamInternalsReadableStreamTeePullFunction, 3) \
     macro(readableStreamTeeBranch1CancelFunction, readableStreamInternalsReadableStreamTeeBranch1CancelFunction, 2) \
     macro(readableStreamTeeBranch2CancelFunction, readableStreamInternalsReadableStreamTeeBranch2CancelFunction, 2) \
@@ -454,6 +466,8 @@ extern const JSC::ImplementationVisibility s_readableStreamInternalsReadableStre
 #define WEBCORE_BUILTIN_READABLESTREAMINTERNALS_PIPETOSHUTDOWN 1
 #define WEBCORE_BUILTIN_READABLESTREAMINTERNALS_PIPETOFINALIZE 1
 #define WEBCORE_BUILTIN_READABLESTREAMINTERNALS_READABLESTREAMTEE 1
+#define WEBCORE_BUILTIN_READABLESTREAMINTERNALS_READABLESTREAMTEECHUNKSIZE 1
+#define WEBCORE_BUILTIN_READABLESTREAMINTERNALS_READABLESTREAMTEEBRANCHHASROOM 1
 #define WEBCORE_BUILTIN_READABLESTREAMINTERNALS_READABLESTREAMTEEPULLFUNCTION 1
 #define WEBCORE_BUILTIN_READABLESTREAMINTERNALS_READABLESTREAMTEEBRANCH1CANCELFUNCTION 1
 #define WEBCORE_BUILTIN_READABLESTREAMINTERNALS_READABLESTREAMTEEBRANCH2CANCELFUNCTION 1
@@ -520,6 +534,8 @@ extern const JSC::ImplementationVisibility s_readableStreamInternalsReadableStre
     macro(readableStreamInternalsPipeToShutdownCode, pipeToShutdown, ASCIILiteral(), s_readableStreamInternalsPipeToShutdownCodeLength) \
     macro(readableStreamInternalsPipeToFinalizeCode, pipeToFinalize, ASCIILiteral(), s_readableStreamInternalsPipeToFinalizeCodeLength) \
     macro(readableStreamInternalsReadableStreamTeeCode, readableStreamTee, ASCIILiteral(), s_readableStreamInternalsReadableStreamTeeCodeLength) \
+    macro(readableStreamInternalsReadableStreamTeeChunkSizeCode, readableStreamTeeChunkSize, ASCIILiteral(), s_readableStreamInternalsReadableStreamTeeChunkSizeCodeLength) \
+    macro(readableStreamInternalsReadableStreamTeeBranchHasRoomCode, readableStreamTeeBranchHasRoom, ASCIILiteral(), s_readableStreamInternalsReadableStreamTeeBranchHasRoomCodeLength) \
     macro(readableStreamInternalsReadableStreamTeePullFunctionCode, readableStreamTeePullFunction, ASCIILiteral(), s_readableStreamInternalsReadableStreamTeePullFunctionCodeLength) \
     macro(readableStreamInternalsReadableStreamTeeBranch1CancelFunctionCode, readableStreamTeeBranch1CancelFunction, ASCIILiteral(), s_readableStreamInternalsReadableStreamTeeBranch1CancelFunctionCodeLength) \
     macro(readableStreamInternalsReadableStreamTeeBranch2CancelFunctionCode, readableStreamTeeBranch2CancelFunction, ASCIILiteral(), s_readableStreamInternalsReadableStreamTeeBranch2CancelFunctionCodeLength) \
@@ -626,6 +642,8 @@ extern const JSC::ImplementationVisibility s_readableStreamInternalsReadableStre
     macro(readableStreamTee) \
     macro(readableStreamTeeBranch1CancelFunction) \
     macro(readableStreamTeeBranch2CancelFunction) \
+    macro(readableStreamTeeBranchHasRoom) \
+    macro(readableStreamTeeChunkSize) \
     macro(readableStreamTeePullFunction) \
     macro(readableStreamToArrayBufferDirect) \
     macro(readableStreamToArrayDirect) \
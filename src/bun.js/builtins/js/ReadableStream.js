@@ -432,7 +432,14 @@ function tee()
     if (!@isReadableStream(this))
         throw @makeThisTypeError("ReadableStream", "tee");
 
-    return @readableStreamTee(this, false);
+    // Non-standard: tee({ highWaterMark }) bounds, in bytes for byte chunks, how
+    // far the faster branch may read ahead of the slower one.
+    const options = arguments[0];
+    var highWaterMark = @undefined;
+    if (@isObject(options) && options.highWaterMark !== @undefined)
+        highWaterMark = @extractHighWaterMark(options, @undefined);
+
+    return @readableStreamTee(this, false, highWaterMark);
 }
 
 @getter
@@ -598,11 +598,12 @@ function pipeToFinalize(pipeState) {
   else pipeState.promiseCapability.@resolve.@call();
 }
 
-function readableStreamTee(stream, shouldClone) {
+function readableStreamTee(stream, shouldClone, highWaterMark) {
   "use strict";
 
   @assert(@isReadableStream(stream));
   @assert(typeof shouldClone === "boolean");
+  @assert(highWaterMark === @undefined || typeof highWaterMark === "number");
 
   var start_ = @getByIdDirectPrivate(stream, "start");
   if (start_) {
@@ -618,6 +619,7 @@ function readableStreamTee(stream, shouldClone) {
     canceled2: false,
     reason1: @undefined,
     reason2: @undefined,
+    highWaterMark,
   };
 
   teeState.cancelPromiseCapability = @newPromiseCapability(@Promise);
@@ -644,8 +646,22 @@ function readableStreamTee(stream, shouldClone) {
     @readableStreamTeeBranch2CancelFunction(teeState, stream)
   );
 
-  const branch1 = new @ReadableStream(branch1Source);
-  const branch2 = new @ReadableStream(branch2Source);
+  // Without a highWaterMark the branches keep the spec behavior: whichever
+  // branch pulls reads from the source, and the slower branch buffers without
+  // limit. With one, both branches measure their queues in bytes so the pull
+  // function can hold off reading until the slower branch has room.
+  var branch1Strategy, branch2Strategy;
+  if (highWaterMark !== @undefined) {
+    branch1Strategy = {};
+    @putByIdDirectPrivate(branch1Strategy, "size", @readableStreamTeeChunkSize);
+    @putByIdDirectPrivate(branch1Strategy, "highWaterMark", highWaterMark);
+    branch2Strategy = {};
+    @putByIdDirectPrivate(branch2Strategy, "size", @readableStreamTeeChunkSize);
+    @putByIdDirectPrivate(branch2Strategy, "highWaterMark", highWaterMark);
+  }
+
+  const branch1 = new @ReadableStream(branch1Source, branch1Strategy);
+  const branch2 = new @ReadableStream(branch2Source, branch2Strategy);
 
   @getByIdDirectPrivate(reader, "closedPromiseCapability").@promise.@then(
     @undefined,
@@ -672,10 +688,53 @@ function readableStreamTee(stream, shouldClone) {
   return [branch1, branch2];
 }
 
+function readableStreamTeeChunkSize(chunk) {
+  "use strict";
+
+  // Byte chunks are shared between both branches, so they are accounted by
+  // their length rather than copied. Anything else counts as one unit.
+  if (@isObject(chunk)) {
+    const byteLength = chunk.byteLength;
+    if (typeof byteLength === "number") return byteLength;
+  }
+
+  return 1;
+}
+
+function readableStreamTeeBranchHasRoom(branch, canceled) {
+  "use strict";
+
+  if (canceled) return true;
+
+  const desiredSize = @readableStreamDefaultControllerGetDesiredSize(
+    branch.@readableStreamController
+  );
+  if (desiredSize === null || desiredSize > 0) return true;
+
+  // A pending read is room too, otherwise a highWaterMark of 0 never pulls.
+  return (
+    @isReadableStreamLocked(branch) &&
+    !!@getByIdDirectPrivate(
+      @getByIdDirectPrivate(branch, "reader"),
+      "readRequests"
+    )?.isNotEmpty()
+  );
+}
+
 function readableStreamTeePullFunction(teeState, reader, shouldClone) {
   "use strict";
 
   return function () {
+    // Keep the next chunk upstream until the slower branch drains below its
+    // highWaterMark. That branch pulls again once it has room.
+    if (
+      teeState.highWaterMark !== @undefined &&
+      !teeState.closedOrErrored &&
+      (!@readableStreamTeeBranchHasRoom(teeState.branch1, teeState.canceled1) ||
+        !@readableStreamTeeBranchHasRoom(teeState.branch2, teeState.canceled2))
+    )
+      return;
+
     @Promise.prototype.@then.@call(
       @readableStreamDefaultReaderRead(reader),
       function (result) {
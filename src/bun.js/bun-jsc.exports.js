@@ -1,6 +1,7 @@
 const jsc = globalThis[Symbol.for("Bun.lazy")]("bun:jsc");
 
 export const callerSourceOrigin = jsc.callerSourceOrigin;
+export const cryptoQueueStats = jsc.cryptoQueueStats;
 export const describe = jsc.describe;
 export const describeArray = jsc.describeArray;
 export const drainMicrotasks = jsc.drainMicrotasks;
@@ -14,6 +15,7 @@ export const startSamplingProfiler = jsc.startSamplingProfiler;
 export const samplingProfilerStackTraces = jsc.samplingProfilerStackTraces;
 export const isRope = jsc.isRope;
 export const memoryUsage = jsc.memoryUsage;
+export const napiThreadsafeFunctionStats = jsc.napiThreadsafeFunctionStats;
 export const noInline = jsc.noInline;
 export const noFTL = jsc.noFTL;
 export const noOSRExitFuzzing = jsc.noOSRExitFuzzing;
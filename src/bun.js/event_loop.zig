@@ -409,6 +409,10 @@ pub const EventLoop = struct {
                     var any: *AnyTask = task.get(AnyTask).?;
                     any.run();
                 },
+                @field(Task.Tag, typeBaseName(@typeName(ThreadSafeFunction))) => {
+                    var tsfn: *ThreadSafeFunction = task.get(ThreadSafeFunction).?;
+                    tsfn.call();
+                },
                 @field(Task.Tag, typeBaseName(@typeName(CppTask))) => {
                     var any: *CppTask = task.get(CppTask).?;
                     any.run(global);
@@ -1505,7 +1505,7 @@ pub const Path = struct {
         const out = if (isWindows)
             std.fs.path.dirnameWindows(base_slice) orelse "C:\\"
         else
-            std.fs.path.dirnamePosix(base_slice) orelse "/";
+            std.fs.path.dirnamePosix(base_slice) orelse (if (base_slice.len > 0 and base_slice[0] == '/') "/" else ".");
 
         return JSC.ZigString.init(out).toValueGC(globalThis);
     }
@@ -1,26 +1,28 @@
-function bound(obj) {
+// The native functions have the platform baked in and don't depend on
+// `this`, so they can be exported as-is without binding.
+function exportsOf(obj) {
   var result = {
-    basename: obj.basename.bind(obj),
-    dirname: obj.dirname.bind(obj),
-    extname: obj.extname.bind(obj),
-    format: obj.format.bind(obj),
-    isAbsolute: obj.isAbsolute.bind(obj),
-    join: obj.join.bind(obj),
-    normalize: obj.normalize.bind(obj),
-    parse: obj.parse.bind(obj),
-    relative: obj.relative.bind(obj),
-    resolve: obj.resolve.bind(obj),
-    toNamespacedPath: obj.toNamespacedPath.bind(obj),
+    basename: obj.basename,
+    dirname: obj.dirname,
+    extname: obj.extname,
+    format: obj.format,
+    isAbsolute: obj.isAbsolute,
+    join: obj.join,
+    normalize: obj.normalize,
+    parse: obj.parse,
+    relative: obj.relative,
+    resolve: obj.resolve,
+    toNamespacedPath: obj.toNamespacedPath,
     sep: obj.sep,
     delimiter: obj.delimiter,
   };
   result.default = result;
   return result;
 }
-var path = bound(Bun._Path());
+var path = exportsOf(Bun._Path());
 
-export var posix = bound(Bun._Path(false));
-export var win32 = bound(Bun._Path(true));
+export var posix = exportsOf(Bun._Path(false));
+export var win32 = exportsOf(Bun._Path(true));
 
 path.win32 = win32;
 path.posix = posix;
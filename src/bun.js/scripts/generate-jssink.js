@@ -737,6 +737,7 @@ void ${prototypeName}::finishCreation(JSC::VM& vm, JSC::JSGlobalObject* globalOb
     Base::finishCreation(vm);
     reifyStaticProperties(vm, ${className}::info(), ${className}PrototypeTableValues, *this);
     putDirect(vm, JSC::Identifier::fromString(vm, "sinkId"_s), JSC::jsNumber(${className}::Sink), JSC::PropertyAttribute::ReadOnly | JSC::PropertyAttribute::DontEnum);
+    putDirectNativeFunction(vm, globalObject, JSC::Identifier::fromString(vm, "writeJSON"_s), 1, ${name}__writeJSON, ImplementationVisibility::Public, NoIntrinsic, JSC::PropertyAttribute::ReadOnly | JSC::PropertyAttribute::DontDelete | 0);
     JSC_TO_STRING_TAG_WITHOUT_TRANSITION();
 }
 
@@ -745,6 +746,7 @@ void ${controllerPrototypeName}::finishCreation(JSC::VM& vm, JSC::JSGlobalObject
     Base::finishCreation(vm);
     reifyStaticProperties(vm, ${controller}::info(), ${controller}PrototypeTableValues, *this);
     putDirect(vm, JSC::Identifier::fromString(vm, "sinkId"_s), JSC::jsNumber(${className}::Sink), JSC::PropertyAttribute::ReadOnly | JSC::PropertyAttribute::DontEnum);
+    putDirectNativeFunction(vm, globalObject, JSC::Identifier::fromString(vm, "writeJSON"_s), 1, ${name}__writeJSON, ImplementationVisibility::Public, NoIntrinsic, JSC::PropertyAttribute::ReadOnly | JSC::PropertyAttribute::DontDelete | 0);
     JSC_TO_STRING_TAG_WITHOUT_TRANSITION();
 }
 
@@ -910,10 +910,7 @@ pub const Encoder = struct {
             },
 
             JSC.Node.Encoding.base64 => {
-                const to_len = bun.base64.encodeLen(input);
-                var to = allocator.alloc(u8, to_len) catch return ZigString.init("Out of memory").toErrorInstance(global);
-                const wrote = bun.base64.encode(to, input);
-                return ZigString.init(to[0..wrote]).toExternalValue(global);
+                return JSC.WTF.toBase64StringValue(input, global);
             },
         }
     }
@@ -971,23 +968,8 @@ pub const Encoder = struct {
                 return @intCast(i64, strings.decodeHexToBytes(to[0..to_len], u8, input[0..len]));
             },
 
-            JSC.Node.Encoding.base64url => {
-                var slice = strings.trim(input[0..len], "\r\n\t " ++ [_]u8{std.ascii.control_code.VT});
-                if (slice.len == 0)
-                    return 0;
-
-                if (strings.eqlComptime(slice[slice.len - 2 ..][0..2], "==")) {
-                    slice = slice[0 .. slice.len - 2];
-                } else if (slice[slice.len - 1] == '=') {
-                    slice = slice[0 .. slice.len - 1];
-                }
-
-                const wrote = bun.base64.decodeURLSafe(to[0..to_len], slice).written;
-                return @intCast(i64, wrote);
-            },
-
-            JSC.Node.Encoding.base64 => {
-                return @intCast(i64, bun.base64.decode(to[0..to_len], input[0..len]).written);
+            JSC.Node.Encoding.base64, JSC.Node.Encoding.base64url => {
+                return @intCast(i64, JSC.WTF.base64Decode(u8, to[0..to_len], input[0..len], encoding == .base64url));
             },
             // else => return 0,
         }
@@ -1015,7 +997,7 @@ pub const Encoder = struct {
             },
 
             JSC.Node.Encoding.base64, JSC.Node.Encoding.base64url => {
-                return bun.base64.encodeLen(input[0..len]);
+                return JSC.WTF.base64DecodedLength(u8, input[0..len]);
             },
             // else => return &[_]u8{};
         }
@@ -1041,14 +1023,7 @@ pub const Encoder = struct {
             },
 
             JSC.Node.Encoding.base64, JSC.Node.Encoding.base64url => {
-                if (to_len < 2 or len == 0)
-                    return 0;
-
-                // very very slow case!
-                // shouldn't really happen though
-                var transcoded = strings.toUTF8Alloc(bun.default_allocator, input[0..len]) catch return 0;
-                defer bun.default_allocator.free(transcoded);
-                return writeU8(transcoded.ptr, transcoded.len, to, to_len, encoding);
+                return @intCast(i64, JSC.WTF.base64Decode(u16, to[0..to_len], input[0..len], encoding == .base64url));
             },
             // else => return &[_]u8{};
         }
@@ -1074,7 +1049,7 @@ pub const Encoder = struct {
             },
 
             JSC.Node.Encoding.base64, JSC.Node.Encoding.base64url => {
-                return bun.base64.encodeLen(input[0..len]);
+                return JSC.WTF.base64DecodedLength(u16, input[0..len]);
             },
             // else => return &[_]u8{};
         }
@@ -1120,29 +1095,10 @@ pub const Encoder = struct {
                 return to[0..strings.decodeHexToBytes(to, u8, input[0..len])];
             },
 
-            JSC.Node.Encoding.base64url => {
-                var slice = strings.trim(input[0..len], "\r\n\t " ++ [_]u8{std.ascii.control_code.VT});
-                if (slice.len == 0)
-                    return &[_]u8{};
-
-                if (strings.eqlComptime(slice[slice.len - 2 ..][0..2], "==")) {
-                    slice = slice[0 .. slice.len - 2];
-                } else if (slice[slice.len - 1] == '=') {
-                    slice = slice[0 .. slice.len - 1];
-                }
-
-                const to_len = bun.base64.urlsafe.decoder.calcSizeForSlice(slice) catch unreachable;
-                var to = allocator.alloc(u8, to_len) catch return &[_]u8{};
-                const wrote = bun.base64.decodeURLSafe(to[0..to_len], slice).written;
-                return to[0..wrote];
-            },
-
-            JSC.Node.Encoding.base64 => {
-                var slice = strings.trim(input[0..len], "\r\n\t " ++ [_]u8{std.ascii.control_code.VT});
-                var outlen = bun.base64.decodeLen(slice);
-
+            JSC.Node.Encoding.base64, JSC.Node.Encoding.base64url => {
+                const outlen = JSC.WTF.base64DecodedLength(u8, input[0..len]);
                 var to = allocator.alloc(u8, outlen) catch return &[_]u8{};
-                const written = bun.base64.decode(to[0..outlen], slice).written;
+                const written = JSC.WTF.base64Decode(u8, to, input[0..len], encoding == .base64url);
                 return to[0..written];
             },
             // else => return 0,
@@ -1180,21 +1136,11 @@ pub const Encoder = struct {
                 return to[0..strings.decodeHexToBytes(to, u16, input[0..len])];
             },
 
-            JSC.Node.Encoding.base64 => {
-                // very very slow case!
-                // shouldn't really happen though
-                var transcoded = strings.toUTF8Alloc(allocator, input[0..len]) catch return &[_]u8{};
-                defer allocator.free(transcoded);
-                return constructFromU8(transcoded.ptr, transcoded.len, .base64);
-            },
-
-            JSC.Node.Encoding.base64url => {
-
-                // very very slow case!
-                // shouldn't really happen though
-                var transcoded = strings.toUTF8Alloc(allocator, input[0..len]) catch return &[_]u8{};
-                defer allocator.free(transcoded);
-                return constructFromU8(transcoded.ptr, transcoded.len, .base64url);
+            JSC.Node.Encoding.base64, JSC.Node.Encoding.base64url => {
+                const outlen = JSC.WTF.base64DecodedLength(u16, input[0..len]);
+                var to = allocator.alloc(u8, outlen) catch return &[_]u8{};
+                const written = JSC.WTF.base64Decode(u16, to, input[0..len], encoding == .base64url);
+                return to[0..written];
             },
             // else => return 0,
         }
@@ -328,24 +328,23 @@ pub const Response = struct {
         const json_value = args.nextEat() orelse JSC.JSValue.zero;
 
         if (@enumToInt(json_value) != 0) {
-            var zig_str = JSC.ZigString.init("");
-            // calling JSON.stringify on an empty string adds extra quotes
-            // so this is correct
-            json_value.jsonStringify(globalThis.ptr(), 0, &zig_str);
-
-            if (zig_str.len > 0) {
-                const allocator = getAllocator(globalThis);
-                var zig_str_slice = zig_str.toSlice(allocator);
-
-                if (zig_str_slice.isAllocated()) {
-                    response.body.value = .{
-                        .Blob = Blob.initWithAllASCII(zig_str_slice.mut(), allocator, globalThis.ptr(), false),
-                    };
-                } else {
-                    response.body.value = .{
-                        .Blob = Blob.initWithAllASCII(allocator.dupe(u8, zig_str_slice.slice()) catch unreachable, allocator, globalThis.ptr(), true),
-                    };
-                }
+            const allocator = getAllocator(globalThis);
+            // The UTF-8 bytes go straight into the body instead of through a
+            // string, which is UTF-16 as soon as one character is not Latin-1
+            var body = std.ArrayList(u8).init(allocator);
+            var is_all_ascii = true;
+            if (!json_value.jsonStringifyUTF8(globalThis, std.ArrayList(u8), &body, appendJSONChunk, &is_all_ascii)) {
+                body.deinit();
+                return JSValue.zero;
+            }
+
+            // JSON.stringify(undefined) writes nothing, and the body stays empty
+            if (body.items.len > 0) {
+                response.body.value = .{
+                    .Blob = Blob.initWithAllASCII(body.toOwnedSlice(), allocator, globalThis.ptr(), is_all_ascii),
+                };
+            } else {
+                body.deinit();
             }
         }
 
@@ -366,6 +365,10 @@ pub const Response = struct {
 
         return ptr.toJS(globalThis);
     }
+    fn appendJSONChunk(body: *std.ArrayList(u8), chunk: []const u8) error{OutOfMemory}!void {
+        try body.appendSlice(chunk);
+    }
+
     pub fn constructRedirect(
         globalThis: *JSC.JSGlobalObject,
         callframe: *JSC.CallFrame,
@@ -3668,24 +3671,15 @@ pub const Blob = struct {
         defer if (comptime lifetime == .temporary) bun.default_allocator.free(bun.constStrToU8(buf));
 
         if (could_be_all_ascii == null or !could_be_all_ascii.?) {
-            var stack_fallback = std.heap.stackFallback(4096, bun.default_allocator);
-            const allocator = stack_fallback.get();
-            // if toUTF16Alloc returns null, it means there are no non-ASCII characters
-            if (strings.toUTF16Alloc(allocator, buf, false) catch null) |external| {
-                if (comptime lifetime != .temporary) this.setIsASCIIFlag(false);
-                const result = ZigString.init16(external).toJSONObject(global);
-                allocator.free(external);
-                return result;
-            }
-
-            if (comptime lifetime != .temporary) this.setIsASCIIFlag(true);
+            // parsed straight from the UTF-8 bytes, without decoding them into
+            // a UTF-16 string first
+            var is_all_ascii = false;
+            const result = ZigString.initUTF8(buf).toJSONObjectCheckingASCII(global, &is_all_ascii);
+            if (comptime lifetime != .temporary) this.setIsASCIIFlag(is_all_ascii);
+            return result;
         }
 
-        if (comptime lifetime == .temporary) {
-            return ZigString.init(buf).toJSONObject(global);
-        } else {
-            return ZigString.init(buf).toJSONObject(global);
-        }
+        return ZigString.init(buf).toJSONObject(global);
     }
 
     pub fn toArrayBufferWithBytes(this: *Blob, global: *JSGlobalObject, buf: []u8, comptime lifetime: Lifetime) JSValue {
@@ -2103,6 +2103,72 @@ pub fn NewJSSink(comptime SinkType: type, comptime name_: []const u8) type {
             return this.sink.writeLatin1(.{ .temporary = str.slice() }).toJS(globalThis);
         }
 
+        /// Like `write(JSON.stringify(value))`, but the UTF-8 is handed to
+        /// the sink one chunk at a time as the serializer fills it, so a
+        /// large value never exists as a single string and a response sink
+        /// can start sending before the whole document is serialized.
+        pub fn writeJSON(globalThis: *JSGlobalObject, callframe: *JSC.CallFrame) callconv(.C) JSValue {
+            JSC.markBinding(@src());
+            var this = getThis(globalThis, callframe) orelse return invalidThis(globalThis);
+
+            if (comptime @hasDecl(SinkType, "getPendingError")) {
+                if (this.sink.getPendingError()) |err| {
+                    globalThis.vm().throwError(globalThis, err);
+                    return JSC.JSValue.jsUndefined();
+                }
+            }
+
+            const args_list = callframe.arguments(1);
+            if (args_list.len == 0) {
+                const err = JSC.toTypeError(
+                    JSC.Node.ErrorCode.ERR_MISSING_ARGS,
+                    "writeJSON() expects a value",
+                    .{},
+                    globalThis,
+                );
+                globalThis.vm().throwError(globalThis, err);
+                return JSC.JSValue.jsUndefined();
+            }
+
+            const ChunkWriter = struct {
+                sink: *SinkType,
+                written: Blob.SizeType = 0,
+                // the first result that was not a plain byte count, e.g. an
+                // error or the sink being done; later chunks are dropped
+                stopped: ?StreamResult.Writable = null,
+
+                pub fn write(writer: *@This(), chunk: []const u8) error{OutOfMemory}!void {
+                    if (writer.stopped != null) return;
+
+                    const result = writer.sink.writeBytes(.{ .temporary = bun.ByteList.init(chunk) });
+                    switch (result) {
+                        .owned, .temporary, .into_array => |len| writer.written += len,
+                        .err => |err| {
+                            if (err.getErrno() == .NOMEM) return error.OutOfMemory;
+                            writer.stopped = result;
+                        },
+                        else => writer.stopped = result,
+                    }
+                }
+            };
+
+            var writer = ChunkWriter{ .sink = &this.sink };
+            var is_all_ascii = true;
+            const arg = args_list.ptr[0];
+            arg.ensureStillAlive();
+            defer arg.ensureStillAlive();
+
+            if (!arg.jsonStringifyUTF8(globalThis, ChunkWriter, &writer, ChunkWriter.write, &is_all_ascii)) {
+                return JSC.JSValue.zero;
+            }
+
+            if (writer.stopped) |result| {
+                return result.toJS(globalThis);
+            }
+
+            return JSC.JSValue.jsNumber(writer.written);
+        }
+
         pub fn close(globalThis: *JSGlobalObject, sink_ptr: ?*anyopaque) callconv(.C) JSValue {
             JSC.markBinding(@src());
             var this = @ptrCast(*ThisSink, @alignCast(std.meta.alignment(ThisSink), sink_ptr orelse return invalidThis(globalThis)));
@@ -2228,6 +2294,7 @@ pub fn NewJSSink(comptime SinkType: type, comptime name_: []const u8) type {
             .@"construct" = construct,
             .@"endWithSink" = endWithSink,
             .@"updateRef" = updateRef,
+            .@"writeJSON" = writeJSON,
         });
 
         pub fn updateRef(ptr: *anyopaque, value: bool) callconv(.C) void {
@@ -2248,6 +2315,7 @@ pub fn NewJSSink(comptime SinkType: type, comptime name_: []const u8) type {
                 @export(construct, .{ .name = Export[6].symbol_name });
                 @export(endWithSink, .{ .name = Export[7].symbol_name });
                 @export(updateRef, .{ .name = Export[8].symbol_name });
+                @export(writeJSON, .{ .name = Export[9].symbol_name });
             }
         }
 
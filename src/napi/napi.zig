@@ -8,6 +8,7 @@ const ZigString = JSC.ZigString;
 const TODO_EXCEPTION: JSC.C.ExceptionRef = null;
 
 const Channel = @import("../sync.zig").Channel;
+const log = bun.Output.scoped(.napi, false);
 
 pub const napi_env = *JSC.JSGlobalObject;
 pub const Ref = opaque {
@@ -703,14 +704,7 @@ pub export fn napi_is_arraybuffer(_: napi_env, value: napi_value, result: *bool)
     result.* = !value.isNumber() and value.jsTypeLoose() == .ArrayBuffer;
     return .ok;
 }
-pub export fn napi_create_arraybuffer(env: napi_env, byte_length: usize, data: [*]const u8, result: *napi_value) napi_status {
-    var typed_array = JSC.C.JSObjectMakeTypedArray(env.ref(), .kJSTypedArrayTypeArrayBuffer, byte_length, TODO_EXCEPTION);
-    var array_buffer = JSValue.c(typed_array).asArrayBuffer(env) orelse return .generic_failure;
-    @memcpy(array_buffer.ptr, data, @minimum(array_buffer.len, @truncate(u32, byte_length)));
-    result.* = JSValue.c(typed_array);
-    return .ok;
-}
-
+pub extern fn napi_create_arraybuffer(env: napi_env, byte_length: usize, data: ?*?*anyopaque, result: *napi_value) napi_status;
 pub export fn napi_create_external_arraybuffer(env: napi_env, external_data: ?*anyopaque, byte_length: usize, finalize_cb: napi_finalize, finalize_hint: ?*anyopaque, result: *napi_value) napi_status {
     var external = JSC.ExternalBuffer.create(
         finalize_hint,
@@ -1035,35 +1029,9 @@ pub export fn napi_fatal_error(location_ptr: ?[*:0]const u8, location_len: usize
 
     bun.Global.panic("napi: {s}", .{message});
 }
-pub export fn napi_create_buffer(env: napi_env, length: usize, data: [*]*anyopaque, result: *napi_value) napi_status {
-    var buf = JSC.ExternalBuffer.create(null, @ptrCast([*]u8, data)[0..length], env, null, env.bunVM().allocator) catch {
-        return .generic_failure;
-    };
-
-    result.* = buf.toJS(env);
-    return .ok;
-}
-pub export fn napi_create_external_buffer(env: napi_env, length: usize, data: ?*anyopaque, finalize_cb: napi_finalize, finalize_hint: ?*anyopaque, result: *napi_value) napi_status {
-    var buf = JSC.ExternalBuffer.create(finalize_hint, @ptrCast([*]u8, data.?)[0..length], env, finalize_cb, env.bunVM().allocator) catch {
-        return .generic_failure;
-    };
-
-    result.* = buf.toJS(env);
-    return .ok;
-}
-pub export fn napi_create_buffer_copy(env: napi_env, length: usize, data: [*]u8, result_data: ?*?*anyopaque, result: *napi_value) napi_status {
-    var duped = env.bunVM().allocator.alloc(u8, length) catch {
-        return .generic_failure;
-    };
-    @memcpy(duped.ptr, data, length);
-    if (result_data) |res| {
-        res.* = duped.ptr;
-    }
-
-    result.* = JSC.JSValue.createBuffer(env, duped, env.bunVM().allocator);
-
-    return .ok;
-}
+pub extern fn napi_create_buffer(env: napi_env, length: usize, data: ?*?*anyopaque, result: *napi_value) napi_status;
+pub extern fn napi_create_external_buffer(env: napi_env, length: usize, data: ?*anyopaque, finalize_cb: napi_finalize, finalize_hint: ?*anyopaque, result: *napi_value) napi_status;
+pub extern fn napi_create_buffer_copy(env: napi_env, length: usize, data: ?*const anyopaque, result_data: ?*?*anyopaque, result: *napi_value) napi_status;
 pub export fn napi_is_buffer(env: napi_env, value: napi_value, result: *bool) napi_status {
     result.* = value.isBuffer(env);
     return .ok;
@@ -1163,6 +1131,31 @@ pub const Finalizer = struct {
     ctx: ?*anyopaque = null,
 };
 
+/// Thread-safe functions that are not finalized yet, for
+/// `napiThreadsafeFunctionStats()` in bun:jsc. Only used on the JS thread,
+/// where they are created and finalized.
+var live_threadsafe_functions: std.AutoArrayHashMapUnmanaged(*ThreadSafeFunction, void) = .{};
+/// The highest `queue_high_water` of the functions finalized so far.
+var finalized_queue_high_water: usize = 0;
+
+pub const ThreadSafeFunctionStats = extern struct {
+    functions: usize = 0,
+    queued: usize = 0,
+    queue_high_water: usize = 0,
+};
+
+pub export fn Bun__napi_threadsafeFunctionStats(out: *ThreadSafeFunctionStats) void {
+    var stats = ThreadSafeFunctionStats{
+        .functions = live_threadsafe_functions.count(),
+        .queue_high_water = finalized_queue_high_water,
+    };
+    for (live_threadsafe_functions.keys()) |function| {
+        stats.queued += function.queue_length.load(.Monotonic);
+        stats.queue_high_water = @maximum(stats.queue_high_water, function.queue_high_water.load(.Monotonic));
+    }
+    out.* = stats;
+}
+
 // TODO: generate comptime version of this instead of runtime checking
 pub const ThreadSafeFunction = struct {
     /// thread-safe functions can be "referenced" and "unreferenced". A
@@ -1183,6 +1176,20 @@ pub const ThreadSafeFunction = struct {
     concurrent_task: JSC.ConcurrentTask = .{},
     concurrent_finalizer_task: JSC.ConcurrentTask = .{},
 
+    /// Set while `concurrent_task` is queued, so that items enqueued before
+    /// the event loop gets to it share one wakeup instead of one each.
+    scheduled: std.atomic.Atomic(bool) = std.atomic.Atomic(bool).init(false),
+    /// The most items dispatched per wakeup. Whatever is left is dispatched
+    /// on the next tick, so a busy producer does not starve the event loop.
+    drain_budget: u32 = default_drain_budget,
+    /// The last thread released the function while a wakeup was pending, so
+    /// it is finalized once the queue is drained.
+    finalize_after_drain: bool = false,
+
+    /// Items enqueued but not dispatched yet, and the most there ever were.
+    queue_length: std.atomic.Atomic(usize) = std.atomic.Atomic(usize).init(0),
+    queue_high_water: std.atomic.Atomic(usize) = std.atomic.Atomic(usize).init(0),
+
     javascript_function: JSValue,
     finalizer_task: JSC.AnyTask = undefined,
     finalizer: Finalizer = Finalizer{ .fun = null, .ctx = null },
@@ -1192,7 +1199,8 @@ pub const ThreadSafeFunction = struct {
 
     call_js: ?napi_threadsafe_function_call_js = null,
 
-    const ThreadSafeFunctionTask = JSC.AnyTask.New(@This(), call);
+    pub const default_drain_budget: u32 = 1024;
+
     pub const Queue = union(enum) {
         sized: Channel(?*anyopaque, .Slice),
         unsized: Channel(?*anyopaque, .Dynamic),
@@ -1258,12 +1266,54 @@ pub const ThreadSafeFunction = struct {
                 .unsized => try this.unsized.tryReadItem(),
             };
         }
+
+        /// Reads as many items as are available, up to `items.len`, taking
+        /// the lock once.
+        pub fn read(this: *@This(), items: []?*anyopaque) !usize {
+            return switch (this.*) {
+                .sized => try this.sized.read(items),
+                .unsized => try this.unsized.read(items),
+            };
+        }
     };
 
+    /// Dispatches the items enqueued so far, up to `drain_budget` of them.
     pub fn call(this: *ThreadSafeFunction) void {
-        var task = this.channel.tryReadItem() catch null orelse return;
+        // Cleared before reading, so an item enqueued after the last read
+        // below schedules another call.
+        this.scheduled.store(false, .SeqCst);
+
+        var global = this.event_loop.global;
+        var items: [64]?*anyopaque = undefined;
+        var remaining: usize = this.drain_budget;
+        var dispatched: usize = 0;
+        while (remaining > 0) {
+            const count = this.channel.read(items[0..@minimum(items.len, remaining)]) catch 0;
+            if (count == 0) break;
+            _ = this.queue_length.fetchSub(count, .Monotonic);
+            remaining -= count;
+
+            for (items[0..count]) |item| {
+                // Each item behaves like a task of its own.
+                if (dispatched > 0) global.vm().drainMicrotasks();
+                dispatched += 1;
+                this.dispatch(item);
+            }
+        }
+
+        if (remaining == 0 and this.queue_length.load(.Monotonic) > 0) {
+            this.schedule();
+            return;
+        }
+
+        if (this.finalize_after_drain and !this.scheduled.load(.SeqCst)) {
+            this.deinit();
+        }
+    }
+
+    fn dispatch(this: *ThreadSafeFunction, item: ?*anyopaque) void {
         if (this.call_js) |cb| {
-            cb(this.event_loop.global, this.javascript_function, task, this.ctx);
+            cb(this.event_loop.global, this.javascript_function, item, this.ctx);
         } else {
             // TODO: wrapper that reports errors
             _ = JSC.C.JSObjectCallAsFunction(
@@ -1277,7 +1327,18 @@ pub const ThreadSafeFunction = struct {
         }
     }
 
+    fn schedule(this: *ThreadSafeFunction) void {
+        if (!this.scheduled.swap(true, .SeqCst)) {
+            this.event_loop.enqueueTaskConcurrent(this.concurrent_task.from(this));
+        }
+    }
+
     pub fn enqueue(this: *ThreadSafeFunction, ctx: ?*anyopaque, block: bool) !void {
+        // Counted before the write, so that call() never reads an item it
+        // has not been counted for yet.
+        const length = this.queue_length.fetchAdd(1, .Monotonic) + 1;
+        errdefer _ = this.queue_length.fetchSub(1, .Monotonic);
+
         if (block) {
             try this.channel.writeItem(ctx);
         } else {
@@ -1286,13 +1347,29 @@ pub const ThreadSafeFunction = struct {
             }
         }
 
-        this.event_loop.enqueueTaskConcurrent(this.concurrent_task.from(this));
+        _ = this.queue_high_water.fetchMax(length, .Monotonic);
+        this.schedule();
     }
 
     pub fn finalize(opaq: *anyopaque) void {
         var this = bun.cast(*ThreadSafeFunction, opaq);
+        // Items enqueued before the last release are still dispatched.
+        if (this.scheduled.load(.SeqCst)) {
+            this.finalize_after_drain = true;
+            return;
+        }
+
+        this.deinit();
+    }
+
+    fn deinit(this: *ThreadSafeFunction) void {
+        const high_water = this.queue_high_water.load(.Monotonic);
+        log("finalize: queue high water {d}", .{high_water});
+        finalized_queue_high_water = @maximum(finalized_queue_high_water, high_water);
+        _ = live_threadsafe_functions.swapRemove(this);
+
         if (this.finalizer.fun) |fun| {
-            fun(this.event_loop.global, opaq, this.finalizer.ctx);
+            fun(this.event_loop.global, this, this.finalizer.ctx);
         }
 
         JSC.C.JSValueUnprotect(this.event_loop.global, this.javascript_function.asObjectRef());
@@ -1358,7 +1435,15 @@ pub export fn napi_create_threadsafe_function(
         .channel = ThreadSafeFunction.Queue.init(max_queue_size, bun.default_allocator),
         .owning_threads = .{},
     };
+    if (env.bunVM().bundler.env.map.get("BUN_NAPI_THREADSAFE_FUNCTION_BUDGET")) |budget| {
+        if (std.fmt.parseInt(u32, budget, 10)) |parsed| {
+            if (parsed > 0) {
+                function.drain_budget = parsed;
+            }
+        } else |_| {}
+    }
     function.owning_threads.ensureTotalCapacity(bun.default_allocator, initial_thread_count) catch return .generic_failure;
+    live_threadsafe_functions.put(bun.default_allocator, function, {}) catch return .generic_failure;
     function.finalizer = .{ .ctx = thread_finalize_data, .fun = thread_finalize_cb };
     result.* = function;
     return .ok;
@@ -1461,7 +1546,6 @@ pub fn fixDeadCodeElimination() void {
     std.mem.doNotOptimizeAway(&napi_close_handle_scope);
     std.mem.doNotOptimizeAway(&napi_is_error);
     std.mem.doNotOptimizeAway(&napi_is_arraybuffer);
-    std.mem.doNotOptimizeAway(&napi_create_arraybuffer);
     std.mem.doNotOptimizeAway(&napi_create_external_arraybuffer);
     std.mem.doNotOptimizeAway(&napi_get_arraybuffer_info);
     std.mem.doNotOptimizeAway(&napi_is_typedarray);
@@ -1483,9 +1567,6 @@ pub fn fixDeadCodeElimination() void {
     std.mem.doNotOptimizeAway(&napi_get_value_bigint_int64);
     std.mem.doNotOptimizeAway(&napi_get_value_bigint_uint64);
     std.mem.doNotOptimizeAway(&napi_fatal_error);
-    std.mem.doNotOptimizeAway(&napi_create_buffer);
-    std.mem.doNotOptimizeAway(&napi_create_external_buffer);
-    std.mem.doNotOptimizeAway(&napi_create_buffer_copy);
     std.mem.doNotOptimizeAway(&napi_is_buffer);
     std.mem.doNotOptimizeAway(&napi_get_buffer_info);
     std.mem.doNotOptimizeAway(&napi_create_async_work);
@@ -1558,7 +1639,6 @@ comptime {
         _ = napi_close_handle_scope;
         _ = napi_is_error;
         _ = napi_is_arraybuffer;
-        _ = napi_create_arraybuffer;
         _ = napi_create_external_arraybuffer;
         _ = napi_get_arraybuffer_info;
         _ = napi_is_typedarray;
@@ -1580,9 +1660,6 @@ comptime {
         _ = napi_get_value_bigint_int64;
         _ = napi_get_value_bigint_uint64;
         _ = napi_fatal_error;
-        _ = napi_create_buffer;
-        _ = napi_create_external_buffer;
-        _ = napi_create_buffer_copy;
         _ = napi_is_buffer;
         _ = napi_get_buffer_info;
         _ = napi_create_async_work;
@@ -87,4 +87,40 @@ describe("ArrayBufferSink", () => {
       expect(output.byteLength).toBe(expected.byteLength);
     });
   }
+
+  describe("writeJSON", () => {
+    const values = [
+      { a: 1, b: "two", c: [true, null, 3.5] },
+      "😋 Get Emoji — All Emojis to ✂️ Copy and 📋 Paste 👌",
+      // larger than one serializer chunk, so it is written in pieces
+      Array.from({ length: 20000 }, (_, i) => ({ id: i, name: "row " + i })),
+    ];
+
+    for (const value of values) {
+      it(`${JSON.stringify(value).slice(0, 32)}`, () => {
+        const sink = new ArrayBufferSink();
+        const expected = new TextEncoder().encode(JSON.stringify(value));
+        expect(sink.writeJSON(value)).toBe(expected.byteLength);
+        const output = new Uint8Array(sink.end());
+        expect(new TextDecoder().decode(output)).toBe(JSON.stringify(value));
+      });
+    }
+
+    it("writes nothing when JSON.stringify returns undefined", () => {
+      const sink = new ArrayBufferSink();
+      expect(sink.writeJSON(undefined)).toBe(0);
+      expect(new Uint8Array(sink.end()).byteLength).toBe(0);
+    });
+
+    it("throws what toJSON throws", () => {
+      const sink = new ArrayBufferSink();
+      expect(() =>
+        sink.writeJSON({
+          toJSON() {
+            throw new Error("nope");
+          },
+        }),
+      ).toThrow("nope");
+    });
+  });
 });
@@ -50,6 +50,25 @@ it("atob", () => {
   expectInvalidCharacters("===");
   expectInvalidCharacters("====");
   expectInvalidCharacters("=====");
+  expectInvalidCharacters("YWJj".repeat(20) + "-");
+  expectInvalidCharacters("YWJj".repeat(20) + "=" + "YWJj");
+});
+
+it("atob and btoa long strings", () => {
+  let input = "";
+  for (let i = 0; i < 1000; i++) input += String.fromCharCode((i * 31) & 0xff);
+
+  for (let length of [15, 16, 17, 28, 32, 33, 64, 100, 1000]) {
+    const str = input.slice(0, length);
+    const encoded = btoa(str);
+    expect(encoded.length).toBe(Math.ceil(length / 3) * 4);
+    expect(atob(encoded)).toBe(str);
+    // two-byte strings
+    expect(atob(("\u0100" + encoded).slice(1))).toBe(str);
+    expect(atob(encoded.replace(/(.{76})/g, "$1\r\n"))).toBe(str);
+  }
+
+  expect(btoa("\u00ff".repeat(48))).toBe("////".repeat(16));
 });
 
 it("btoa", () => {
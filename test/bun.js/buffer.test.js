@@ -469,6 +469,37 @@ it("read", () => {
   reset();
 });
 
+it("read and write round trip", () => {
+  const buf = Buffer.alloc(8);
+  expect(buf.writeUInt16BE(0x1234, 0)).toBe(2);
+  expect(buf.writeInt32LE(-2, 2)).toBe(6);
+  expect(buf.writeInt8(-1, 6)).toBe(7);
+  expect(buf.writeUInt8(255)).toBe(1);
+  expect([...buf]).toEqual([0xff, 0x34, 0xfe, 0xff, 0xff, 0xff, 0xff, 0]);
+  expect(buf.readUInt16LE(0)).toBe(0x34ff);
+  expect(buf.readInt32LE(2)).toBe(-2);
+  expect(buf.readUInt32LE(2)).toBe(0xfffffffe);
+  expect(buf.readInt8(6)).toBe(-1);
+
+  expect(buf.writeDoubleBE(-1.5, 0)).toBe(8);
+  expect(buf.readDoubleBE(0)).toBe(-1.5);
+  expect(buf.writeFloatLE(0.5, 4)).toBe(8);
+  expect(buf.readFloatLE(4)).toBe(0.5);
+  expect(buf.writeBigUInt64LE(2n ** 64n - 1n, 0)).toBe(8);
+  expect(buf.readBigInt64BE(0)).toBe(-1n);
+});
+
+it("read and write check the offset", () => {
+  const buf = Buffer.alloc(8);
+  expect(() => buf.readInt32LE(5)).toThrow(RangeError);
+  expect(() => buf.readInt8(-1)).toThrow(RangeError);
+  expect(() => buf.readInt8(0.5)).toThrow(RangeError);
+  expect(() => buf.readInt8("0")).toThrow(TypeError);
+  expect(() => buf.writeDoubleLE(1, 1)).toThrow(RangeError);
+  expect(() => Buffer.alloc(2).readInt32LE(0)).toThrow(RangeError);
+  expect(() => buf.writeBigInt64LE(1, 0)).toThrow(TypeError);
+});
+
 it("write", () => {
   let buf = Buffer.alloc(16);
   function reset() {
@@ -576,6 +607,56 @@ it("lastIndexOf", () => {
   // Prints: -1, equivalent to passing 0.
   expect(b.lastIndexOf("b", null)).toBe(-1);
   expect(b.lastIndexOf("b", [])).toBe(-1);
+
+  // a match may start at byteOffset and end after it
+  expect(b.lastIndexOf("bc", 1)).toBe(1);
+  expect(b.lastIndexOf("bc", 0)).toBe(-1);
+  expect(b.lastIndexOf("ef", 4)).toBe(4);
+});
+
+it("indexOf and lastIndexOf agree with a naive search in long buffers", () => {
+  function naive(haystack, needle, last) {
+    const start = last ? haystack.length - needle.length : 0;
+    const step = last ? -1 : 1;
+    outer: for (let i = start; i >= 0 && i + needle.length <= haystack.length; i += step) {
+      for (let j = 0; j < needle.length; j++) {
+        if (haystack[i + j] !== needle[j]) continue outer;
+      }
+      return i;
+    }
+    return -1;
+  }
+
+  const haystack = Buffer.alloc(5000);
+  for (let i = 0; i < haystack.length; i++) haystack[i] = 97 + ((i * 7919) % 13 === 0 ? 1 : 0);
+
+  // short needles use the vectorized first/last byte filter, long and
+  // periodic ones may fall back to Two-Way
+  for (let length of [1, 2, 3, 16, 31, 32, 33, 64, 100, 300]) {
+    for (let at of [0, 15, 16, 31, 32, 33, 2500, haystack.length - length]) {
+      const needle = Buffer.from(haystack.subarray(at, at + length));
+      expect(haystack.indexOf(needle)).toBe(naive(haystack, needle, false));
+      expect(haystack.lastIndexOf(needle)).toBe(naive(haystack, needle, true));
+      expect(haystack.includes(needle)).toBe(true);
+    }
+
+    const missing = Buffer.alloc(length, 97);
+    missing[length >> 1] = 99;
+    expect(haystack.indexOf(missing)).toBe(-1);
+    expect(haystack.lastIndexOf(missing)).toBe(-1);
+    expect(haystack.includes(missing)).toBe(false);
+  }
+});
+
+it("indexOf re-encodes a string needle when the encoding changes", () => {
+  const buf = Buffer.from("abcΣΣxyz", "utf16le");
+  const needle = "Σx";
+  expect(buf.indexOf(needle, 0, "utf16le")).toBe(8);
+  expect(buf.indexOf(needle, 0, "utf16le")).toBe(8);
+  expect(buf.indexOf(needle, 0, "utf8")).toBe(-1);
+  expect(buf.lastIndexOf(needle, undefined, "utf16le")).toBe(8);
+  expect(Buffer.from("hello world").indexOf("d29y", 0, "base64")).toBe(6);
+  expect(Buffer.from("hello world").indexOf("d29y", 0, "hex")).toBe(-1);
 });
 
 for (let fn of [Buffer.prototype.slice, Buffer.prototype.subarray]) {
@@ -600,6 +681,41 @@ it("Buffer.from(base64)", () => {
   ).toBe('console.log("hello world")\n');
 });
 
+it("Buffer base64 round trips long inputs", () => {
+  const bytes = new Uint8Array(1027);
+  for (let i = 0; i < bytes.length; i++) bytes[i] = (i * 7919) & 0xff;
+
+  for (let length of [0, 1, 2, 3, 15, 16, 23, 24, 28, 47, 48, 100, 1027]) {
+    const buf = Buffer.from(bytes.subarray(0, length));
+    const base64 = buf.toString("base64");
+    const base64url = buf.toString("base64url");
+    expect(base64).toBe(btoa(String.fromCharCode(...buf)));
+    expect(base64url).toBe(
+      base64.replaceAll("+", "-").replaceAll("/", "_").replaceAll("=", ""),
+    );
+    expect(Buffer.from(base64, "base64").equals(buf)).toBe(true);
+    expect(Buffer.from(base64url, "base64url").equals(buf)).toBe(true);
+    // Node accepts either alphabet for either encoding
+    expect(Buffer.from(base64url, "base64").equals(buf)).toBe(true);
+    expect(Buffer.from(base64, "base64url").equals(buf)).toBe(true);
+    // two-byte strings take a different path
+    expect(Buffer.from(base64 + "\u0100", "base64").equals(buf)).toBe(true);
+  }
+});
+
+it("Buffer.from(base64) skips invalid characters and stops at padding", () => {
+  expect(Buffer.from("aGVs\nbG8g\td29y bGQ=", "base64").toString()).toBe(
+    "hello world",
+  );
+  expect(Buffer.from("aGVs!bG8=d29ybGQ=", "base64").toString()).toBe("hello");
+  expect(Buffer.byteLength("aGVsbG8gd29ybGQ=", "base64")).toBe(11);
+  expect(Buffer.byteLength("aGVsbG8gd29ybGQ", "base64url")).toBe(11);
+
+  const buf = Buffer.alloc(4);
+  expect(buf.write("aGVsbG8gd29ybGQ=", "base64")).toBe(4);
+  expect(buf.toString()).toBe("hell");
+});
+
 it("Buffer.toString regessions", () => {
   expect(
     Buffer.from([65, 0])
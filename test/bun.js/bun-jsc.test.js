@@ -22,6 +22,7 @@ import {
   reoptimizationRetryCount,
   drainMicrotasks,
   startRemoteDebugger,
+  napiThreadsafeFunctionStats,
 } from "bun:jsc";
 
 describe("bun:jsc", () => {
@@ -105,4 +106,12 @@ describe("bun:jsc", () => {
   it("getProtectedObjects", () => {
     expect(getProtectedObjects().length > 0).toBe(true);
   });
+  it("napiThreadsafeFunctionStats", () => {
+    // No native addon is loaded here, so nothing is queued.
+    expect(napiThreadsafeFunctionStats()).toEqual({
+      functions: 0,
+      queued: 0,
+      queueHighWater: 0,
+    });
+  });
 });
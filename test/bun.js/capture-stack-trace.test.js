@@ -1,4 +1,7 @@
 import { test, expect } from "bun:test";
+import { mkdtempSync, writeFileSync } from "fs";
+import { tmpdir } from "os";
+import { join } from "path";
 
 test("capture stack trace", () => {
   function f1() {
@@ -301,3 +304,105 @@ test("prepare stack trace call sites", () => {
 
   f1();
 });
+
+test("capture stack trace is formatted when stack is first read", () => {
+  function f1() {
+    return f2();
+  }
+
+  function f2() {
+    const e = { message: "before" };
+    Error.captureStackTrace(e);
+    return e;
+  }
+
+  // the frames have returned by the time stack is read
+  const e = f1();
+  expect(Object.keys(e)).toEqual(["message"]);
+  e.message = "after";
+  const lines = e.stack.split("\n");
+  expect(lines[0]).toBe("Error: after");
+  expect(lines[1]).toContain("at f2");
+  expect(lines[2]).toContain("at f1");
+  expect(e.stack).toBe(lines.join("\n"));
+
+  const descriptor = Object.getOwnPropertyDescriptor(e, "stack");
+  expect(descriptor.value).toBe(e.stack);
+  expect(descriptor.enumerable).toBe(false);
+  expect(Object.getOwnPropertySymbols(e)).toEqual([]);
+});
+
+test("capture stack trace twice on the same object", () => {
+  function first(e) {
+    Error.captureStackTrace(e);
+  }
+
+  function second(e) {
+    Error.captureStackTrace(e);
+  }
+
+  const e = {};
+  first(e);
+  second(e);
+  expect(e.stack.split("\n")[1]).toContain("at second");
+});
+
+test("prepare stack trace set after capture is used on first read", () => {
+  function f1() {
+    const e = {};
+    Error.captureStackTrace(e);
+    return e;
+  }
+
+  const e = f1();
+  const prevPrepareStackTrace = Error.prepareStackTrace;
+  Error.prepareStackTrace = (error, callSites) => {
+    expect(error).toBe(e);
+    return callSites[0].getFunctionName();
+  };
+  try {
+    expect(e.stack).toBe("f1");
+  } finally {
+    Error.prepareStackTrace = prevPrepareStackTrace;
+  }
+  expect(e.stack).toBe("f1");
+});
+
+// Writes lines joined by newline to a module exporting a function that
+// returns an Error, and checks the module's frame in its stack points at the
+// `new Error` on the last line.
+async function expectErrorPosition(name, lines, newline) {
+  const dir = mkdtempSync(join(tmpdir(), "bun-stack-position-"));
+  const path = join(dir, name + ".js");
+  writeFileSync(path, lines.join(newline));
+
+  const { fail } = await import(path);
+  const frame = fail()
+    .stack.split("\n")
+    .find(line => line.includes(path));
+  expect(frame).toBeDefined();
+
+  const line = lines.length;
+  const column = lines[line - 1].indexOf("new Error") + 1;
+  expect(frame.endsWith(`${path}:${line}:${column})`)).toBe(true);
+}
+
+test("stack positions in a module with CRLF line endings", async () => {
+  await expectErrorPosition(
+    "crlf",
+    ["// one", "// two", "export function fail() {", "  const x = 1;", "  return new Error('crlf'); }"],
+    "\r\n",
+  );
+});
+
+test("stack positions on a last line without a newline", async () => {
+  await expectErrorPosition("no-trailing-newline", ["const a = 1;", "export function fail() { return new Error('last'); }"], "\n");
+});
+
+test("stack positions in a module with a 16-bit source", async () => {
+  await expectErrorPosition(
+    "utf16",
+    ["const s = '€ ✓ 😀';", "export function fail() { const u = '✓✓'; return new Error(s + u); }"],
+    "\n",
+  );
+});
@@ -129,3 +129,57 @@ test("EventEmitter.off", () => {
   var myEmitter = new EventEmitter();
   expect(myEmitter.off("foo", () => {})).toBe(myEmitter);
 });
+
+test("EventEmitter.emit passes arguments to one or many listeners", () => {
+  var myEmitter = new EventEmitter();
+  var calls = [];
+  myEmitter.on("foo", (...args) => calls.push(["a", ...args]));
+  myEmitter.emit("foo", 1, 2);
+  myEmitter.on("foo", (...args) => calls.push(["b", ...args]));
+  myEmitter.emit("foo", 3);
+  expect(calls).toEqual([
+    ["a", 1, 2],
+    ["a", 3],
+    ["b", 3],
+  ]);
+});
+
+test("EventEmitter.emit does not run listeners added while emitting", () => {
+  var myEmitter = new EventEmitter();
+  var calls = [];
+  myEmitter.on("foo", () => {
+    calls.push("first");
+    myEmitter.on("foo", () => calls.push("added"));
+  });
+  myEmitter.once("foo", () => calls.push("once"));
+  myEmitter.emit("foo");
+  expect(calls).toEqual(["first", "once"]);
+  expect(myEmitter.listenerCount("foo")).toBe(2);
+
+  calls = [];
+  myEmitter.removeAllListeners("foo");
+  myEmitter.on("foo", () => {
+    calls.push("only");
+    myEmitter.on("foo", () => calls.push("added"));
+  });
+  myEmitter.emit("foo");
+  expect(calls).toEqual(["only"]);
+  myEmitter.emit("foo");
+  expect(calls).toEqual(["only", "only", "added"]);
+});
+
+test("EventEmitter.removeAllListeners during emit still runs the remaining listeners", () => {
+  var myEmitter = new EventEmitter();
+  var calls = [];
+  myEmitter.on("foo", () => {
+    calls.push("first");
+    myEmitter.removeAllListeners("foo");
+  });
+  myEmitter.on("foo", () => calls.push("second"));
+  myEmitter.emit("foo");
+  expect(calls).toEqual(["first", "second"]);
+  expect(myEmitter.listenerCount("foo")).toBe(0);
+
+  myEmitter.emit("foo");
+  expect(calls).toEqual(["first", "second"]);
+});
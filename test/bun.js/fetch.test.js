@@ -256,6 +256,28 @@ function testBlobInterface(blobbyConstructor, hasBlobFn) {
         if (withGC) gc();
       });
 
+      it(`utf8 bytes -> json${withGC ? " (with gc) " : ""}`, async () => {
+        const inputs = [
+          { key: "café", values: ["ÿ", "\u0080"] },
+          { "日本": "語", emoji: "😀", escaped: "\ud800" },
+          { [jsonObject.hello === true ? "ascii" : "ünïcode"]: jsonObject },
+        ];
+        for (const input of inputs) {
+          if (withGC) gc();
+          var response = blobbyConstructor(
+            new TextEncoder().encode(JSON.stringify(input)),
+          );
+          expect(await response.json()).toEqual(
+            JSON.parse(JSON.stringify(input)),
+          );
+        }
+        // invalid UTF-8 becomes U+FFFD, as it does for text()
+        var response = blobbyConstructor(
+          new Uint8Array([0x22, 0x61, 0xff, 0xc3, 0x22]),
+        );
+        expect(await response.json()).toBe("a\ufffd\ufffd");
+      });
+
       it(`${jsonObject.hello === true ? "latin1" : "utf16"} text${
         withGC ? " (with gc) " : ""
       }`, async () => {
@@ -545,6 +567,47 @@ describe("Response", () => {
       // JSON.stringify("") returns '""'
       expect(await Response.json("").text()).toBe('""');
     });
+    it("matches JSON.stringify", async () => {
+      class Point {
+        constructor(x, y) {
+          this.x = x;
+          this.y = y;
+        }
+      }
+      const inputs = [
+        { escapes: '"\\\b\f\n\r\t\u0001\u001f', latin1: "café ÿ", lone: "\ud800 \udfff x\ud83d" },
+        { skipped: undefined, fn() {}, [Symbol("a")]: 1, kept: null },
+        [undefined, () => {}, Symbol("b"), NaN, -Infinity, -0, 1e21, 0.1, -2147483648],
+        [1, , 3],
+        { date: new Date(0), map: new Map([[1, 2]]), set: new Set([1]), point: new Point(1, 2) },
+        { get getter() { return "got"; }, nested: { deep: [{ deeper: ["a".repeat(100_000) + "é"] }] } },
+        { toJSON(key) { return "key:" + key; } },
+        { child: { toJSON(key) { return "key:" + key; } } },
+        [{ toJSON(key) { return "index:" + key; } }],
+        { "1": "indexed", b: 2, a: 1 },
+        new Array(50_000).fill("日本語"),
+        true,
+        12345,
+      ];
+      for (let input of inputs) {
+        const output = JSON.stringify(input);
+        expect(await Response.json(input).text()).toBe(output);
+      }
+      expect(await Response.json(Symbol("c")).text()).toBe("");
+    });
+    it("throws like JSON.stringify", () => {
+      const cyclic = { a: [] };
+      cyclic.a.push(cyclic);
+      expect(() => Response.json(cyclic)).toThrow();
+      expect(() => Response.json({ big: 1n })).toThrow();
+      expect(() =>
+        Response.json({
+          toJSON() {
+            throw new Error("from toJSON");
+          },
+        }),
+      ).toThrow("from toJSON");
+    });
     it("sets the content-type header", () => {
       let response = Response.json("hello");
       expect(response.type).toBe("basic");
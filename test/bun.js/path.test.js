@@ -83,6 +83,55 @@ it("path.basename", () => {
   );
 });
 
+it("path.dirname", () => {
+  strictEqual(path.posix.dirname("/a/b/"), "/a");
+  strictEqual(path.posix.dirname("/a/b"), "/a");
+  strictEqual(path.posix.dirname("/a"), "/");
+  strictEqual(path.posix.dirname(""), ".");
+  strictEqual(path.posix.dirname("/"), "/");
+  strictEqual(path.posix.dirname("////"), "/");
+  strictEqual(path.posix.dirname("//a"), "//");
+  strictEqual(path.posix.dirname("foo"), ".");
+  strictEqual(path.posix.dirname("a/b//c"), "a/b/");
+});
+
+it("path.extname", () => {
+  strictEqual(path.posix.extname("file.js"), ".js");
+  strictEqual(path.posix.extname("/a/b/file.test.js"), ".js");
+  strictEqual(path.posix.extname("file"), "");
+  strictEqual(path.posix.extname(".file"), "");
+  strictEqual(path.posix.extname(".file.ext"), ".ext");
+  strictEqual(path.posix.extname("file."), ".");
+  strictEqual(path.posix.extname("file.ext/"), ".ext");
+  strictEqual(path.posix.extname(".."), "");
+  strictEqual(path.posix.extname(""), "");
+});
+
+it("path functions handle 16-bit strings like 8-bit ones", () => {
+  // "é" is Latin-1, so "€" is what makes these strings 16-bit.
+  strictEqual(path.posix.dirname("//€"), "//");
+  strictEqual(path.posix.dirname("/€/b/"), "/€");
+  strictEqual(path.posix.dirname("€"), ".");
+  strictEqual(path.posix.basename("/a/€.js", ".js"), "€");
+  strictEqual(path.posix.basename("/a/b.€", ".€"), "b");
+  strictEqual(path.posix.basename("/a/b.€", ".js"), "b.€");
+  strictEqual(path.posix.extname("/a/€.b.js"), ".js");
+  strictEqual(path.posix.extname("/a/.€"), "");
+  strictEqual(path.posix.join("€", "../b", "./c/"), "b/c/");
+  strictEqual(path.posix.join("a", "€"), "a/€");
+  strictEqual(path.posix.resolve("/€", "..", "b"), "/b");
+  strictEqual(path.posix.resolve("ignored", "/a", "€/"), "/a/€");
+});
+
+it("path functions can be called detached", () => {
+  const { basename, dirname, extname, join } = path.posix;
+  strictEqual(basename("/a/b.js"), "b.js");
+  strictEqual(dirname("/a/b.js"), "/a");
+  strictEqual(extname("/a/b.js"), ".js");
+  strictEqual(join("a", "b"), "a/b");
+  strictEqual(path.win32.basename.call(undefined, "C:\\a\\b.js"), "b.js");
+});
+
 it("path.join", () => {
   const failures = [];
   const backslashRE = /\\/g;
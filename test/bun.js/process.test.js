@@ -1,4 +1,6 @@
+import { spawnSync } from "bun";
 import { describe, expect, it } from "bun:test";
+import { bunExe } from "./bunExe";
 
 it("process", () => {
   // this property isn't implemented yet but it should at least return a string
@@ -86,6 +88,20 @@ it("process.env", () => {
   expect(process.env["LOL SMILE latin1 <abc>"]).toBe(undefined);
 });
 
+it("process.env exposes more than 768 variables", () => {
+  const env = { ...process.env };
+  for (let i = 0; i < 1000; i++) env[`BUN_ENV_TEST_${i}`] = `${i}`;
+  const { stdout } = spawnSync({
+    cmd: [
+      bunExe(),
+      "-e",
+      "const keys = Object.keys(process.env).filter(k => k.startsWith('BUN_ENV_TEST_')); delete process.env.BUN_ENV_TEST_1; console.log(keys.length, process.env.BUN_ENV_TEST_999, process.env.BUN_ENV_TEST_1)",
+    ],
+    env,
+  });
+  expect(stdout.toString().trim()).toBe("1000 999 undefined");
+});
+
 it("process.env is spreadable and editable", () => {
   process.env["LOL SMILE UTF16 😂"] = "😂";
   const { "LOL SMILE UTF16 😂": lol, ...rest } = process.env;
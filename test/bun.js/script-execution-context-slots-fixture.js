@@ -0,0 +1,5 @@
+// Goes through every slot in the table and some identifiers past it, which
+// leaves this process with no slots to hand out, so it runs on its own.
+const { slots } = globalThis[Symbol.for("Bun.lazy")]("scriptExecutionContextForTesting");
+
+console.log(JSON.stringify(slots(Number(process.argv[2]))));
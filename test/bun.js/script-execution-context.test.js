@@ -0,0 +1,53 @@
+import { spawnSync } from "bun";
+import { describe, expect, it } from "bun:test";
+import { bunExe } from "bunExe";
+
+const { slots, postTasksFromThreads } = globalThis[Symbol.for("Bun.lazy")]("scriptExecutionContextForTesting");
+
+describe("ScriptExecutionContext", () => {
+  it("retires identifiers across slot segments", () => {
+    // 1024 slots per segment, so this allocates at least one new segment.
+    const result = slots(1500);
+    expect(result.last - result.first).toBe(1500);
+    expect(result.staleLookups).toBe(0);
+    expect(result.missingLookups).toBe(0);
+    expect(result.acceptedPosts).toBe(0);
+    expect(result.releasedTasks).toBe(1501);
+    expect(result.postAfterRemoval).toBe(false);
+  });
+
+  it("retires identifiers past the slot table", () => {
+    // The table covers the first 256 * 1024 identifiers, the rest go in a map.
+    const regenerations = 256 * 1024 + 16;
+    const { stdout, exitCode } = spawnSync({
+      cmd: [bunExe(), import.meta.dir + "/script-execution-context-slots-fixture.js", String(regenerations)],
+      env: process.env,
+      stderr: "inherit",
+    });
+    expect(exitCode).toBe(0);
+
+    const result = JSON.parse(stdout.toString());
+    expect(result.last > 256 * 1024).toBe(true);
+    expect(result.staleLookups).toBe(0);
+    expect(result.missingLookups).toBe(0);
+    expect(result.acceptedPosts).toBe(0);
+    expect(result.releasedTasks).toBe(regenerations + 1);
+    expect(result.postAfterRemoval).toBe(false);
+  });
+
+  for (const batchSize of [1, 64]) {
+    it(`runs tasks posted concurrently in the order each thread posted them (${batchSize} per post)`, async () => {
+      const threads = 8;
+      const tasksPerThread = 2000;
+      const order = await postTasksFromThreads(threads, tasksPerThread, batchSize);
+      expect(order.length).toBe(threads * tasksPerThread);
+
+      const next = new Array(threads).fill(0);
+      for (const value of order) {
+        const thread = Math.floor(value / tasksPerThread);
+        expect(value % tasksPerThread).toBe(next[thread]++);
+      }
+      expect(next).toEqual(new Array(threads).fill(tasksPerThread));
+    });
+  }
+});
@@ -326,6 +326,29 @@ describe("streaming", () => {
     server.stop();
   });
 
+  it("JSON from JS via writeJSON() on a direct stream", async () => {
+    // several serializer chunks, each sent as soon as it is full
+    const value = Array.from({ length: 20000 }, (_, i) => ({ id: i, name: "row " + i }));
+
+    const server = serve({
+      port: port++,
+      fetch(req) {
+        return new Response(
+          new ReadableStream({
+            type: "direct",
+            pull(controller) {
+              controller.writeJSON(value);
+              controller.close();
+            },
+          }),
+        );
+      },
+    });
+    const response = await fetch(`http://${server.hostname}:${server.port}`);
+    expect(await response.text()).toBe(JSON.stringify(value));
+    server.stop();
+  });
+
   it("text from JS, 2 chunks, with delay in pull", async () => {
     const fixture = resolve(import.meta.dir, "./fetch.js.txt");
     const textToExpect = readFileSync(fixture, "utf-8");
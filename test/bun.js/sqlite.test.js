@@ -1,6 +1,7 @@
 import { expect, it, describe } from "bun:test";
 import { Database, constants } from "bun:sqlite";
-import { existsSync, fstat, writeFileSync } from "fs";
+import { existsSync, fstat, unlinkSync, writeFileSync } from "fs";
+import { tmpdir } from "os";
 var encode = (text) => new TextEncoder().encode(text);
 
 it("Database.open", () => {
@@ -286,6 +287,115 @@ it("supports serialize/deserialize", () => {
   }
 });
 
+it("deserializes readonly databases in place", () => {
+  const db = Database.open(":memory:");
+  db.exec("CREATE TABLE test (id INTEGER PRIMARY KEY, name TEXT)");
+  db.exec('INSERT INTO test (name) VALUES ("Hello")');
+  db.exec('INSERT INTO test (name) VALUES ("World")');
+
+  const path = tmpdir() + "/bun-sqlite-deserialize-" + Date.now() + ".sqlite";
+  writeFileSync(path, db.serialize());
+
+  try {
+    const db2 = new Database(Bun.mmap(path), { readonly: true });
+    expect(db2.query("SELECT name FROM test").all()).toEqual([
+      { name: "Hello" },
+      { name: "World" },
+    ]);
+    expect(() => db2.exec("insert into test (name) values ('foo')")).toThrow(
+      "attempt to write a readonly database",
+    );
+
+    // The connection outlives close() until this statement is finalized,
+    // which is when the buffer is let go.
+    const stmt = db2.prepare("SELECT name FROM test");
+    db2.close();
+    stmt.finalize();
+  } finally {
+    unlinkSync(path);
+  }
+});
+
+it("opens files memory-mapped", () => {
+  const db = Database.open(":memory:");
+  db.exec("CREATE TABLE test (id INTEGER PRIMARY KEY, name TEXT)");
+  db.exec('INSERT INTO test (name) VALUES ("Hello")');
+
+  const path = tmpdir() + "/bun-sqlite-mmap-" + Date.now() + ".sqlite";
+  const bytes = db.serialize();
+  writeFileSync(path, bytes);
+
+  try {
+    const readonly = new Database(path, { readonly: true, mmap: true });
+    expect(readonly.query("PRAGMA mmap_size").get()).toEqual({
+      mmap_size: bytes.byteLength,
+    });
+    expect(readonly.query("SELECT name FROM test").get()).toEqual({
+      name: "Hello",
+    });
+    readonly.close();
+
+    const readwrite = new Database(path, { readwrite: true, mmap: true });
+    expect(readwrite.query("PRAGMA mmap_size").get()).toEqual({
+      mmap_size: bytes.byteLength * 2,
+    });
+    readwrite.close();
+  } finally {
+    unlinkSync(path);
+  }
+});
+
+it("reads columns whose values change type", () => {
+  const db = Database.open(":memory:");
+  db.exec("CREATE TABLE test (id INTEGER PRIMARY KEY, value, price REAL)");
+  const insert = db.prepare("INSERT INTO test (value, price) VALUES (?, ?)");
+  insert.run(1, 1.5);
+  insert.run(2, 2.5);
+  insert.run("three", null);
+  insert.run(4.5, 4);
+  insert.run(null, 5.5);
+  insert.run(new Uint8Array([6]), 6.5);
+  insert.run(7, 7.5);
+
+  const expected = [
+    [1, 1, 1.5],
+    [2, 2, 2.5],
+    [3, "three", null],
+    [4, 4.5, 4],
+    [5, null, 5.5],
+    [6, new Uint8Array([6]), 6.5],
+    [7, 7, 7.5],
+  ];
+  const query = db.prepare("SELECT id, value, price FROM test ORDER BY id");
+  for (let i = 0; i < 2; i++) {
+    expect(query.values()).toEqual(expected);
+    expect(query.all()).toEqual(
+      expected.map(([id, value, price]) => ({ id, value, price })),
+    );
+  }
+});
+
+it("reads type-stable columns with NULLs and a late mismatch", () => {
+  const db = Database.open(":memory:");
+  db.exec("CREATE TABLE test (id INTEGER PRIMARY KEY, name TEXT, price REAL, data BLOB, extra)");
+  const insert = db.prepare("INSERT INTO test (name, price, data, extra) VALUES (?, ?, ?, ?)");
+  const expected = [];
+  for (let i = 1; i <= 100; i++) {
+    const row = [i, i % 7 ? "name " + i : null, i % 5 ? i + 0.5 : null, i % 3 ? new Uint8Array([i]) : null, i];
+    insert.run(...row.slice(1));
+    expected.push(row);
+  }
+  // The last row breaks the profile of the untyped column.
+  insert.run("last", 0.25, new Uint8Array([0]), "not a number");
+  expected.push([101, "last", 0.25, new Uint8Array([0]), "not a number"]);
+
+  const query = db.prepare("SELECT id, name, price, data, extra FROM test ORDER BY id");
+  for (let i = 0; i < 2; i++) {
+    expect(query.values()).toEqual(expected);
+    expect(query.all()).toEqual(expected.map(([id, name, price, data, extra]) => ({ id, name, price, data, extra })));
+  }
+});
+
 it("db.query()", () => {
   const db = Database.open(":memory:");
   db.exec("CREATE TABLE test (id INTEGER PRIMARY KEY, name TEXT)");
@@ -73,6 +73,74 @@ describe("ReadableStream.prototype.tee", () => {
     });
   });
 
+  describe("byte chunks", () => {
+    it("shares the chunk between both branches", async () => {
+      const chunk = new Uint8Array([1, 2, 3]);
+      var [a, b] = new ReadableStream({
+        start(controller) {
+          controller.enqueue(chunk);
+          controller.close();
+        },
+      }).tee();
+
+      const { value: first } = await a.getReader().read();
+      const { value: second } = await b.getReader().read();
+      expect(first.buffer).toBe(chunk.buffer);
+      expect(second.buffer).toBe(chunk.buffer);
+    });
+
+    it("highWaterMark bounds how far the fast branch reads ahead", async () => {
+      var pulls = 0;
+      var [fast, slow] = new ReadableStream({
+        pull(controller) {
+          pulls++;
+          controller.enqueue(new Uint8Array(16));
+          if (pulls === 64) controller.close();
+        },
+      }).tee({ highWaterMark: 32 });
+
+      const reader = fast.getReader();
+      const pending = [reader.read(), reader.read(), reader.read(), reader.read()];
+      await new Promise(resolve => setTimeout(resolve, 10));
+      expect(pulls < 8).toBe(true);
+
+      // Once the slow branch is consumed too, both run to completion.
+      const drainFast = async () => {
+        var total = 0;
+        for (const { value } of await Promise.all(pending)) total += value.byteLength;
+        while (true) {
+          const { done, value } = await reader.read();
+          if (done) return total;
+          total += value.byteLength;
+        }
+      };
+      const [fastBytes, slowBytes] = await Promise.all([
+        drainFast(),
+        new Response(slow).arrayBuffer().then(buffer => buffer.byteLength),
+      ]);
+      expect(slowBytes).toBe(64 * 16);
+      expect(fastBytes).toBe(64 * 16);
+    });
+
+    it("highWaterMark of 0 still pulls for pending reads", async () => {
+      var pulls = 0;
+      var [a, b] = new ReadableStream({
+        pull(controller) {
+          pulls++;
+          controller.enqueue(new Uint8Array(8));
+          if (pulls === 4) controller.close();
+        },
+      }).tee({ highWaterMark: 0 });
+
+      const [aBytes, bBytes] = await Promise.all([
+        new Response(a).arrayBuffer(),
+        new Response(b).arrayBuffer(),
+      ]);
+      expect(aBytes.byteLength).toBe(32);
+      expect(bBytes.byteLength).toBe(32);
+    });
+  });
+
   describe("direct stream", () => {
     it("works", async () => {
       try {
@@ -29,6 +29,44 @@ it("StringDecoder-ucs-2", () => {
   test("ucs2", Buffer.from("ababc", "ucs2"), "ababc");
 });
 
+it("StringDecoder-utf8 chunk boundaries", () => {
+  const text = "log ¢ line € with 𤭢 and ascii\n".repeat(3);
+  const buf = Buffer.from(text);
+  for (let size = 1; size <= 7; size++) {
+    const decoder = new StringDecoder("utf8");
+    let res = "";
+    for (let i = 0; i < buf.length; i += size) res += decoder.write(buf.subarray(i, i + size));
+    res += decoder.end();
+    expect(res).toBe(text);
+  }
+
+  // A stray continuation byte on its own is replaced.
+  let decoder = new StringDecoder("utf8");
+  expect(decoder.write(Buffer.from([0x82]))).toBe("\ufffd");
+  expect(decoder.end()).toBe("");
+
+  // An incomplete sequence is replaced by a single U+FFFD, like Node does.
+  decoder = new StringDecoder("utf8");
+  expect(decoder.write(Buffer.from([0xed, 0xed]))).toBe("\ufffd");
+  expect(decoder.write(Buffer.from([0xa0]))).toBe("");
+  expect(decoder.end()).toBe("\ufffd");
+
+  decoder = new StringDecoder("utf8");
+  expect(decoder.write(Buffer.from([0xed, 0xed]))).toBe("\ufffd");
+  expect(decoder.end(Buffer.from([0xa0]))).toBe("\ufffd");
+
+  decoder = new StringDecoder("utf8");
+  expect(decoder.write(Buffer.from([0xf0, 0x9f]))).toBe("");
+  expect(decoder.write(Buffer.from([0x98, 0x41]))).toBe("\ufffdA");
+  expect(decoder.end(Buffer.from([0x42, 0xe2, 0x82]))).toBe("B\ufffd");
+
+  // end() starts over.
+  decoder = new StringDecoder("utf8");
+  expect(decoder.write(Buffer.from([0xe2, 0x82]))).toBe("");
+  expect(decoder.end()).toBe("\ufffd");
+  expect(decoder.write(Buffer.from("€"))).toBe("€");
+});
+
 it("StringDecoder-utf16le", () => {
   test("utf16le", Buffer.from("3DD84DDC", "hex"), "\ud83d\udc4d");
 });
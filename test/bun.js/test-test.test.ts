@@ -464,6 +464,70 @@ test("deepEquals set and map", () => {
   expect(a).not.toEqual(c);
 });
 
+test("deepEquals large sets and maps", () => {
+  const count = 10000;
+  const set1 = new Set();
+  const set2 = new Set();
+  const map1 = new Map();
+  const map2 = new Map();
+  for (let i = 0; i < count; i++) {
+    set1.add(i);
+    set1.add("key" + i);
+    set2.add("key" + (count - 1 - i));
+    set2.add(count - 1 - i);
+    map1.set("key" + i, { value: i });
+    map2.set("key" + (count - 1 - i), { value: count - 1 - i });
+  }
+  expect(set1).toEqual(set2);
+  expect(map1).toEqual(map2);
+
+  set2.delete(0);
+  set2.add(count);
+  expect(set1).not.toEqual(set2);
+  map2.set("key0", { value: -1 });
+  expect(map1).not.toEqual(map2);
+
+  // A failed match against one member must not affect the next.
+  expect(new Set([{ a: { x: 2 } }, { a: { x: 1 } }])).toEqual(new Set([{ a: { x: 1 } }, { a: { x: 2 } }]));
+  expect(
+    new Map<any, any>([
+      [{ k: 2 }, { v: 2 }],
+      [{ k: 1 }, { v: 1 }],
+      ["p", 1],
+    ]),
+  ).toEqual(
+    new Map<any, any>([
+      ["p", 1],
+      [{ k: 1 }, { v: 1 }],
+      [{ k: 2 }, { v: 2 }],
+    ]),
+  );
+
+  // Members matched inside a Set are not kept paired once the Set is done.
+  const member = { x: 1 };
+  expect([new Set([member]), member]).toEqual([new Set([{ x: 1 }]), { x: 1 }]);
+});
+
+test("deepEquals deep and cyclic graphs", () => {
+  function chain(length: number, end: any) {
+    let node: any = { end };
+    for (let i = 0; i < length; i++) node = { i, next: node };
+    return node;
+  }
+  expect(chain(1000, 1)).toEqual(chain(1000, 1));
+  expect(chain(1000, 1)).not.toEqual(chain(1000, 2));
+
+  function ring(length: number) {
+    const first: any = { i: 0 };
+    let node = first;
+    for (let i = 1; i < length; i++) node = node.next = { i };
+    node.next = first;
+    return first;
+  }
+  expect(ring(100)).toEqual(ring(100));
+  expect(ring(100)).not.toEqual(ring(99));
+});
+
 test("deepEquals - symbols", () => {
   const x = [5, 6];
   x[99] = 7;
@@ -83,3 +83,56 @@ describe("url", () => {
     }
   });
 });
+
+describe("URLSearchParams", () => {
+  const query = Array.from({ length: 64 }, (_, i) => `k${i}=v${i}`).join("&");
+
+  it("looks up names in large queries", () => {
+    const params = new URLSearchParams("?" + query + "&k3=again");
+    expect(params.get("k0")).toBe("v0");
+    expect(params.get("k63")).toBe("v63");
+    expect(params.get("missing")).toBe(null);
+    expect(params.has("k10")).toBe(true);
+    expect(params.has("k64")).toBe(false);
+    expect(params.getAll("k3")).toEqual(["v3", "again"]);
+
+    params.append("k64", "v64");
+    expect(params.get("k64")).toBe("v64");
+    params.set("k3", "once");
+    expect(params.getAll("k3")).toEqual(["once"]);
+    params.delete("k0");
+    expect(params.has("k0")).toBe(false);
+    expect(params.get("k1")).toBe("v1");
+    params.sort();
+    expect(params.get("k64")).toBe("v64");
+    expect([...params.keys()][0]).toBe("k1");
+  });
+
+  it("writes changes to the URL it belongs to", () => {
+    const url = new URL("https://example.com/path?" + query + "#hash");
+    const params = url.searchParams;
+    for (let i = 0; i < 64; i++) params.set(`k${i}`, `w${i}`);
+    params.append("extra", "a b");
+    expect(url.search).toBe(
+      "?" +
+        Array.from({ length: 64 }, (_, i) => `k${i}=w${i}`).join("&") +
+        "&extra=a+b",
+    );
+    expect(url.href.endsWith("&extra=a+b#hash")).toBe(true);
+    expect(JSON.stringify(url)).toBe(JSON.stringify(url.href));
+  });
+
+  it("drops unwritten changes when the URL is replaced", () => {
+    const url = new URL("https://example.com/?a=1");
+    url.searchParams.set("a", "2");
+    url.href = "https://example.com/?b=3";
+    expect(url.searchParams.get("a")).toBe(null);
+    expect(url.searchParams.get("b")).toBe("3");
+    expect(url.search).toBe("?b=3");
+
+    url.searchParams.set("c", "4");
+    url.search = "?d=5";
+    expect(url.searchParams.has("c")).toBe(false);
+    expect(url.href).toBe("https://example.com/?d=5");
+  });
+});
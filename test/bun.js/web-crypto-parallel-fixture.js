@@ -0,0 +1,23 @@
+// Runs with BUN_CRYPTO_THREADS=3, so two deriveBits may run at once.
+import { cryptoQueueStats } from "bun:jsc";
+
+const password = await crypto.subtle.importKey(
+  "raw",
+  new TextEncoder().encode("password"),
+  "PBKDF2",
+  false,
+  ["deriveBits"],
+);
+const derive = iterations =>
+  crypto.subtle.deriveBits(
+    { name: "PBKDF2", hash: "SHA-256", salt: new Uint8Array(16), iterations },
+    password,
+    256,
+  );
+
+// Leaves one worker idle, then dispatches two slow operations back to back.
+await derive(1);
+await Bun.sleep(50);
+await Promise.all([derive(500_000), derive(500_000)]);
+
+console.log(JSON.stringify(cryptoQueueStats().operations.deriveBits));
@@ -1,4 +1,7 @@
 import { describe, expect, it } from "bun:test";
+import { cryptoQueueStats } from "bun:jsc";
+import { spawnSync } from "bun";
+import { bunExe } from "bunExe";
 
 describe("Web Crypto", () => {
   it("has globals", () => {
@@ -80,4 +83,164 @@ describe("Web Crypto", () => {
     const isSigValid = await verifySignature(msg, signature, SECRET);
     expect(isSigValid).toBe(true);
   });
+
+  it("runs concurrent operations on the crypto thread pool", async () => {
+    const before = cryptoQueueStats();
+    expect(before.threads).toBeGreaterThan(0);
+
+    const password = await crypto.subtle.importKey(
+      "raw",
+      new TextEncoder().encode("password"),
+      "PBKDF2",
+      false,
+      ["deriveBits"],
+    );
+    const derive = (salt: string) =>
+      crypto.subtle.deriveBits(
+        {
+          name: "PBKDF2",
+          hash: "SHA-256",
+          salt: new TextEncoder().encode(salt),
+          iterations: 1000,
+        },
+        password,
+        256,
+      );
+
+    // larger than the inline threshold, so these go through the queue
+    const inputs = Array.from({ length: 64 }, (_, i) => new Uint8Array(8192).fill(i));
+    const [digests, derived, expected] = await Promise.all([
+      Promise.all(inputs.map(input => crypto.subtle.digest("SHA-256", input))),
+      Promise.all([derive("a"), derive("b"), derive("a")]),
+      crypto.subtle.digest("SHA-256", inputs[7]),
+    ]);
+
+    expect(Buffer.from(digests[7]).equals(Buffer.from(expected))).toBe(true);
+    expect(new Set(digests.map(digest => Buffer.from(digest).toString("hex"))).size).toBe(64);
+    expect(Buffer.from(derived[0]).equals(Buffer.from(derived[2]))).toBe(true);
+    expect(Buffer.from(derived[0]).equals(Buffer.from(derived[1]))).toBe(false);
+
+    // a task counts as completed only after its result has been posted back
+    const started = (stats, operation) =>
+      stats.operations[operation].completed + stats.operations[operation].running;
+    const after = cryptoQueueStats();
+    expect(started(after, "digest") - started(before, "digest")).toBe(65);
+    expect(started(after, "deriveBits") - started(before, "deriveBits")).toBe(3);
+    expect(after.operations.digest.pending).toBe(0);
+    expect(after.operations.digest.maxWaitMs).toBeGreaterThanOrEqual(0);
+  });
+
+  it("runs two slow operations dispatched together in parallel", () => {
+    const { stdout, exitCode } = spawnSync({
+      cmd: [bunExe(), import.meta.dir + "/web-crypto-parallel-fixture.js"],
+      env: { ...process.env, BUN_CRYPTO_THREADS: "3" },
+    });
+    expect(exitCode).toBe(0);
+    const stats = JSON.parse(stdout!.toString());
+    expect(stats.completed).toBe(3);
+    // The second one must not have waited for the first to finish.
+    expect(stats.peakRunning).toBe(2);
+  });
+
+  it("computes small digests and HMACs without the work queue", async () => {
+    const before = cryptoQueueStats();
+    const message = new TextEncoder().encode("hello world");
+
+    const digest = await crypto.subtle.digest("SHA-256", message);
+    expect(Buffer.from(digest).toString("hex")).toBe(
+      "b94d27b9934d3e08a52e52d7da7dabfac484efe37a5380ee9088f7ace2efcde9",
+    );
+    const sha1 = await crypto.subtle.digest("SHA-1", new Uint8Array(0));
+    expect(Buffer.from(sha1).toString("hex")).toBe("da39a3ee5e6b4b0d3255bfef95601890afd80709");
+
+    const key = await crypto.subtle.importKey(
+      "raw",
+      new TextEncoder().encode("secret"),
+      { name: "HMAC", hash: "SHA-256" },
+      false,
+      ["sign", "verify"],
+    );
+    const signature = await crypto.subtle.sign("HMAC", key, message);
+    expect(Buffer.from(signature).toString("hex")).toBe(
+      "734cc62f32841568f45715aeb9f4d7891324e6d948e4c6c60c0621cdac48623a",
+    );
+    expect(await crypto.subtle.verify("HMAC", key, signature, message)).toBe(true);
+    expect(await crypto.subtle.verify("HMAC", key, signature.slice(1), message)).toBe(false);
+    expect(await crypto.subtle.verify("HMAC", key, signature, new Uint8Array(1))).toBe(false);
+
+    const after = cryptoQueueStats();
+    for (const operation of ["digest", "sign", "verify"]) {
+      expect(after.operations[operation].completed + after.operations[operation].running).toBe(
+        before.operations[operation].completed + before.operations[operation].running,
+      );
+    }
+  });
+
+  describe("DigestStream", () => {
+    const hex = buffer => Buffer.from(buffer).toString("hex");
+
+    it("hashes chunks passed to update()", () => {
+      const hasher = new crypto.DigestStream("SHA-256");
+      hasher.update("hello");
+      hasher.update(new TextEncoder().encode(" wor").buffer);
+      hasher.update(new Uint8Array([0, 108, 100, 0]).subarray(1, 3));
+      expect(hex(hasher.digest())).toBe("b94d27b9934d3e08a52e52d7da7dabfac484efe37a5380ee9088f7ace2efcde9");
+
+      const unicode = new crypto.DigestStream({ name: "sha-1" });
+      unicode.update("h\u00e9llo");
+      expect(hex(unicode.digest())).toBe("35b5ea45c5e41f78b46a937cc74d41dfea920890");
+    });
+
+    it("matches subtle.digest", async () => {
+      const data = new Uint8Array(1 << 20).map((_, i) => (i * 7) & 255);
+      for (const algorithm of ["SHA-1", "SHA-256", "SHA-384", "SHA-512"]) {
+        const hasher = new crypto.DigestStream(algorithm);
+        for (let offset = 0; offset < data.length; offset += 10000) {
+          hasher.update(data.subarray(offset, offset + 10000));
+        }
+        expect(hex(hasher.digest())).toBe(hex(await crypto.subtle.digest(algorithm, data)));
+      }
+    });
+
+    it("hashes a ReadableStream through writable", async () => {
+      const chunk = new Uint8Array(64 * 1024).fill(42);
+      let remaining = 32;
+      const readable = new ReadableStream({
+        pull(controller) {
+          if (remaining-- === 0) return controller.close();
+          controller.enqueue(chunk);
+        },
+      });
+
+      const hasher = new crypto.DigestStream("SHA-512");
+      expect(hasher.writable).toBe(hasher.writable);
+      await readable.pipeTo(hasher.writable);
+
+      const expected = await crypto.subtle.digest("SHA-512", new Uint8Array(32 * chunk.length).fill(42));
+      expect(hex(hasher.digest())).toBe(hex(expected));
+    });
+
+    it("throws after digest() and for unknown algorithms", () => {
+      const hasher = new crypto.DigestStream("SHA-256");
+      hasher.digest();
+      expect(() => hasher.update("more")).toThrow();
+      expect(() => hasher.digest()).toThrow();
+      expect(() => new crypto.DigestStream("MD5")).toThrow();
+      expect(() => crypto.DigestStream("SHA-256")).toThrow();
+      expect(() => hasher.update.call({}, "data")).toThrow();
+    });
+
+    it("can be subclassed", () => {
+      class Hasher extends crypto.DigestStream {
+        hex() {
+          return hex(this.digest());
+        }
+      }
+      const hasher = new Hasher("SHA-256");
+      expect(hasher instanceof Hasher).toBe(true);
+      expect(hasher instanceof crypto.DigestStream).toBe(true);
+      hasher.update("hello world");
+      expect(hasher.hex()).toBe("b94d27b9934d3e08a52e52d7da7dabfac484efe37a5380ee9088f7ace2efcde9");
+    });
+  });
 });
@@ -48,6 +48,32 @@ test("MessageEvent", () => {
   expect(called).toBe(true);
 });
 
+test("EventTarget dispatch order and listeners added while dispatching", () => {
+  const target = new EventTarget();
+  const calls = [];
+  target.addEventListener("ping", () => {
+    calls.push("bubble");
+    target.addEventListener("ping", () => calls.push("added"));
+    target.addEventListener("ping", () => calls.push("added capture"), true);
+  });
+  target.dispatchEvent(new Event("ping"));
+  expect(calls).toEqual(["bubble"]);
+
+  calls.length = 0;
+  target.addEventListener("pong", () => calls.push("bubble"));
+  target.addEventListener("pong", () => calls.push("capture"), true);
+  target.addEventListener("pong", event => {
+    calls.push("stop");
+    event.stopImmediatePropagation();
+  });
+  target.addEventListener("pong", () => calls.push("after stop"));
+  const event = new Event("pong");
+  target.dispatchEvent(event);
+  expect(calls).toEqual(["capture", "bubble", "stop"]);
+  expect(event.target).toBe(target);
+  expect(event.eventPhase).toBe(0);
+});
+
 it("crypto.getRandomValues", () => {
   var foo = new Uint8Array(32);
 